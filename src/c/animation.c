@@ -0,0 +1,130 @@
+#include "animation.h"
+#include "mode_registry.h"
+#include <string.h>
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+void animation_init_hourglass(HourglassState *state) {
+    sand_init(&state->sand, 0);
+}
+
+void animation_init_water(WaterState *state) {
+    water_init(&state->surface);
+}
+
+void animation_init_matrix(MatrixState *state, int seed) {
+    for (int col = 0; col < MATRIX_COLS; col++) {
+        state->drops[col] = (int16_t)(((col * 3 + seed) % MATRIX_ROWS) * MATRIX_SUBROWS);
+        state->prev_drops[col] = state->drops[col];
+        state->speeds[col] = (uint8_t)(1 + (col % 3));
+
+        for (int row = 0; row < MATRIX_ROWS; row++) {
+            state->chars[col][row] = (uint8_t)('0' + ((col + row * 7) % 10));
+        }
+    }
+    state->steps = (uint32_t)seed * ANIM_STEPS_PER_SECOND;
+}
+
+void animation_reset_clock(AnimationState *anim) {
+    anim->clock.accumulator_ms = 0;
+    anim->clock.frame_ms = 0;
+}
+
+// =============================================================================
+// Simulation
+// =============================================================================
+
+void animation_sync_hourglass(HourglassState *state, int remaining_seconds, int total_seconds) {
+    if (total_seconds <= 0) return;
+
+    int elapsed = total_seconds - remaining_seconds;
+    sand_set_target(&state->sand, (elapsed * SAND_GRAINS) / total_seconds);
+}
+
+void animation_step_hourglass(HourglassState *state) {
+    sand_step(&state->sand);
+}
+
+void animation_step_water(WaterState *state) {
+    water_step(&state->surface);
+}
+
+void animation_step_matrix(MatrixState *state) {
+    for (int col = 0; col < MATRIX_COLS; col++) {
+        // speeds are rows per second and a row is one second's worth of steps
+        state->prev_drops[col] = state->drops[col];
+        state->drops[col] = (int16_t)((state->drops[col] + state->speeds[col]) % MATRIX_DROP_PERIOD);
+    }
+
+    // Once a second each column swaps one glyph
+    state->steps++;
+    if (state->steps % ANIM_STEPS_PER_SECOND == 0) {
+        int t = (int)(state->steps / ANIM_STEPS_PER_SECOND);
+        for (int col = 0; col < MATRIX_COLS; col++) {
+            int change_row = (t + col) % MATRIX_ROWS;
+            state->chars[col][change_row] = (uint8_t)('0' + ((t + col) % 10));
+        }
+    }
+}
+
+void animation_step(AnimationState *anim, DisplayMode mode) {
+    const ModeDescriptor *desc = mode_descriptor(mode);
+    if (desc->step) {
+        desc->step(anim);
+    }
+}
+
+int animation_mode_fps(DisplayMode mode) {
+    return mode_descriptor(mode)->fps;
+}
+
+bool animation_is_active(const AnimationState *anim, DisplayMode mode, bool running) {
+    const ModeDescriptor *desc = mode_descriptor(mode);
+    return desc->next_change && desc->next_change(anim, running) > 0;
+}
+
+bool animation_advance(AnimationState *anim, DisplayMode mode, uint32_t elapsed_ms) {
+    int fps = animation_mode_fps(mode);
+    if (fps <= 0) return false;
+
+    AnimClock *clock = &anim->clock;
+    clock->accumulator_ms += elapsed_ms;
+    uint32_t steps = clock->accumulator_ms / ANIM_STEP_MS;
+    if (steps > ANIM_MAX_CATCHUP_STEPS) {
+        steps = ANIM_MAX_CATCHUP_STEPS;
+        clock->accumulator_ms %= ANIM_STEP_MS;
+    } else {
+        clock->accumulator_ms -= steps * ANIM_STEP_MS;
+    }
+    for (uint32_t i = 0; i < steps; i++) {
+        animation_step(anim, mode);
+    }
+    clock->steps += steps;
+
+    uint32_t frame_interval = 1000 / (uint32_t)fps;
+    clock->frame_ms += elapsed_ms;
+    if (clock->frame_ms < frame_interval) return false;
+
+    clock->frame_ms -= frame_interval;
+    if (clock->frame_ms >= frame_interval) clock->frame_ms = 0;
+    return true;
+}
+
+// =============================================================================
+// Interpolated Rendering
+// =============================================================================
+
+int animation_alpha(const AnimationState *anim) {
+    return (int)(anim->clock.accumulator_ms * ANIM_ALPHA_ONE / ANIM_STEP_MS);
+}
+
+int animation_matrix_drop_row(const MatrixState *state, int col, int alpha) {
+    int from = state->prev_drops[col];
+    int to = state->drops[col];
+    if (to < from) to += MATRIX_DROP_PERIOD;
+
+    int pos = from + ((to - from) * alpha) / ANIM_ALPHA_ONE;
+    return (pos % MATRIX_DROP_PERIOD) / MATRIX_SUBROWS;
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "timer_state.h"
+#include "sand.h"
+#include "water.h"
+
+// =============================================================================
+// Animation Engine - Fixed-Timestep Simulations (No SDK Dependencies)
+// =============================================================================
+// Animated modes keep their simulation state here. Time is banked into a
+// fixed ANIM_STEP_MS step, so the state after any sequence of elapsed times
+// depends only on the number of whole steps taken, never on when frames were
+// drawn. Drawing only reads the state; it interpolates between the last two
+// steps by animation_alpha().
+//
+// The SDK layer (pebble-timer.c) feeds wall-clock time in from an Animation
+// while animation_is_active() holds and redraws whenever a frame is due at
+// the mode's rate.
+
+#define ANIM_STEP_MS 50
+#define ANIM_STEPS_PER_SECOND (1000 / ANIM_STEP_MS)
+#define ANIM_ALPHA_ONE 256
+
+// After a stall (e.g. a notification), drop the backlog instead of fast-forwarding
+#define ANIM_MAX_CATCHUP_STEPS 10
+
+typedef struct {
+    uint32_t accumulator_ms;  // Time banked toward the next step
+    uint32_t frame_ms;        // Time since the last frame was due
+    uint32_t steps;           // Steps taken; tells frames apart (frame_cache.h)
+} AnimClock;
+
+// =============================================================================
+// Hourglass Animation State
+// =============================================================================
+
+// The glass is a falling-sand grid (sand.h); the countdown sets how many
+// grains have been released through the neck
+typedef struct {
+    SandGrid sand;
+} HourglassState;
+
+// =============================================================================
+// Water Level Animation State
+// =============================================================================
+
+// The surface sloshes with the wrist's tilt (water.h); it moves whenever it
+// isn't still, running or not, and the level itself follows the countdown
+typedef struct {
+    WaterSurface surface;
+} WaterState;
+
+// =============================================================================
+// Matrix Rain Animation State
+// =============================================================================
+
+#define MATRIX_COLS 12
+#define MATRIX_ROWS 10
+
+// Drop heads move in 1/MATRIX_SUBROWS of a row and wrap after a short gap
+#define MATRIX_SUBROWS ANIM_STEPS_PER_SECOND
+#define MATRIX_DROP_PERIOD ((MATRIX_ROWS + 5) * MATRIX_SUBROWS)
+
+typedef struct {
+    int16_t drops[MATRIX_COLS];       // Head position in subrows
+    int16_t prev_drops[MATRIX_COLS];  // Positions one step earlier, for interpolation
+    uint8_t chars[MATRIX_COLS][MATRIX_ROWS];
+    uint8_t speeds[MATRIX_COLS];      // Rows per second
+    uint32_t steps;                   // Steps since init; drives glyph changes
+} MatrixState;
+
+// =============================================================================
+// Animation State Container
+// =============================================================================
+
+// Only the mode on screen animates, so the mode states share one block sized
+// to the largest. The registry's activate hook (mode_registry.h) starts the
+// incoming mode's state over whenever the mode changes; reading another
+// mode's member reads garbage.
+typedef struct {
+    AnimClock clock;
+    union {
+        HourglassState hourglass;
+        WaterState water;
+        MatrixState matrix;
+    };
+} AnimationState;
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+void animation_init_hourglass(HourglassState *state);
+void animation_init_water(WaterState *state);
+void animation_init_matrix(MatrixState *state, int seed);
+
+// Forget banked time; call when frames start flowing again
+void animation_reset_clock(AnimationState *anim);
+
+// =============================================================================
+// Simulation
+// =============================================================================
+
+// Set how much sand should have passed the neck; called once per tick
+void animation_sync_hourglass(HourglassState *state, int remaining_seconds, int total_seconds);
+
+// Advance one fixed step
+void animation_step_hourglass(HourglassState *state);
+void animation_step_water(WaterState *state);
+void animation_step_matrix(MatrixState *state);
+void animation_step(AnimationState *anim, DisplayMode mode);
+
+// Target frame rate for a mode, or 0 if it has nothing that moves between ticks
+int animation_mode_fps(DisplayMode mode);
+
+// True while the mode has something moving; frames stop entirely otherwise.
+// `running` is whether the countdown is; water sloshes regardless.
+bool animation_is_active(const AnimationState *anim, DisplayMode mode, bool running);
+
+// Bank `elapsed_ms`, run the whole steps it covers and return true when a
+// frame is due at the mode's target rate
+bool animation_advance(AnimationState *anim, DisplayMode mode, uint32_t elapsed_ms);
+
+// =============================================================================
+// Interpolated Rendering
+// =============================================================================
+
+// How far the clock is into the next step, 0 .. ANIM_ALPHA_ONE - 1
+int animation_alpha(const AnimationState *anim);
+
+// Row of a column's drop head at `alpha`, 0 .. MATRIX_ROWS + 4
+int animation_matrix_drop_row(const MatrixState *state, int col, int alpha);
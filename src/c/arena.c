@@ -0,0 +1,23 @@
+#include "arena.h"
+
+void arena_init(Arena *arena, void *buffer, size_t size) {
+    arena->base = buffer;
+    arena->size = buffer ? size : 0;
+    arena->used = 0;
+    arena->peak = 0;
+}
+
+void *arena_alloc(Arena *arena, size_t size) {
+    size_t start = (arena->used + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if (start > arena->size || size > arena->size - start) return NULL;
+
+    arena->used = start + size;
+    if (arena->used > arena->peak) {
+        arena->peak = arena->used;
+    }
+    return arena->base + start;
+}
+
+void arena_reset(Arena *arena) {
+    arena->used = 0;
+}
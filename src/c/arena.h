@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// =============================================================================
+// Arena - Bump Allocator Over a Caller's Buffer (No SDK Dependencies)
+// =============================================================================
+// Allocations are carved off the front of one block and all freed at once by
+// arena_reset. The display layer keeps one for per-frame scratch, backed by
+// memory that only exists while the mode needing it is on screen.
+
+#define ARENA_ALIGN 4
+
+typedef struct {
+    uint8_t *base;
+    size_t size;
+    size_t used;
+    size_t peak;    // Most ever in use, for sizing
+} Arena;
+
+// Manage `size` bytes at `buffer`; a NULL buffer makes every allocation fail
+void arena_init(Arena *arena, void *buffer, size_t size);
+
+// ARENA_ALIGN-aligned, uninitialized; NULL if it doesn't fit
+void *arena_alloc(Arena *arena, size_t size);
+
+// Free everything allocated so far
+void arena_reset(Arena *arena);
@@ -28,8 +28,8 @@
 // =============================================================================
 // Visualization Palette
 // =============================================================================
-// Users can customize these per visualization. The defaults match the previous
-// hard-coded colors.
+// Users can customize these per visualization. The defaults are part of each
+// mode's entry in the display mode registry (display/display_modes.c).
 
 typedef struct {
     GColor background;  // Canvas background for the visualization
@@ -0,0 +1,97 @@
+#include "dashboard.h"
+
+void dashboard_init(Dashboard *dashboard) {
+    dashboard->count = 0;
+    dashboard->selected = 0;
+}
+
+bool dashboard_is_full(const Dashboard *dashboard) {
+    return dashboard->count >= DASHBOARD_MAX_TIMERS;
+}
+
+bool dashboard_is_running(const Dashboard *dashboard) {
+    for (int i = 0; i < dashboard->count; i++) {
+        if (dashboard->timers[i].remaining_seconds > 0) return true;
+    }
+    return false;
+}
+
+TimerEffects dashboard_park(Dashboard *dashboard, TimerContext *ctx) {
+    if (ctx->state != STATE_RUNNING || dashboard_is_full(dashboard)) {
+        return timer_effects_none();
+    }
+
+    dashboard->timers[dashboard->count++] = (DashboardTimer){
+        .display_mode = ctx->display_mode,
+        .remaining_seconds = ctx->remaining_seconds,
+        .total_seconds = ctx->total_seconds
+    };
+    TimerEffects effects = timer_cancel(ctx);
+    effects.vibrate_short = true;
+    return effects;
+}
+
+unsigned dashboard_tick(Dashboard *dashboard, bool *finished) {
+    unsigned changed = 0;
+    *finished = false;
+    for (int i = 0; i < dashboard->count; i++) {
+        DashboardTimer *timer = &dashboard->timers[i];
+        if (timer->remaining_seconds <= 0) continue;
+        timer->remaining_seconds--;
+        changed |= 1u << i;
+        if (timer->remaining_seconds == 0) {
+            *finished = true;
+        }
+    }
+    return changed;
+}
+
+void dashboard_select_next(Dashboard *dashboard) {
+    if (dashboard->count > 0) {
+        dashboard->selected = (dashboard->selected + 1) % dashboard->count;
+    }
+}
+
+void dashboard_select_previous(Dashboard *dashboard) {
+    if (dashboard->count > 0) {
+        dashboard->selected = (dashboard->selected + dashboard->count - 1) % dashboard->count;
+    }
+}
+
+TimerEffects dashboard_take(Dashboard *dashboard, TimerContext *ctx) {
+    TimerEffects effects = timer_effects_none();
+    if (dashboard->count == 0 || ctx->state != STATE_SELECT_PRESET) {
+        return effects;
+    }
+
+    DashboardTimer timer = dashboard->timers[dashboard->selected];
+    dashboard_remove(dashboard);
+    if (timer.remaining_seconds > 0) {
+        ctx->display_mode = timer.display_mode;
+        ctx->remaining_seconds = timer.remaining_seconds;
+        ctx->total_seconds = timer.total_seconds;
+        ctx->state = STATE_RUNNING;
+        effects.subscribe_tick_timer = true;
+        effects.update_display = true;
+        effects.activate_mode = true;
+    }
+    effects.pop_window = true;
+    return effects;
+}
+
+void dashboard_remove(Dashboard *dashboard) {
+    if (dashboard->count == 0) return;
+    for (int i = dashboard->selected; i < dashboard->count - 1; i++) {
+        dashboard->timers[i] = dashboard->timers[i + 1];
+    }
+    dashboard->count--;
+    if (dashboard->selected >= dashboard->count && dashboard->selected > 0) {
+        dashboard->selected--;
+    }
+}
+
+TimerEffects dashboard_tick_effects(const Dashboard *dashboard, const TimerContext *ctx) {
+    TimerEffects effects = timer_effects_none();
+    effects.unsubscribe_tick_timer = ctx->state != STATE_RUNNING && !dashboard_is_running(dashboard);
+    return effects;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdbool.h>
+#include "timer_state.h"
+
+// =============================================================================
+// Dashboard - Timers Kept Running in the Background (No SDK Dependencies)
+// =============================================================================
+// SELECT on a running timer parks it here and frees the main screen for
+// another. The dashboard screen shows every parked timer at once, each as a
+// tile drawn by its own display mode (display_emit_tile), and hands one back
+// to the main screen when picked. Like TimerContext, the actions report what
+// the SDK layer has to do as TimerEffects.
+
+#define DASHBOARD_MAX_TIMERS 4
+
+typedef struct {
+    DisplayMode display_mode;
+    int remaining_seconds;   // 0 once finished
+    int total_seconds;
+} DashboardTimer;
+
+typedef struct {
+    DashboardTimer timers[DASHBOARD_MAX_TIMERS];
+    int count;
+    int selected;
+} Dashboard;
+
+void dashboard_init(Dashboard *dashboard);
+
+bool dashboard_is_full(const Dashboard *dashboard);
+
+// True while any parked timer is still counting down
+bool dashboard_is_running(const Dashboard *dashboard);
+
+// Park the main timer if it is running and there is room, leaving the main
+// screen at preset selection
+TimerEffects dashboard_park(Dashboard *dashboard, TimerContext *ctx);
+
+// Count every running timer down a second. Returns a bitmask of the timers
+// that changed and sets *finished when one of them reached zero.
+unsigned dashboard_tick(Dashboard *dashboard, bool *finished);
+
+void dashboard_select_next(Dashboard *dashboard);
+void dashboard_select_previous(Dashboard *dashboard);
+
+// Hand the selected timer back to the main screen, which must be at preset
+// selection, and close the dashboard. A finished one is just removed.
+TimerEffects dashboard_take(Dashboard *dashboard, TimerContext *ctx);
+
+// Drop the selected timer
+void dashboard_remove(Dashboard *dashboard);
+
+// After a tick: unsubscribes once neither the main timer nor a parked one is
+// counting down (resuming or restarting the main timer subscribes again)
+TimerEffects dashboard_tick_effects(const Dashboard *dashboard, const TimerContext *ctx);
@@ -4,6 +4,19 @@
 #include "../timer_state.h"
 #include "../time_utils.h"
 #include "../colors.h"
+#include "../animation.h"
+#include "../arena.h"
+#include "../dashboard.h"
+#include "grid.h"
+#include "raster_surface.h"
+#include "glyph_atlas.h"
+#include "numeral_font.h"
+#include "display_list.h"
+#include "display_emit.h"
+#include "draw_batch.h"
+#include "frame_cache.h"
+#include "reflow.h"
+#include "thumbnail.h"
 
 // =============================================================================
 // Display Module Common Interface
@@ -19,7 +32,9 @@ typedef struct {
     int total_seconds;
     TimerState state;
     DisplayMode display_mode;
-    bool hide_time_text;  // Hide m:ss overlay on visualizations
+    int grid_density;     // GRID_DENSITY_* level for grid modes
+    bool full_redraw;     // false when the framebuffer still holds this mode's last frame
+    int anim_alpha;       // Progress into the next animation step, 0..ANIM_ALPHA_ONE
     const VisualizationColors *colors;  // Active palette for this mode
 } DisplayContext;
 
@@ -27,77 +42,202 @@ typedef struct {
 DisplayContext display_context_from_timer(const TimerContext *timer, const VisualizationColors *colors);
 
 // =============================================================================
-// Hourglass Animation State
+// Time Overlay Fonts
 // =============================================================================
 
-#define MAX_SAND_PARTICLES 48
+// Numeral font sizes, matching the system fonts they replace
+typedef enum {
+    NUMERAL_SIZE_SMALL,   // Gothic 18 Bold
+    NUMERAL_SIZE_MEDIUM,  // Gothic 24 Bold
+    NUMERAL_SIZE_LARGE,   // Bitham 34 Medium Numbers
+    NUMERAL_SIZE_COUNT
+} NumeralSize;
 
-typedef struct {
-    int sand_top[MAX_SAND_PARTICLES];
-    int sand_bottom[MAX_SAND_PARTICLES];
-    int num_sand_top;
-    int num_sand_bottom;
-} HourglassState;
+// Load the numeral font resources; call from window_load / window_unload
+void display_fonts_load(void);
+void display_fonts_unload(void);
 
 // =============================================================================
-// Matrix Rain Animation State
+// Time Overlay
 // =============================================================================
-
-#define MATRIX_COLS 12
-#define MATRIX_ROWS 10
+// The m:ss text is drawn by its own layer on top of the canvas, positioned
+// from the mode's layout, so the text and the visualization redraw
+// independently.
 
 typedef struct {
-    int drops[MATRIX_COLS];
-    int chars[MATRIX_COLS][MATRIX_ROWS];
-    int speeds[MATRIX_COLS];
-} MatrixState;
+    GRect frame;          // Layer frame, in canvas coordinates
+    NumeralSize size;
+    GColor color;
+    GColor background;
+    bool plate;           // On a rounded background plate (Matrix)
+    bool shown;           // False for modes without one, or when hidden
+} DisplayTimeOverlay;
+
+DisplayTimeOverlay display_time_overlay(GRect bounds, const TimerContext *timer, const VisualizationColors *palettes);
+
+// Draw from the overlay layer's update proc. Pass full_redraw = false only
+// when the framebuffer still holds the overlay's last text; then only the
+// glyph cells that changed are repainted.
+void display_draw_time_overlay(GContext *ctx, const DisplayTimeOverlay *overlay, int remaining_seconds,
+                               bool full_redraw);
+
+// True when changing or hiding the text needs a canvas frame with
+// reveal_overlay set (see display_draw): the art reaches under it, or it was
+// drawn with a system font. Otherwise the overlay updates on its own, except
+// that hiding it always needs the canvas.
+bool display_time_overlay_needs_canvas(void);
 
 // =============================================================================
-// Animation State Container
+// Mode Registry
 // =============================================================================
+// The drawing side of each display mode; see mode_registry.h for the rest.
+// Hooks a mode doesn't need are NULL.
 
 typedef struct {
-    HourglassState hourglass;
-    MatrixState matrix;
-} AnimationState;
+    VisualizationColors palette;   // Default palette
+    bool incremental;              // Can repaint just what changed since its last frame
+    uint16_t scratch_bytes;        // Frame scratch its draw needs
+
+    // Allocate and free the mode's caches. Only the mode on screen holds
+    // any, along with its frame scratch; activate returns false if they
+    // don't fit.
+    bool (*activate)(void);
+    void (*deactivate)(void);
+
+    void (*draw)(GContext *ctx, GRect bounds, const DisplayContext *dctx, const AnimationState *anim);
+
+    // Place the time overlay; without this hook the mode has none
+    void (*place_time)(GRect bounds, const DisplayContext *dctx, DisplayTimeOverlay *overlay);
+} DisplayModeOps;
+
+// The mode's entry; out-of-range modes get Text's
+const DisplayModeOps *display_mode_ops(DisplayMode mode);
+
+// Free the active mode's caches and the cached frame; call from window_unload
+void display_release(void);
 
 // =============================================================================
-// Animation Initialization
+// Vector Art
 // =============================================================================
+// The list modes' static outlines are draw command images (DisplayArt in
+// display_emit.h) everywhere but aplite, which has none and keeps drawing
+// them as lines.
 
-void animation_init_hourglass(HourglassState *state);
-void animation_init_matrix(MatrixState *state, int seed);
+#ifdef PBL_PLATFORM_APLITE
+  #define VECTOR_ART_ENABLED 0
+#else
+  #define VECTOR_ART_ENABLED 1
+#endif
 
 // =============================================================================
-// Animation Updates
+// Last Frame Cache
+// =============================================================================
+// A copy of the last composed frame (canvas and time overlay), so a render
+// the system forces while nothing has changed is one copy instead of a
+// redraw. It takes a framebuffer's worth of heap while the canvas is shown,
+// which aplite can't spare.
+
+#ifndef FRAME_CACHE_ENABLED
+  #ifdef PBL_PLATFORM_APLITE
+    #define FRAME_CACHE_ENABLED 0
+  #else
+    #define FRAME_CACHE_ENABLED 1
+  #endif
+#endif
+
+// Key for the canvas frame display_draw would draw now; callers mix in
+// whatever else is drawn over it (frame_key_add)
+FrameKey display_frame_key(GRect bounds, const TimerContext *timer, const AnimationState *anim,
+                           const VisualizationColors *palettes);
+
+// Copy the cached frame back if it was stored under `key`
+bool display_frame_restore(GContext *ctx, FrameKey key);
+
+// Keep the framebuffer as it stands under `key`; call from the last layer
+// to draw in a render
+void display_frame_store(GContext *ctx, FrameKey key);
+
 // =============================================================================
+// Mode Transitions
+// =============================================================================
+// Cycling modes wipes from the last frame of the outgoing mode to the first
+// of the incoming one. Both are snapshots (frame_cache.h), so the modes
+// aren't drawn during the wipe. Needs the frame cache and a second
+// framebuffer's worth of heap; without them the mode just changes.
+
+// The mode is about to change: keep the frame on screen as the outgoing
+// snapshot. False if there is none. Ends any transition under way.
+bool display_transition_begin(void);
+
+// How far the wipe has gone, 0..ANIMATION_NORMALIZED_MAX
+void display_transition_set_progress(int32_t progress);
+
+// Compose the wipe at its progress. False until the incoming frame has been
+// drawn and stored (display_frame_store), or if it couldn't be.
+bool display_transition_draw(GContext *ctx);
+
+// Drop the outgoing snapshot
+void display_transition_end(void);
+
+// =============================================================================
+// Unobstructed Area Reflow
+// =============================================================================
+// Modes are laid out for the area Timeline Quick View leaves uncovered.
+// While that area slides, the caller passes the bounds it slides to, and
+// list modes and the time overlay are moved from their layout at the start
+// to the one at the end (reflow.h). The other modes take the end layout at
+// once, as does a mode that comes on screen mid-slide.
+
+// The slide from `from` to `to` is starting
+void display_reflow_begin(GRect from, GRect to, const TimerContext *timer, const AnimationState *anim,
+                          const VisualizationColors *palettes);
+
+// How far it has gone, 0..ANIMATION_NORMALIZED_MAX
+void display_reflow_set_progress(int32_t progress);
+
+// It finished; frames are drawn for the end layout alone
+void display_reflow_end(void);
+
+// =============================================================================
+// Dashboard
+// =============================================================================
+// The parked timers (dashboard.h), one tile each (display_emit_tile). Pass
+// full_redraw = false only when the framebuffer still holds the last
+// dashboard frame; then only tiles whose timer or selection changed are
+// repainted. Its caches are separate from the main canvas's.
+
+void display_draw_dashboard(GContext *ctx, GRect bounds, const Dashboard *dashboard, const TimerContext *timer,
+                            const VisualizationColors *palettes, bool full_redraw);
 
-void animation_update_hourglass(HourglassState *state, int remaining_seconds, int total_seconds);
-void animation_update_matrix(MatrixState *state, int remaining_seconds);
+// Free the dashboard's caches; call from its window's unload
+void display_dashboard_release(void);
 
 // =============================================================================
-// Display Mode Draw Functions
+// Thumbnails
 // =============================================================================
+// The visualization menu's pictures of each mode (thumbnail.h), one slot per
+// DisplayMode. Every slot the atlas lacks is drawn into the framebuffer at
+// `bounds` and shrunk into it, so call this from a layer that something
+// opaque covers in the same render. Modes are drawn halfway through a timer
+// in their palette, grid modes at their density. Returns false if the
+// framebuffer or the memory to draw with wasn't there; slots left pending
+// stay so.
 
-void display_draw_blocks(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_vertical_blocks(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_clock(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_ring(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_hourglass(GContext *ctx, GRect bounds, const DisplayContext *dctx, HourglassState *anim);
-void display_draw_binary(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_radial(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_hex(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_matrix(GContext *ctx, GRect bounds, const DisplayContext *dctx, MatrixState *anim);
-void display_draw_water_level(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_spiral_out(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_spiral_in(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_percent(GContext *ctx, GRect bounds, const DisplayContext *dctx);
-void display_draw_percent_remaining(GContext *ctx, GRect bounds, const DisplayContext *dctx);
+bool display_render_thumbnails(GContext *ctx, GRect bounds, ThumbnailAtlas *atlas, const TimerContext *timer,
+                               const VisualizationColors *palettes);
 
 // =============================================================================
 // Master Draw Function
 // =============================================================================
 
-// Draw the appropriate display mode, handling animation state internally
-void display_draw(GContext *ctx, GRect bounds, const TimerContext *timer, AnimationState *anim, const VisualizationColors *palettes);
+// Draw the appropriate display mode. Animation state is only read, at the
+// interpolation point between its last two steps; see animation.h.
+// Pass full_redraw = false only when the framebuffer still holds the previous
+// frame; modes that support it then repaint just what changed.
+// With reveal_overlay set, the time overlay's text is about to change or go
+// away, and what lies beneath it is restored first.
+// Returns true if the frame painted over the overlay, which must then be
+// redrawn in full.
+bool display_draw(GContext *ctx, GRect bounds, const TimerContext *timer, const AnimationState *anim,
+                  const VisualizationColors *palettes, bool full_redraw, bool reveal_overlay);
 
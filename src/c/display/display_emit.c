@@ -0,0 +1,757 @@
+#include "display_emit.h"
+#include <stdio.h>
+#include "../time_utils.h"
+
+// =============================================================================
+// Shared Helpers
+// =============================================================================
+
+static int min_dimension(const DisplayInput *in) {
+    return (in->width < in->height) ? in->width : in->height;
+}
+
+// Angle for `degrees` clockwise from 12 o'clock
+static int32_t clock_angle(int degrees) {
+    return (int32_t)(degrees - 90) * DL_ANGLE_MAX / 360;
+}
+
+static int polar_x(int cx, int32_t angle, int r) {
+    return cx + (int)((dl_cos(angle) * r) / DL_TRIG_ONE);
+}
+
+static int polar_y(int cy, int32_t angle, int r) {
+    return cy + (int)((dl_sin(angle) * r) / DL_TRIG_ONE);
+}
+
+// Outline and cell size; see display_emit.h
+static int art_unit(const DisplayInput *in) {
+    return (in->width >= 200) ? 4 : 3;
+}
+
+// An image's area: the outline's extent plus room for its strokes
+#define ART_MARGIN 2
+
+static DlRect art_area(int x0, int y0, int x1, int y1) {
+    DlRect area = { (int16_t)(x0 - ART_MARGIN), (int16_t)(y0 - ART_MARGIN),
+                    (int16_t)(x1 - x0 + 2 * ART_MARGIN + 1), (int16_t)(y1 - y0 + 2 * ART_MARGIN + 1) };
+    return area;
+}
+
+// Height of a DL_FONT_NUMERAL_MEDIUM time slot
+#define TIME_SLOT_MEDIUM 30
+
+// Where art with the time under it, `height` tall in all, starts: at `top`
+// if that leaves it inside the area, else raised until it is
+static int fit_top(const DisplayInput *in, int top, int height) {
+    if (top + height > in->height) top = in->height - height;
+    return (top < 0) ? 0 : top;
+}
+
+static DisplayTimeSlot time_slot(DlFont font, int x, int y, int w, int h) {
+    DisplayTimeSlot slot = {
+        .rect = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h },
+        .font = font
+    };
+    return slot;
+}
+
+// =============================================================================
+// Clock Mode
+// =============================================================================
+
+static int clock_center_y(const DisplayInput *in) {
+    return in->height / 2 - 10;
+}
+
+static int clock_radius(const DisplayInput *in) {
+    return min_dimension(in) / 2 - 20;
+}
+
+void display_emit_clock(DisplayList *list, const DisplayInput *in) {
+    int center_x = in->width / 2;
+    int center_y = clock_center_y(in);
+    int radius = clock_radius(in);
+
+    if (in->vector_art && radius == in->width / 2 - 20) {
+        // The face as built for a full screen, whose width sets its radius.
+        // The hand, fan and dot stay inside the markers.
+        int hole = radius - 11;
+        DlRect hollow = { (int16_t)(center_x - hole), (int16_t)(center_y - hole),
+                          (int16_t)(2 * hole + 1), (int16_t)(2 * hole + 1) };
+        dl_image(list, DISPLAY_ART_CLOCK_FACE,
+                 art_area(center_x - radius, center_y - radius, center_x + radius, center_y + radius),
+                 DL_HOLLOW_ROUND, hollow, in->secondary);
+    } else {
+        // Clock face
+        dl_stroke_circle(list, center_x, center_y, radius, 2, in->secondary);
+
+        // Hour markers
+        for (int i = 0; i < 12; i++) {
+            int32_t angle = clock_angle(i * 360 / 12);
+            int inner_r = radius - 8;
+            int outer_r = radius - 3;
+            dl_line(list, polar_x(center_x, angle, inner_r), polar_y(center_y, angle, inner_r),
+                    polar_x(center_x, angle, outer_r), polar_y(center_y, angle, outer_r),
+                    (i % 3 == 0) ? 3 : 1, in->secondary);
+        }
+    }
+
+    // Progress fan: a filled sector, one segment per remaining minute-of-the-dial
+    if (in->remaining_seconds > 0 && in->total_seconds > 0) {
+        int segments = 60;
+        int filled_segments = (in->remaining_seconds * segments) / in->total_seconds;
+        int inner_r = radius / 3;
+        int outer_r = radius - 12;
+        dl_arc(list, center_x, center_y, outer_r, outer_r - inner_r, filled_segments * 360 / segments,
+               360 / segments, DL_ARC_SECTOR, 0, in->primary);
+    }
+
+    // Center dot
+    dl_fill_circle(list, center_x, center_y, 5, in->secondary);
+
+    // Clock hand
+    if (in->total_seconds > 0) {
+        int32_t hand_angle = -DL_ANGLE_MAX / 4;
+        if (in->remaining_seconds < in->total_seconds) {
+            int64_t elapsed = in->total_seconds - in->remaining_seconds;
+            hand_angle += (int32_t)((elapsed * DL_ANGLE_MAX) / in->total_seconds);
+        }
+        int hand_length = radius - 15;
+        dl_line(list, center_x, center_y, polar_x(center_x, hand_angle, hand_length),
+                polar_y(center_y, hand_angle, hand_length), 3, in->accent);
+    }
+}
+
+// Under the face
+static DisplayTimeSlot clock_time_slot(const DisplayInput *in) {
+    return time_slot(DL_FONT_NUMERAL_SMALL, in->width / 2 - 40, clock_center_y(in) + clock_radius(in) + 5, 80, 24);
+}
+
+// =============================================================================
+// Ring Mode
+// =============================================================================
+
+static int ring_center_y(const DisplayInput *in) {
+    return in->height / 2 - 5;
+}
+
+void display_emit_ring(DisplayList *list, const DisplayInput *in) {
+    int center_x = in->width / 2;
+    int center_y = ring_center_y(in);
+    int radius = min_dimension(in) / 2 - 15;
+    int band_half = 5;
+
+    // Background ring
+    dl_stroke_circle(list, center_x, center_y, radius, 12, in->secondary);
+
+    // Progress arc: a filled band centered on the ring
+    if (in->remaining_seconds > 0 && in->total_seconds > 0) {
+        int progress_degrees = progress_calculate_degrees(in->remaining_seconds, in->total_seconds);
+        dl_arc(list, center_x, center_y, radius + band_half, 2 * band_half, progress_degrees, 0,
+               DL_ARC_BAND, 0, in->primary);
+    }
+}
+
+// Inside the ring
+static DisplayTimeSlot ring_time_slot(const DisplayInput *in) {
+    return time_slot(DL_FONT_NUMERAL_LARGE, 0, ring_center_y(in) - 20, in->width, 44);
+}
+
+// =============================================================================
+// Hourglass Mode
+// =============================================================================
+
+// One grid row as a rect per run of grains. If that would leave fewer slots
+// than the `rows_after` rows still to come need, the row collapses to a
+// single span, which only overdraws its gaps.
+static void emit_sand_row(DisplayList *list, const DisplayInput *in, SandRow bits, int x0, int y, int cell,
+                          int rows_after) {
+    int runs = __builtin_popcount(bits & (SandRow)~(bits << 1));
+    if (list->count + runs + rows_after > DISPLAY_LIST_MAX) {
+        int first = __builtin_ctz(bits);
+        int last = 31 - __builtin_clz(bits);
+        dl_fill_rect(list, x0 + first * cell, y, (last - first + 1) * cell, cell, 0, in->primary);
+        return;
+    }
+
+    while (bits) {
+        int first = __builtin_ctz(bits);
+        int length = __builtin_ctz(~((unsigned)bits >> first));
+        dl_fill_rect(list, x0 + first * cell, y, length * cell, cell, 0, in->primary);
+        bits &= (SandRow)~(((1u << length) - 1) << first);
+    }
+}
+
+#define HOURGLASS_GLASS_HEIGHT 100   // At a 3 px unit
+#define HOURGLASS_TIME_GAP 5
+
+// Half the glass, so the neck is exactly in the middle
+static int hourglass_half_height(int unit) {
+    return HOURGLASS_GLASS_HEIGHT * unit / 3 / 2;
+}
+
+static int hourglass_stack_height(int unit) {
+    return 2 * hourglass_half_height(unit) + HOURGLASS_TIME_GAP + TIME_SLOT_MEDIUM;
+}
+
+// The usual unit, or the largest smaller one at which the glass and the time
+// under it fit the area's height. The sand's cells shrink with it.
+static int hourglass_unit(const DisplayInput *in) {
+    int unit = art_unit(in);
+    while (unit > 1 && hourglass_stack_height(unit) > in->height) unit--;
+    return unit;
+}
+
+// The neck: the area's middle, unless the time would then leave the area
+static int hourglass_middle(const DisplayInput *in, int unit) {
+    int half = hourglass_half_height(unit);
+    return fit_top(in, in->height / 2 - half, hourglass_stack_height(unit)) + half;
+}
+
+void display_emit_hourglass(DisplayList *list, const DisplayInput *in) {
+    int unit = hourglass_unit(in);
+    int center_x = in->width / 2;
+    int glass_width = 20 * unit;
+    int half_height = hourglass_half_height(unit);
+    int neck_width = 8 * unit / 3;
+
+    int middle = hourglass_middle(in, unit);
+    int top = middle - half_height;
+    int bottom = middle + half_height;
+    int left = center_x - glass_width / 2;
+    int right = center_x + glass_width / 2;
+
+    // The image is built at the usual unit only
+    if (in->vector_art && unit == art_unit(in)) {
+        DlRect area = art_area(left, top, right, bottom);
+        dl_image(list, DISPLAY_ART_HOURGLASS, area, DL_HOLLOW_NONE, area, in->secondary);
+    } else {
+        // Top triangle
+        dl_line(list, left, top, center_x - neck_width / 2, middle, 2, in->secondary);
+        dl_line(list, right, top, center_x + neck_width / 2, middle, 2, in->secondary);
+        dl_line(list, left, top, right, top, 2, in->secondary);
+
+        // Bottom triangle
+        dl_line(list, center_x - neck_width / 2, middle, left, bottom, 2, in->secondary);
+        dl_line(list, center_x + neck_width / 2, middle, right, bottom, 2, in->secondary);
+        dl_line(list, left, bottom, right, bottom, 2, in->secondary);
+    }
+
+    // Sand grid, one unit per cell, its middle column under the neck
+    if (in->sand) {
+        int x0 = center_x - SAND_COLS * unit / 2;
+        int y0 = middle - SAND_CHAMBER_ROWS * unit;
+        int rows_left = 0;
+        for (int row = 0; row < SAND_ROWS; row++) {
+            if (in->sand[row]) rows_left++;
+        }
+        for (int row = 0; row < SAND_ROWS; row++) {
+            if (in->sand[row]) {
+                emit_sand_row(list, in, in->sand[row], x0, y0 + row * unit, unit, --rows_left);
+            }
+        }
+    }
+}
+
+// Under the base
+static DisplayTimeSlot hourglass_time_slot(const DisplayInput *in) {
+    int unit = hourglass_unit(in);
+    int bottom = hourglass_middle(in, unit) + hourglass_half_height(unit);
+    return time_slot(DL_FONT_NUMERAL_MEDIUM, 0, bottom + HOURGLASS_TIME_GAP, in->width, TIME_SLOT_MEDIUM);
+}
+
+// =============================================================================
+// Binary Mode
+// =============================================================================
+
+#define BINARY_BITS 6
+#define BINARY_DOT_RADIUS 8
+#define BINARY_DOT_SPACING 21
+#define BINARY_LABEL_X 4
+#define BINARY_LABEL_W 12
+#define BINARY_TOP 25
+#define BINARY_ROW_SPACING 30       // At most
+#define BINARY_ROW_SPACING_MIN 20   // Dots a pixel apart
+#define BINARY_LAST_ROW_HEIGHT 41   // From the last row's top to under the bit labels
+#define BINARY_TIME_GAP 2
+
+// Rows as far apart as the usual spacing, or as leaves room for the time
+// under the bit labels
+static int binary_row_spacing(const DisplayInput *in) {
+    int spacing = (in->height - BINARY_LAST_ROW_HEIGHT - BINARY_TIME_GAP - TIME_SLOT_MEDIUM) / 2;
+    if (spacing > BINARY_ROW_SPACING) return BINARY_ROW_SPACING;
+    return (spacing < BINARY_ROW_SPACING_MIN) ? BINARY_ROW_SPACING_MIN : spacing;
+}
+
+static int binary_art_height(int spacing) {
+    return 2 * spacing + BINARY_LAST_ROW_HEIGHT;
+}
+
+static int binary_top(const DisplayInput *in, int spacing) {
+    return fit_top(in, BINARY_TOP, binary_art_height(spacing) + BINARY_TIME_GAP + TIME_SLOT_MEDIUM);
+}
+
+// Dots are centered unless that would run the leftmost into the row labels
+// (stroke included), in which case they shift right just enough to clear them
+static int binary_dot_x(const DisplayInput *in, int bit) {
+    int reach = 3 * BINARY_DOT_SPACING - BINARY_DOT_SPACING / 2 + BINARY_DOT_RADIUS + 2;
+    int center = in->width / 2;
+    if (center < BINARY_LABEL_X + BINARY_LABEL_W + reach) {
+        center = BINARY_LABEL_X + BINARY_LABEL_W + reach;
+    }
+    return center - 3 * BINARY_DOT_SPACING + (BINARY_BITS - 1 - bit) * BINARY_DOT_SPACING + BINARY_DOT_SPACING / 2;
+}
+
+// Each dot is its own primitive, clear of its neighbours and the labels
+// below, so a tick's plan issues one call per flipped bit and the labels are
+// never redrawn
+void display_emit_binary(DisplayList *list, const DisplayInput *in) {
+    TimeComponents t = time_decompose(in->remaining_seconds);
+    int values[3] = { t.hours, t.minutes, t.seconds };
+    static const char *const labels[3] = { "H", "M", "S" };
+    static const char *const bit_labels[BINARY_BITS] = { "1", "2", "4", "8", "16", "32" };
+
+    int row_spacing = binary_row_spacing(in);
+    int start_y = binary_top(in, row_spacing);
+
+    for (int row = 0; row < 3; row++) {
+        int y = start_y + row * row_spacing;
+        dl_text(list, labels[row], DL_FONT_GOTHIC_14, BINARY_LABEL_X, y, BINARY_LABEL_W, 20, DL_ALIGN_LEFT,
+                in->hint);
+
+        for (int bit = BINARY_BITS - 1; bit >= 0; bit--) {
+            int x = binary_dot_x(in, bit);
+            if ((values[row] >> bit) & 1) {
+                dl_fill_circle(list, x, y + 10, BINARY_DOT_RADIUS, in->primary);
+            } else {
+                dl_stroke_circle(list, x, y + 10, BINARY_DOT_RADIUS, 2, in->secondary);
+            }
+        }
+    }
+
+    // Bit labels
+    int sec_y = start_y + row_spacing * 2;
+    for (int bit = BINARY_BITS - 1; bit >= 0; bit--) {
+        dl_text(list, bit_labels[bit], DL_FONT_GOTHIC_14, binary_dot_x(in, bit) - 8, sec_y + 25,
+                20, 16, DL_ALIGN_CENTER, in->hint);
+    }
+}
+
+// Under the bit labels
+static DisplayTimeSlot binary_time_slot(const DisplayInput *in) {
+    int spacing = binary_row_spacing(in);
+    int y = binary_top(in, spacing) + binary_art_height(spacing) + BINARY_TIME_GAP;
+    return time_slot(DL_FONT_NUMERAL_MEDIUM, 0, y, in->width, TIME_SLOT_MEDIUM);
+}
+
+// =============================================================================
+// Radial Mode
+// =============================================================================
+
+// Each ring is one gauge, so a tick repaints just the ring whose value moved
+static void emit_radial_ring(DisplayList *list, const DisplayInput *in, int center_x, int center_y,
+                             int radius, int ring_width, int degrees, uint8_t color) {
+    dl_gauge(list, center_x, center_y, radius + ring_width / 2, ring_width, degrees, 1,
+             in->secondary, color);
+}
+
+static int radial_center_y(const DisplayInput *in) {
+    return in->height / 2 - 10;
+}
+
+void display_emit_radial(DisplayList *list, const DisplayInput *in) {
+    int center_x = in->width / 2;
+    int center_y = radial_center_y(in);
+    TimeComponents t = time_decompose(in->remaining_seconds);
+
+    int ring_width = 8;
+    int ring_gap = 4;
+    int outer_radius = min_dimension(in) / 2 - 20;
+
+    // Seconds (innermost), minutes, hours (outermost)
+    emit_radial_ring(list, in, center_x, center_y, outer_radius - 2 * (ring_width + ring_gap), ring_width,
+                     (t.seconds * 360) / 60, in->accent);
+    emit_radial_ring(list, in, center_x, center_y, outer_radius - (ring_width + ring_gap), ring_width,
+                     (t.minutes * 360) / 60, in->secondary);
+    emit_radial_ring(list, in, center_x, center_y, outer_radius, ring_width,
+                     (t.hours * 360) / 24, in->primary);
+
+    // Legend
+    int legend_y = in->height - 25;
+    dl_text(list, "H", DL_FONT_GOTHIC_14, center_x - 45, legend_y, 20, 16, DL_ALIGN_CENTER, in->primary);
+    dl_text(list, "M", DL_FONT_GOTHIC_14, center_x - 10, legend_y, 20, 16, DL_ALIGN_CENTER, in->secondary);
+    dl_text(list, "S", DL_FONT_GOTHIC_14, center_x + 25, legend_y, 20, 16, DL_ALIGN_CENTER, in->accent);
+}
+
+// Across the middle of the rings
+static DisplayTimeSlot radial_time_slot(const DisplayInput *in) {
+    return time_slot(DL_FONT_NUMERAL_MEDIUM, 0, radial_center_y(in) - 14, in->width, 30);
+}
+
+// =============================================================================
+// Hex Mode
+// =============================================================================
+
+void display_emit_hex(DisplayList *list, const DisplayInput *in) {
+    int center_y = in->height / 2;
+
+    char hex_buf[DL_TEXT_MAX];
+    time_format_hex(in->remaining_seconds, hex_buf, sizeof(hex_buf));
+    dl_text(list, hex_buf, DL_FONT_BITHAM_42_BOLD, 0, center_y - 30, in->width, 50,
+            DL_ALIGN_CENTER, in->primary);
+
+    dl_text(list, "0x", DL_FONT_GOTHIC_18_BOLD, 10, center_y - 50, 30, 24, DL_ALIGN_LEFT, in->secondary);
+
+    // Decimal equivalent
+    char dec_buf[DL_TEXT_MAX];
+    snprintf(dec_buf, sizeof(dec_buf), "= %d sec", in->remaining_seconds);
+    dl_text(list, dec_buf, DL_FONT_GOTHIC_18, 0, center_y + 25, in->width, 24, DL_ALIGN_CENTER, in->secondary);
+
+    // Progress bar
+    int bar_y = in->height - 30;
+    int bar_height = 10;
+    int bar_margin = 20;
+    int bar_width = in->width - bar_margin * 2;
+
+    dl_fill_rect(list, bar_margin, bar_y, bar_width, bar_height, 3, in->secondary);
+    if (in->total_seconds > 0) {
+        int progress_width = (in->remaining_seconds * bar_width) / in->total_seconds;
+        dl_fill_rect(list, bar_margin, bar_y, progress_width, bar_height, 3, in->primary);
+    }
+}
+
+// =============================================================================
+// Water Level Mode
+// =============================================================================
+
+#define WATER_CONTAINER_HEIGHT 100   // At a 3 px unit
+#define WATER_TIME_GAP 10
+
+// Above the rim, where nothing is drawn
+static int water_rim_offset(const DisplayInput *in) {
+    return 10 * art_unit(in) / 3;
+}
+
+// The usual height, or as much as leaves room for the time under it
+static int water_container_height(const DisplayInput *in) {
+    int height = WATER_CONTAINER_HEIGHT * art_unit(in) / 3;
+    int room = in->height - ART_MARGIN - WATER_TIME_GAP - TIME_SLOT_MEDIUM + water_rim_offset(in);
+    return (height < room) ? height : room;
+}
+
+// A little above the middle, unless the time would then leave the area
+static int water_container_bottom(const DisplayInput *in) {
+    int height = water_container_height(in);
+    int bottom = in->height / 2 - 10 + height / 2;
+    int art = ART_MARGIN + height - water_rim_offset(in);
+    return fit_top(in, bottom - art, art + WATER_TIME_GAP + TIME_SLOT_MEDIUM) + art;
+}
+
+void display_emit_water_level(DisplayList *list, const DisplayInput *in) {
+    int unit = art_unit(in);
+    int center_x = in->width / 2;
+
+    int container_width = 50 * unit / 3;
+    int container_height = water_container_height(in);
+    int container_bottom = water_container_bottom(in);
+    int container_top = container_bottom - container_height;
+    int container_left = center_x - container_width / 2;
+    int container_right = center_x + container_width / 2;
+    int rim_y = container_top + water_rim_offset(in);
+    int rim_width = container_width + 8 * unit / 3;
+    int mark_length = 5 * unit / 3;
+    int scale_height = container_height - 20 * unit / 3;
+
+    // The images are built at the usual height only
+    bool images = in->vector_art && container_height == WATER_CONTAINER_HEIGHT * unit / 3;
+    if (images) {
+        // Glass and marks share one area, whose hollow inside the walls is
+        // where the water moves
+        int art_left = center_x - rim_width / 2;
+        if (container_left - mark_length < art_left) art_left = container_left - mark_length;
+        DlRect area = art_area(art_left, rim_y, center_x + rim_width / 2, container_bottom);
+        DlRect hollow = { (int16_t)(container_left + 2), (int16_t)(rim_y + 2),
+                          (int16_t)(container_right - container_left - 3), (int16_t)(container_bottom - rim_y - 3) };
+        dl_image(list, DISPLAY_ART_WATER_GLASS, area, DL_HOLLOW_BOX, hollow, in->secondary);
+        dl_image(list, DISPLAY_ART_WATER_MARKS, area, DL_HOLLOW_BOX, hollow, in->accent);
+    } else {
+        // Container outline
+        dl_line(list, container_left, rim_y, container_left, container_bottom, 2, in->secondary);
+        dl_line(list, container_right, rim_y, container_right, container_bottom, 2, in->secondary);
+        dl_line(list, container_left, container_bottom, container_right, container_bottom, 2, in->secondary);
+        dl_line(list, center_x - rim_width / 2, rim_y, center_x + rim_width / 2, rim_y, 2, in->secondary);
+    }
+
+    // Water: one vertical span per surface column, from its height down to
+    // the floor. The columns keep clear of the glass strokes, so a moving
+    // column never pulls the glass into its redraw.
+    int water_height = 0;
+    if (in->total_seconds > 0) {
+        water_height = (in->remaining_seconds * scale_height) / in->total_seconds;
+    }
+
+    if (water_height > 0) {
+        int water_top = container_bottom - water_height;
+        int floor_y = container_bottom - 2;
+        int water_left = center_x - WATER_COLUMNS * unit / 2;
+        for (int col = 0; col < WATER_COLUMNS; col++) {
+            int top = water_top - (in->water ? water_column_offset(in->water, col) : 0);
+            if (top < rim_y + 3) top = rim_y + 3;
+            dl_fill_rect(list, water_left + col * unit, top, unit, floor_y - top, 0, in->primary);
+        }
+    }
+
+    // Measurement marks
+    if (!images) {
+        for (int i = 1; i <= 4; i++) {
+            int mark_y = rim_y + (i * scale_height / 5);
+            dl_line(list, container_left - mark_length, mark_y, container_left, mark_y, 1, in->accent);
+        }
+    }
+}
+
+// Under the container
+static DisplayTimeSlot water_time_slot(const DisplayInput *in) {
+    return time_slot(DL_FONT_NUMERAL_MEDIUM, 0, water_container_bottom(in) + WATER_TIME_GAP, in->width,
+                     TIME_SLOT_MEDIUM);
+}
+
+// =============================================================================
+// Percent Modes
+// =============================================================================
+
+#define PERCENT_LABEL_HEIGHT 20
+#define PERCENT_NUMBER_HEIGHT 50
+#define PERCENT_BAR_HEIGHT 12
+#define PERCENT_GAP 10   // Above and below the bar, at most
+
+// The usual gaps around the bar, or as much as leaves room for the time
+static int percent_gap(const DisplayInput *in) {
+    int packed = PERCENT_LABEL_HEIGHT + PERCENT_NUMBER_HEIGHT + PERCENT_BAR_HEIGHT + TIME_SLOT_MEDIUM;
+    int gap = (in->height - packed) / 2;
+    if (gap > PERCENT_GAP) return PERCENT_GAP;
+    return (gap < 0) ? 0 : gap;
+}
+
+// Top of the label, with the number under it a little above the middle
+static int percent_top(const DisplayInput *in) {
+    int stack = PERCENT_LABEL_HEIGHT + PERCENT_NUMBER_HEIGHT + PERCENT_BAR_HEIGHT + TIME_SLOT_MEDIUM +
+                2 * percent_gap(in);
+    return fit_top(in, in->height / 2 - 55, stack);
+}
+
+static int percent_bar_y(const DisplayInput *in) {
+    return percent_top(in) + PERCENT_LABEL_HEIGHT + PERCENT_NUMBER_HEIGHT + percent_gap(in);
+}
+
+static void emit_percent(DisplayList *list, const DisplayInput *in, int percent_seconds, const char *label) {
+    int top = percent_top(in);
+
+    int percent = 0;
+    if (in->total_seconds > 0) {
+        percent = (percent_seconds * 100) / in->total_seconds;
+    }
+
+    char percent_buf[8];
+    snprintf(percent_buf, sizeof(percent_buf), "%d%%", percent);
+    dl_text(list, percent_buf, DL_FONT_BITHAM_42_BOLD, 0, top + PERCENT_LABEL_HEIGHT, in->width,
+            PERCENT_NUMBER_HEIGHT, DL_ALIGN_CENTER, in->primary);
+    dl_text(list, label, DL_FONT_GOTHIC_14, 0, top, in->width, PERCENT_LABEL_HEIGHT, DL_ALIGN_CENTER, in->primary);
+
+    // Progress bar
+    int bar_y = percent_bar_y(in);
+    int bar_height = PERCENT_BAR_HEIGHT;
+    int bar_margin = 20;
+    int bar_width = in->width - bar_margin * 2;
+
+    dl_fill_rect(list, bar_margin, bar_y, bar_width, bar_height, 4, in->secondary);
+    if (in->total_seconds > 0) {
+        int progress_width = (percent_seconds * bar_width) / in->total_seconds;
+        dl_fill_rect(list, bar_margin, bar_y, progress_width, bar_height, 4, in->primary);
+    }
+}
+
+void display_emit_percent(DisplayList *list, const DisplayInput *in) {
+    emit_percent(list, in, in->total_seconds - in->remaining_seconds, "elapsed");
+}
+
+void display_emit_percent_remaining(DisplayList *list, const DisplayInput *in) {
+    emit_percent(list, in, in->remaining_seconds, "remaining");
+}
+
+// Under the bar
+static DisplayTimeSlot percent_time_slot(const DisplayInput *in) {
+    return time_slot(DL_FONT_NUMERAL_MEDIUM, 0, percent_bar_y(in) + PERCENT_BAR_HEIGHT + percent_gap(in), in->width,
+                     TIME_SLOT_MEDIUM);
+}
+
+// =============================================================================
+// Dispatch
+// =============================================================================
+
+typedef void (*DisplayEmitter)(DisplayList *list, const DisplayInput *in);
+
+static DisplayEmitter emitter_for(DisplayMode mode) {
+    switch (mode) {
+        case DISPLAY_MODE_CLOCK:             return display_emit_clock;
+        case DISPLAY_MODE_RING:              return display_emit_ring;
+        case DISPLAY_MODE_HOURGLASS:         return display_emit_hourglass;
+        case DISPLAY_MODE_BINARY:            return display_emit_binary;
+        case DISPLAY_MODE_RADIAL:            return display_emit_radial;
+        case DISPLAY_MODE_HEX:               return display_emit_hex;
+        case DISPLAY_MODE_WATER_LEVEL:       return display_emit_water_level;
+        case DISPLAY_MODE_PERCENT:           return display_emit_percent;
+        case DISPLAY_MODE_PERCENT_REMAINING: return display_emit_percent_remaining;
+        default:                             return NULL;
+    }
+}
+
+bool display_emit_supports(DisplayMode mode) {
+    return emitter_for(mode) != NULL;
+}
+
+bool display_emit_time_slot(DisplayMode mode, const DisplayInput *in, DisplayTimeSlot *slot) {
+    switch (mode) {
+        case DISPLAY_MODE_CLOCK:             *slot = clock_time_slot(in); return true;
+        case DISPLAY_MODE_RING:              *slot = ring_time_slot(in); return true;
+        case DISPLAY_MODE_HOURGLASS:         *slot = hourglass_time_slot(in); return true;
+        case DISPLAY_MODE_BINARY:            *slot = binary_time_slot(in); return true;
+        case DISPLAY_MODE_RADIAL:            *slot = radial_time_slot(in); return true;
+        case DISPLAY_MODE_WATER_LEVEL:       *slot = water_time_slot(in); return true;
+        case DISPLAY_MODE_PERCENT:
+        case DISPLAY_MODE_PERCENT_REMAINING: *slot = percent_time_slot(in); return true;
+        default:                             return false;
+    }
+}
+
+bool display_emit(DisplayList *list, DisplayMode mode, const DisplayInput *in) {
+    display_list_reset(list);
+    DisplayEmitter emit = emitter_for(mode);
+    if (!emit) return false;
+    emit(list, in);
+    return true;
+}
+
+// =============================================================================
+// Dashboard Tiles
+// =============================================================================
+
+#define TILE_TEXT_HEIGHT 22   // Gothic 18 Bold
+
+void display_tile_layout(int count, int width, int height, DlRect *tiles) {
+    if (count <= 1) {
+        if (count == 1) tiles[0] = (DlRect){ 0, 0, (int16_t)width, (int16_t)height };
+        return;
+    }
+
+    int half_w = width / 2;
+    int half_h = height / 2;
+    for (int i = 0; i < count && i < DISPLAY_TILE_MAX; i++) {
+        int col = (count == 2) ? 0 : i % 2;
+        int row = (count == 2) ? i : i / 2;
+        int w = (count == 2) ? width : (col ? width - half_w : half_w);
+        int h = row ? height - half_h : half_h;
+        tiles[i] = (DlRect){ (int16_t)(col * half_w), (int16_t)(row * half_h), (int16_t)w, (int16_t)h };
+    }
+}
+
+static DlRect tile_inner(DlRect tile) {
+    DlRect inner = { (int16_t)(tile.x + DISPLAY_TILE_FRAME), (int16_t)(tile.y + DISPLAY_TILE_FRAME),
+                     (int16_t)(tile.w - 2 * DISPLAY_TILE_FRAME), (int16_t)(tile.h - 2 * DISPLAY_TILE_FRAME) };
+    return inner;
+}
+
+DlRect display_tile_art(DlRect tile) {
+    DlRect art = tile_inner(tile);
+    art.h = (int16_t)(art.h - TILE_TEXT_HEIGHT);
+    return art;
+}
+
+void display_tiles_forget(DisplayTileState *state, int tile) {
+    if (tile >= 0 && tile < DISPLAY_TILE_MAX) {
+        state->drawn &= (uint8_t)~(1u << tile);
+    }
+}
+
+unsigned display_tiles_to_draw(DisplayTileState *state, int count, const uint32_t *keys, bool full_redraw,
+                               bool *clear) {
+    if (count > DISPLAY_TILE_MAX) count = DISPLAY_TILE_MAX;
+
+    // A new layout starts from a clear screen; three tiles leave a quarter
+    *clear = full_redraw || count != state->count;
+    if (*clear) {
+        state->drawn = 0;
+        state->count = count;
+    }
+
+    unsigned draw = 0;
+    for (int i = 0; i < count; i++) {
+        if ((state->drawn & (1u << i)) && state->key[i] == keys[i]) continue;
+        state->key[i] = keys[i];
+        state->drawn |= (uint8_t)(1u << i);
+        draw |= 1u << i;
+    }
+    return draw;
+}
+
+static void emit_tile_time(DisplayList *list, const DisplayInput *in, DlRect inner, int y) {
+    char time_buf[DL_TEXT_MAX];
+    time_format_adaptive(in->remaining_seconds, time_buf, sizeof(time_buf));
+    dl_text(list, time_buf, DL_FONT_GOTHIC_18_BOLD, inner.x, y, inner.w, TILE_TEXT_HEIGHT,
+            DL_ALIGN_CENTER, in->primary);
+}
+
+void display_emit_tile(DisplayList *list, DisplayMode mode, const DisplayInput *in, DlRect tile, bool selected) {
+    DlRect inner = tile_inner(tile);
+    DlRect art = display_tile_art(tile);
+    DisplayInput plain = *in;
+    plain.vector_art = false;
+    in = &plain;
+
+    if (display_emit(list, mode, in)) {
+        // The whole screen's layout, shrunk to fit and centered
+        int num = art.w;
+        int den = in->width;
+        if (art.h * in->width < art.w * in->height) {
+            num = art.h;
+            den = in->height;
+        }
+        int dx = art.x + (art.w - in->width * num / den) / 2;
+        int dy = art.y + (art.h - in->height * num / den) / 2;
+        display_list_scale(list, num, den, dx, dy);
+
+        // Labels are too small to read here, and widened to fit their font
+        // they would overlap the art and redraw with it. Other text mustn't
+        // leave the art area.
+        int kept = 0;
+        for (int i = 0; i < list->count; i++) {
+            DlPrim prim = list->prims[i];
+            if (prim.type == DL_TEXT) {
+                if (prim.font == DL_FONT_GOTHIC_14) continue;
+                if (prim.rect.w > art.w) prim.rect.w = art.w;
+                if (prim.rect.x < art.x) prim.rect.x = art.x;
+                if (prim.rect.x + prim.rect.w > art.x + art.w) {
+                    prim.rect.x = (int16_t)(art.x + art.w - prim.rect.w);
+                }
+            }
+            list->prims[kept++] = prim;
+        }
+        list->count = kept;
+    }
+
+    // Below the art, where a change doesn't reach it; Text and Matrix have
+    // nothing else to show
+    if (mode == DISPLAY_MODE_TEXT || mode == DISPLAY_MODE_MATRIX) {
+        emit_tile_time(list, in, inner, inner.y + (inner.h - TILE_TEXT_HEIGHT) / 2);
+    } else {
+        emit_tile_time(list, in, inner, art.y + art.h);
+    }
+
+    if (selected) {
+        int f = DISPLAY_TILE_FRAME;
+        dl_fill_rect(list, tile.x, tile.y, tile.w, f, 0, in->hint);
+        dl_fill_rect(list, tile.x, tile.y + tile.h - f, tile.w, f, 0, in->hint);
+        dl_fill_rect(list, tile.x, tile.y + f, f, tile.h - 2 * f, 0, in->hint);
+        dl_fill_rect(list, tile.x + tile.w - f, tile.y + f, f, tile.h - 2 * f, 0, in->hint);
+    }
+}
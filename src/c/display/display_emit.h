@@ -0,0 +1,129 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "../timer_state.h"
+#include "../sand.h"
+#include "../water.h"
+#include "display_list.h"
+
+// =============================================================================
+// Display Emitters - Mode Geometry as Display Lists (No SDK Dependencies)
+// =============================================================================
+// Each emitter turns the timer state into the primitives its mode draws, so
+// layout and geometry can be unit tested and benchmarked on the host. The
+// grid modes and Matrix keep their own diff-based renderers and have no
+// emitter.
+
+typedef struct {
+    int width;
+    int height;
+    int remaining_seconds;
+    int total_seconds;
+    bool running;
+    const SandRow *sand;  // Hourglass grid (SAND_ROWS rows), or NULL when empty
+    const WaterSurface *water;  // Water Level surface, or NULL for a flat one
+    uint8_t background;   // GColor8 ARGB palette
+    uint8_t primary;
+    uint8_t secondary;
+    uint8_t accent;
+    uint8_t hint;         // Labels
+    bool vector_art;      // Draw the static outlines as DisplayArt images
+} DisplayInput;
+
+void display_emit_clock(DisplayList *list, const DisplayInput *in);
+void display_emit_ring(DisplayList *list, const DisplayInput *in);
+void display_emit_hourglass(DisplayList *list, const DisplayInput *in);
+void display_emit_binary(DisplayList *list, const DisplayInput *in);
+void display_emit_radial(DisplayList *list, const DisplayInput *in);
+void display_emit_hex(DisplayList *list, const DisplayInput *in);
+void display_emit_water_level(DisplayList *list, const DisplayInput *in);
+void display_emit_percent(DisplayList *list, const DisplayInput *in);
+void display_emit_percent_remaining(DisplayList *list, const DisplayInput *in);
+
+// =============================================================================
+// Vector Art
+// =============================================================================
+// Where the platform has draw command images, the outlines that never change
+// (the hourglass glass, the water container and its marks, the clock face)
+// are emitted as one DL_IMAGE each, whose id is a DisplayArt. The images are
+// prebuilt for each screen size by tools/gen_art.py, which must lay them out
+// as the emitters below do. Outlines and cells are measured in a unit of
+// 3 px, or 4 px on emery's wider screen. An outline shrunk to leave room for
+// the time in a short area (Timeline Quick View) is drawn as lines instead.
+
+typedef enum {
+    DISPLAY_ART_HOURGLASS,
+    DISPLAY_ART_WATER_GLASS,
+    DISPLAY_ART_WATER_MARKS,   // In the accent color
+    DISPLAY_ART_CLOCK_FACE,
+    DISPLAY_ART_COUNT
+} DisplayArt;
+
+// =============================================================================
+// Time Overlay Slots
+// =============================================================================
+// The m:ss overlay is drawn by its own layer on top of the visualization
+// (display_modes.c), so it is not part of any list. Each mode says where it
+// goes: the box the text is centered in and the numeral size.
+
+typedef struct {
+    DlRect rect;
+    DlFont font;   // A DL_FONT_NUMERAL_* size
+} DisplayTimeSlot;
+
+// False for modes without an emitter and for Hex, which shows no overlay
+bool display_emit_time_slot(DisplayMode mode, const DisplayInput *in, DisplayTimeSlot *slot);
+
+// =============================================================================
+// Dispatch
+// =============================================================================
+
+// True for modes drawn through a display list
+bool display_emit_supports(DisplayMode mode);
+
+// Reset `list` and emit `mode`; returns false (leaving it empty) for modes
+// without an emitter
+bool display_emit(DisplayList *list, DisplayMode mode, const DisplayInput *in);
+
+// =============================================================================
+// Dashboard Tiles
+// =============================================================================
+// The dashboard (dashboard.h) shows several timers at once, each in a tile
+// of the screen. A tile is its mode emitted for the whole screen and scaled
+// down (display_list_scale) into the tile's art area, without vector art
+// or labels, with the time in a system font in a strip below. The strip keeps the time,
+// which changes every second, from damaging the art. Text and Matrix show
+// just the time; the grid modes leave the art area to the caller's grid
+// renderer.
+
+#define DISPLAY_TILE_MAX 4
+#define DISPLAY_TILE_FRAME 2   // Width of the selection frame, inside the tile
+
+// Split a width x height screen among `count` tiles: all of it for one,
+// halves one above the other for two, quarters for three or four
+void display_tile_layout(int count, int width, int height, DlRect *tiles);
+
+// Where a grid mode draws its cells in `tile`
+DlRect display_tile_art(DlRect tile);
+
+// Emit `mode` into `tile` from `in`, which describes the whole screen, with
+// a frame in the hint color if `selected`. Nothing leaves the tile.
+void display_emit_tile(DisplayList *list, DisplayMode mode, const DisplayInput *in, DlRect tile, bool selected);
+
+// What each tile last drew. The dashboard window leaves the framebuffer as
+// it was, so a tile showing what it showed before needn't be drawn again.
+typedef struct {
+    uint32_t key[DISPLAY_TILE_MAX];   // What it shows (a FrameKey)
+    uint8_t drawn;                    // Bit per tile the framebuffer holds
+    int count;                        // Tiles laid out for
+} DisplayTileState;
+
+// The framebuffer no longer holds the tile (its grid changed)
+void display_tiles_forget(DisplayTileState *state, int tile);
+
+// Which tiles, a bit each, to draw to show `keys`, recording them as drawn:
+// all of them when the system drew over the screen (`full_redraw`) or the
+// layout changed, which sets *clear, and otherwise those that changed
+unsigned display_tiles_to_draw(DisplayTileState *state, int count, const uint32_t *keys, bool full_redraw,
+                               bool *clear);
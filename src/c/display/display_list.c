@@ -0,0 +1,682 @@
+#include "display_list.h"
+#include <string.h>
+
+// =============================================================================
+// Emitting
+// =============================================================================
+
+void display_list_reset(DisplayList *list) {
+    list->count = 0;
+    list->overflow = false;
+}
+
+// Zeroed so padding and unused fields hash consistently
+static DlPrim *dl_push(DisplayList *list, DlType type, uint8_t color) {
+    if (list->count >= DISPLAY_LIST_MAX) {
+        list->overflow = true;
+        return NULL;
+    }
+    DlPrim *prim = &list->prims[list->count++];
+    memset(prim, 0, sizeof(*prim));
+    prim->type = (uint8_t)type;
+    prim->color = color;
+    return prim;
+}
+
+static DlRect dl_rect(int x, int y, int w, int h) {
+    DlRect rect = { (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h };
+    return rect;
+}
+
+void dl_fill_rect(DisplayList *list, int x, int y, int w, int h, int radius, uint8_t color) {
+    if (w <= 0 || h <= 0) return;
+    DlPrim *prim = dl_push(list, DL_FILL_RECT, color);
+    if (!prim) return;
+    prim->rect = dl_rect(x, y, w, h);
+    prim->a = (int16_t)radius;
+}
+
+void dl_fill_circle(DisplayList *list, int x, int y, int radius, uint8_t color) {
+    DlPrim *prim = dl_push(list, DL_FILL_CIRCLE, color);
+    if (!prim) return;
+    prim->rect = dl_rect(x, y, 0, 0);
+    prim->a = (int16_t)radius;
+}
+
+void dl_stroke_circle(DisplayList *list, int x, int y, int radius, int stroke, uint8_t color) {
+    DlPrim *prim = dl_push(list, DL_STROKE_CIRCLE, color);
+    if (!prim) return;
+    prim->rect = dl_rect(x, y, 0, 0);
+    prim->a = (int16_t)radius;
+    prim->b = (int16_t)stroke;
+}
+
+void dl_line(DisplayList *list, int x1, int y1, int x2, int y2, int stroke, uint8_t color) {
+    DlPrim *prim = dl_push(list, DL_LINE, color);
+    if (!prim) return;
+    prim->rect = dl_rect(x1, y1, 0, 0);
+    prim->a = (int16_t)x2;
+    prim->b = (int16_t)y2;
+    prim->c = (int16_t)stroke;
+}
+
+void dl_arc(DisplayList *list, int x, int y, int outer_radius, int thickness, int sweep_degrees,
+            int step_degrees, DlArcStyle style, int stroke, uint8_t color) {
+    if (sweep_degrees <= 0) return;
+    if (step_degrees <= 0 && style != DL_ARC_BAND) return;
+    DlPrim *prim = dl_push(list, DL_ARC, color);
+    if (!prim) return;
+    prim->rect = dl_rect(x, y, stroke, 0);
+    prim->a = (int16_t)outer_radius;
+    prim->b = (int16_t)thickness;
+    prim->c = (int16_t)sweep_degrees;
+    prim->d = (int16_t)step_degrees;
+    prim->flags = (uint8_t)style;
+}
+
+void dl_gauge(DisplayList *list, int x, int y, int outer_radius, int thickness, int sweep_degrees,
+              int inset, uint8_t track_color, uint8_t color) {
+    if (thickness <= 0) return;
+    DlPrim *prim = dl_push(list, DL_ARC, color);
+    if (!prim) return;
+    prim->rect = dl_rect(x, y, inset, 0);
+    prim->a = (int16_t)outer_radius;
+    prim->b = (int16_t)thickness;
+    prim->c = (int16_t)(sweep_degrees > 0 ? sweep_degrees : 0);
+    prim->d = track_color;
+    prim->flags = DL_ARC_BAND;
+}
+
+void dl_text(DisplayList *list, const char *text, DlFont font, int x, int y, int w, int h,
+             DlAlign align, uint8_t color) {
+    DlPrim *prim = dl_push(list, DL_TEXT, color);
+    if (!prim) return;
+    prim->rect = dl_rect(x, y, w, h);
+    prim->font = (uint8_t)font;
+    prim->flags = (uint8_t)align;
+    strncpy(prim->text, text, DL_TEXT_MAX - 1);
+}
+
+void dl_image(DisplayList *list, int image, DlRect area, DlHollow hollow, DlRect hollow_box, uint8_t color) {
+    DlPrim *prim = dl_push(list, DL_IMAGE, color);
+    if (!prim) return;
+    prim->rect = area;
+    prim->flags = (uint8_t)image;
+    if (hollow != DL_HOLLOW_NONE) {
+        prim->font = (uint8_t)hollow;
+        prim->a = hollow_box.x;
+        prim->b = hollow_box.y;
+        prim->c = hollow_box.w;
+        prim->d = hollow_box.h;
+    }
+}
+
+// =============================================================================
+// Scaling
+// =============================================================================
+
+// The font one size down, for text drawn at half the size or less
+static const uint8_t s_smaller_font[DL_FONT_COUNT] = {
+    [DL_FONT_GOTHIC_14]       = DL_FONT_GOTHIC_14,
+    [DL_FONT_GOTHIC_18]       = DL_FONT_GOTHIC_14,
+    [DL_FONT_GOTHIC_18_BOLD]  = DL_FONT_GOTHIC_14,
+    [DL_FONT_BITHAM_42_BOLD]  = DL_FONT_GOTHIC_18_BOLD,
+    [DL_FONT_NUMERAL_SMALL]   = DL_FONT_NUMERAL_SMALL,
+    [DL_FONT_NUMERAL_MEDIUM]  = DL_FONT_NUMERAL_SMALL,
+    [DL_FONT_NUMERAL_LARGE]   = DL_FONT_NUMERAL_MEDIUM,
+};
+
+// Height of one line in each font, below which a text box shows nothing
+static const uint8_t s_line_height[DL_FONT_COUNT] = {
+    [DL_FONT_GOTHIC_14]       = 16,
+    [DL_FONT_GOTHIC_18]       = 22,
+    [DL_FONT_GOTHIC_18_BOLD]  = 22,
+    [DL_FONT_BITHAM_42_BOLD]  = 50,
+};
+
+static int16_t scale_value(int v, int num, int den) {
+    return (int16_t)(v * num / den);
+}
+
+// Strokes and radii don't vanish
+static int16_t scale_width(int v, int num, int den) {
+    int scaled = v * num / den;
+    return (int16_t)((v > 0 && scaled < 1) ? 1 : scaled);
+}
+
+void display_list_scale(DisplayList *list, int num, int den, int dx, int dy) {
+    if (num <= 0 || den <= 0) return;
+    bool smaller = num * 2 <= den;
+
+    int kept = 0;
+    for (int i = 0; i < list->count; i++) {
+        DlPrim prim = list->prims[i];
+        if (prim.type == DL_IMAGE) continue;
+
+        prim.rect.x = (int16_t)(scale_value(prim.rect.x, num, den) + dx);
+        prim.rect.y = (int16_t)(scale_value(prim.rect.y, num, den) + dy);
+        switch (prim.type) {
+            case DL_FILL_RECT:
+                prim.rect.w = scale_width(prim.rect.w, num, den);
+                prim.rect.h = scale_width(prim.rect.h, num, den);
+                prim.a = scale_value(prim.a, num, den);
+                break;
+            case DL_FILL_CIRCLE:
+                prim.a = scale_width(prim.a, num, den);
+                break;
+            case DL_STROKE_CIRCLE:
+                prim.a = scale_width(prim.a, num, den);
+                prim.b = scale_width(prim.b, num, den);
+                break;
+            case DL_LINE:
+                prim.a = (int16_t)(scale_value(prim.a, num, den) + dx);
+                prim.b = (int16_t)(scale_value(prim.b, num, den) + dy);
+                prim.c = scale_width(prim.c, num, den);
+                break;
+            case DL_ARC:
+                // Sweep and step are angles; a band's d is its track color
+                prim.a = scale_width(prim.a, num, den);
+                prim.b = scale_width(prim.b, num, den);
+                prim.rect.w = (prim.flags == DL_ARC_BAND) ? scale_value(prim.rect.w, num, den)
+                                                          : scale_width(prim.rect.w, num, den);
+                break;
+            case DL_TEXT:
+                prim.rect.w = scale_width(prim.rect.w, num, den);
+                prim.rect.h = scale_width(prim.rect.h, num, den);
+                if (prim.font < DL_FONT_COUNT) {
+                    if (smaller) prim.font = s_smaller_font[prim.font];
+                    int line = s_line_height[prim.font];
+                    if (prim.rect.h < line) {
+                        prim.rect.y = (int16_t)(prim.rect.y - (line - prim.rect.h) / 2);
+                        prim.rect.h = (int16_t)line;
+                    }
+                    // Glyphs are about half a line wide; a box too narrow
+                    // for them would wrap the text out of sight
+                    int wide = (int)strlen(prim.text) * line / 2;
+                    if (prim.flags == DL_ALIGN_CENTER && prim.rect.w < wide) {
+                        prim.rect.x = (int16_t)(prim.rect.x - (wide - prim.rect.w) / 2);
+                        prim.rect.w = (int16_t)wide;
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+        list->prims[kept++] = prim;
+    }
+    list->count = kept;
+}
+
+// =============================================================================
+// Bounds
+// =============================================================================
+
+static bool rect_empty(DlRect r) {
+    return r.w <= 0 || r.h <= 0;
+}
+
+static bool rects_intersect(DlRect a, DlRect b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w &&
+           a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static DlRect square_around(int x, int y, int half) {
+    return dl_rect(x - half, y - half, 2 * half + 1, 2 * half + 1);
+}
+
+DlRect dl_prim_bounds(const DlPrim *prim) {
+    int x = prim->rect.x;
+    int y = prim->rect.y;
+
+    switch (prim->type) {
+        case DL_FILL_RECT:
+        case DL_TEXT:
+        case DL_IMAGE:
+            return prim->rect;
+        case DL_FILL_CIRCLE:
+            return square_around(x, y, prim->a + 1);
+        case DL_STROKE_CIRCLE:
+            return square_around(x, y, prim->a + prim->b / 2 + 1);
+        case DL_ARC:
+            return square_around(x, y, prim->a + prim->rect.w / 2 + 1);
+        case DL_LINE: {
+            // Strokes are centered on the line; one extra pixel covers antialiasing
+            int pad = prim->c / 2 + 1;
+            int x0 = (x < prim->a) ? x : prim->a;
+            int x1 = (x < prim->a) ? prim->a : x;
+            int y0 = (y < prim->b) ? y : prim->b;
+            int y1 = (y < prim->b) ? prim->b : y;
+            return dl_rect(x0 - pad, y0 - pad, x1 - x0 + 2 * pad + 1, y1 - y0 + 2 * pad + 1);
+        }
+        default:
+            return dl_rect(0, 0, 0, 0);
+    }
+}
+
+// Clamp helper for the nearest point of a span to a coordinate
+static int clamp_to_span(int v, int lo, int hi) {
+    return (v < lo) ? lo : (v > hi) ? hi : v;
+}
+
+// Does any pixel of `rect` lie within [inner, outer] of (x, y)?
+static bool annulus_touches(DlRect rect, int x, int y, int inner, int outer) {
+    int x1 = rect.x + rect.w - 1;
+    int y1 = rect.y + rect.h - 1;
+    int32_t nx = clamp_to_span(x, rect.x, x1) - x;
+    int32_t ny = clamp_to_span(y, rect.y, y1) - y;
+    if (nx * nx + ny * ny > (int32_t)outer * outer) return false;
+    if (inner <= 0) return true;
+
+    int32_t fx = (x - rect.x > x1 - x) ? rect.x - x : x1 - x;
+    int32_t fy = (y - rect.y > y1 - y) ? rect.y - y : y1 - y;
+    return fx * fx + fy * fy >= (int32_t)inner * inner;
+}
+
+// Does the segment (a, b) cross `rect` grown by `pad`? Bounds already overlap,
+// so it does unless all four corners lie strictly on one side of the line.
+static bool segment_touches(DlRect rect, int pad, int ax, int ay, int bx, int by) {
+    int32_t dx = bx - ax;
+    int32_t dy = by - ay;
+    int32_t x0 = rect.x - pad - ax;
+    int32_t y0 = rect.y - pad - ay;
+    int32_t x1 = rect.x + rect.w - 1 + pad - ax;
+    int32_t y1 = rect.y + rect.h - 1 + pad - ay;
+
+    int32_t c0 = dx * y0 - dy * x0;
+    int32_t c1 = dx * y0 - dy * x1;
+    int32_t c2 = dx * y1 - dy * x0;
+    int32_t c3 = dx * y1 - dy * x1;
+    bool all_above = c0 > 0 && c1 > 0 && c2 > 0 && c3 > 0;
+    bool all_below = c0 < 0 && c1 < 0 && c2 < 0 && c3 < 0;
+    return !all_above && !all_below;
+}
+
+// Radii a round primitive may touch around its center (x, y); false for
+// primitives that aren't round
+static bool radial_extent(const DlPrim *prim, int *inner, int *outer) {
+    switch (prim->type) {
+        case DL_FILL_CIRCLE:
+            *inner = 0;
+            *outer = prim->a + 1;
+            return true;
+        case DL_STROKE_CIRCLE: {
+            int half = prim->b / 2 + 1;
+            *inner = prim->a - half;
+            *outer = prim->a + half;
+            return true;
+        }
+        case DL_ARC: {
+            int pad = prim->rect.w / 2 + 1;
+            *inner = prim->a - prim->b - pad;
+            *outer = prim->a + pad;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+// Does `rect` lie wholly in an image's hollow?
+static bool in_hollow(const DlPrim *prim, DlRect rect) {
+    DlRect box = { prim->a, prim->b, prim->c, prim->d };
+    int x1 = rect.x + rect.w - 1;
+    int y1 = rect.y + rect.h - 1;
+    if (rect.x < box.x || rect.y < box.y || x1 >= box.x + box.w || y1 >= box.y + box.h) return false;
+    if (prim->font != DL_HOLLOW_ROUND) return true;
+
+    // Twice the coordinates, so the circle's center and radius stay whole
+    int32_t cx = 2 * box.x + box.w - 1;
+    int32_t cy = 2 * box.y + box.h - 1;
+    int32_t r = ((box.w < box.h) ? box.w : box.h) - 1;
+    int32_t fx = (cx - 2 * rect.x > 2 * x1 - cx) ? cx - 2 * rect.x : 2 * x1 - cx;
+    int32_t fy = (cy - 2 * rect.y > 2 * y1 - cy) ? cy - 2 * rect.y : 2 * y1 - cy;
+    return fx * fx + fy * fy <= r * r;
+}
+
+bool dl_prim_touches(const DlPrim *prim, DlRect rect) {
+    if (rect_empty(rect) || !rects_intersect(dl_prim_bounds(prim), rect)) return false;
+
+    int inner, outer;
+    if (radial_extent(prim, &inner, &outer)) {
+        return annulus_touches(rect, prim->rect.x, prim->rect.y, inner, outer);
+    }
+    if (prim->type == DL_LINE) {
+        return segment_touches(rect, prim->c / 2 + 1, prim->rect.x, prim->rect.y, prim->a, prim->b);
+    }
+    if (prim->type == DL_IMAGE && prim->font != DL_HOLLOW_NONE) {
+        return !in_hollow(prim, rect);
+    }
+    return true;
+}
+
+// May two primitives share a pixel? Exact for concentric round shapes (the
+// rings of a gauge), which each touch the other's bounding box
+bool display_list_touches(const DisplayList *list, DlRect rect) {
+    if (rect_empty(rect)) return false;
+    for (int i = 0; i < list->count; i++) {
+        if (dl_prim_touches(&list->prims[i], rect)) return true;
+    }
+    return false;
+}
+
+static bool prims_overlap(const DlPrim *a, DlRect a_bounds, const DlPrim *b, DlRect b_bounds) {
+    int a_inner, a_outer, b_inner, b_outer;
+    if (radial_extent(a, &a_inner, &a_outer) && radial_extent(b, &b_inner, &b_outer) &&
+        a->rect.x == b->rect.x && a->rect.y == b->rect.y) {
+        return a_inner <= b_outer && b_inner <= a_outer;
+    }
+    return dl_prim_touches(a, b_bounds) && dl_prim_touches(b, a_bounds);
+}
+
+bool dl_prims_overlap(const DlPrim *a, const DlPrim *b) {
+    return prims_overlap(a, dl_prim_bounds(a), b, dl_prim_bounds(b));
+}
+
+// =============================================================================
+// Trigonometry
+// =============================================================================
+
+// sin(i * 90deg / 64) in DL_TRIG_ONE units
+static const int32_t s_quarter_sine[65] = {
+        0,  1608,  3216,  4821,  6424,  8022,  9616, 11204, 12785, 14359, 15924,
+    17479, 19024, 20557, 22078, 23586, 25080, 26558, 28020, 29466, 30893, 32303,
+    33692, 35062, 36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190, 46341,
+    47464, 48559, 49624, 50660, 51665, 52639, 53581, 54491, 55368, 56212, 57022,
+    57798, 58538, 59244, 59914, 60547, 61145, 61705, 62228, 62714, 63162, 63572,
+    63944, 64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516, 65536
+};
+
+static int32_t quarter_sine(int32_t angle) {
+    // angle in [0, DL_ANGLE_MAX / 4]; table step is 256 angle units
+    int index = angle >> 8;
+    if (index >= 64) return s_quarter_sine[64];
+    int32_t frac = angle & 0xFF;
+    return s_quarter_sine[index] + (((s_quarter_sine[index + 1] - s_quarter_sine[index]) * frac) >> 8);
+}
+
+int32_t dl_sin(int32_t angle) {
+    angle &= DL_ANGLE_MAX - 1;
+    int32_t quarter = DL_ANGLE_MAX / 4;
+    if (angle < quarter) return quarter_sine(angle);
+    if (angle < 2 * quarter) return quarter_sine(2 * quarter - angle);
+    if (angle < 3 * quarter) return -quarter_sine(angle - 2 * quarter);
+    return -quarter_sine(DL_ANGLE_MAX - angle);
+}
+
+int32_t dl_cos(int32_t angle) {
+    return dl_sin(angle + DL_ANGLE_MAX / 4);
+}
+
+// =============================================================================
+// Sector Outlines
+// =============================================================================
+
+bool dl_sector_ring(DlPoint *points, int x, int y, int outer_radius, int inner_radius, int segments) {
+    if (segments <= 0 || segments > DL_SECTOR_SEGMENTS_MAX) return false;
+
+    for (int k = 0; k <= segments; k++) {
+        int32_t angle = (int32_t)k * DL_ANGLE_MAX / segments - DL_ANGLE_MAX / 4;
+        int32_t c = dl_cos(angle);
+        int32_t s = dl_sin(angle);
+        points[segments - k] = (DlPoint){
+            (int16_t)(x + c * inner_radius / DL_TRIG_ONE), (int16_t)(y + s * inner_radius / DL_TRIG_ONE)
+        };
+        points[segments + 1 + k] = (DlPoint){
+            (int16_t)(x + c * outer_radius / DL_TRIG_ONE), (int16_t)(y + s * outer_radius / DL_TRIG_ONE)
+        };
+    }
+    return true;
+}
+
+// =============================================================================
+// Frame Diffing
+// =============================================================================
+
+static uint32_t prim_hash(const DlPrim *prim) {
+    // FNV-1a over the whole (zero-padded) primitive
+    const uint8_t *bytes = (const uint8_t *)prim;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(*prim); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Primitives that cover the same pixels whatever their sweep and colors, and
+// so can be repainted over themselves: gauges, whose track fills the whole
+// annulus. Everything else hashes to 0 and is cleared before a redraw.
+static uint32_t prim_shape(const DlPrim *prim) {
+    if (prim->type != DL_ARC || prim->flags != DL_ARC_BAND || prim->d == 0) return 0;
+
+    DlPrim shape = *prim;
+    shape.color = 0;
+    shape.c = 0;
+    shape.d = 0;
+    uint32_t hash = prim_hash(&shape);
+    return hash ? hash : 1;
+}
+
+static DlRect rect_union(DlRect a, DlRect b) {
+    int x0 = (a.x < b.x) ? a.x : b.x;
+    int y0 = (a.y < b.y) ? a.y : b.y;
+    int x1 = (a.x + a.w > b.x + b.w) ? a.x + a.w : b.x + b.w;
+    int y1 = (a.y + a.h > b.y + b.h) ? a.y + a.h : b.y + b.h;
+    return dl_rect(x0, y0, x1 - x0, y1 - y0);
+}
+
+static DlRect rect_clip(DlRect r, int width, int height) {
+    int x0 = (r.x < 0) ? 0 : r.x;
+    int y0 = (r.y < 0) ? 0 : r.y;
+    int x1 = (r.x + r.w > width) ? width : r.x + r.w;
+    int y1 = (r.y + r.h > height) ? height : r.y + r.h;
+    if (x1 <= x0 || y1 <= y0) return dl_rect(0, 0, 0, 0);
+    return dl_rect(x0, y0, x1 - x0, y1 - y0);
+}
+
+static int32_t rect_area(DlRect r) {
+    return (int32_t)r.w * r.h;
+}
+
+static bool rect_contains(DlRect outer, DlRect inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.w <= outer.x + outer.w &&
+           inner.y + inner.h <= outer.y + outer.h;
+}
+
+// Add a rect to the damage set, merging into the cheapest existing rect when full
+static void damage_add(DisplayListPlan *plan, DlRect rect) {
+    if (rect_empty(rect)) return;
+
+    int kept = 0;
+    for (int i = 0; i < plan->damage_count; i++) {
+        if (rect_contains(plan->damage[i], rect)) return;
+        if (!rect_contains(rect, plan->damage[i])) plan->damage[kept++] = plan->damage[i];
+    }
+    plan->damage_count = kept;
+    if (plan->damage_count < DL_DAMAGE_MAX) {
+        plan->damage[plan->damage_count++] = rect;
+        return;
+    }
+
+    int best = 0;
+    int32_t best_growth = 0;
+    for (int i = 0; i < plan->damage_count; i++) {
+        int32_t growth = rect_area(rect_union(plan->damage[i], rect)) - rect_area(plan->damage[i]);
+        if (i == 0 || growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    plan->damage[best] = rect_union(plan->damage[best], rect);
+}
+
+static bool damage_hits(const DisplayListPlan *plan, const DlPrim *prim) {
+    for (int i = 0; i < plan->damage_count; i++) {
+        if (dl_prim_touches(prim, plan->damage[i])) return true;
+    }
+    return false;
+}
+
+static void plan_issue(DisplayListPlan *plan, int index) {
+    plan->issue[index >> 3] |= (uint8_t)(1u << (index & 7));
+}
+
+bool display_list_plan_issues(const DisplayListPlan *plan, int index) {
+    return (plan->issue[index >> 3] >> (index & 7)) & 1;
+}
+
+static void plan_repaint(DisplayListPlan *plan, int index) {
+    plan->repaint[index >> 3] |= (uint8_t)(1u << (index & 7));
+}
+
+bool display_list_plan_repaints(const DisplayListPlan *plan, int index) {
+    return (plan->repaint[index >> 3] >> (index & 7)) & 1;
+}
+
+// Issue a primitive whose pixels are dirty: repainted in place if its shape
+// allows, otherwise cleared along with everything else in its bounds
+static void plan_redraw(DisplayListPlan *plan, int index, uint32_t shape, DlRect bounds) {
+    plan_issue(plan, index);
+    if (shape) {
+        plan_repaint(plan, index);
+    } else {
+        damage_add(plan, bounds);
+    }
+}
+
+// Is primitive `index` stacked on a repaint, which would draw over it?
+static bool under_repaint(const DisplayListPlan *plan, const DisplayList *list, const DlRect *bounds,
+                          int index) {
+    for (int i = 0; i < index; i++) {
+        if (display_list_plan_repaints(plan, i) &&
+            prims_overlap(&list->prims[i], bounds[i], &list->prims[index], bounds[index])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void display_list_history_invalidate(DisplayListHistory *history) {
+    history->valid = false;
+    history->count = 0;
+    history->revealed = dl_rect(0, 0, 0, 0);
+}
+
+void display_list_history_reveal(DisplayListHistory *history, DlRect rect) {
+    if (rect_empty(rect)) return;
+    history->revealed = rect_empty(history->revealed) ? rect : rect_union(history->revealed, rect);
+}
+
+void display_list_plan(DisplayListHistory *history, const DisplayList *list, int width, int height,
+                       bool full_redraw, DisplayListPlan *plan) {
+    memset(plan, 0, sizeof(*plan));
+    plan->stats.primitives = list->count;
+
+    uint32_t hashes[DISPLAY_LIST_MAX];
+    uint32_t shapes[DISPLAY_LIST_MAX];
+    DlRect bounds[DISPLAY_LIST_MAX];
+    for (int i = 0; i < list->count; i++) {
+        hashes[i] = prim_hash(&list->prims[i]);
+        shapes[i] = prim_shape(&list->prims[i]);
+        bounds[i] = rect_clip(dl_prim_bounds(&list->prims[i]), width, height);
+    }
+
+    plan->full = full_redraw || !history->valid || list->overflow;
+
+    if (plan->full) {
+        for (int i = 0; i < list->count; i++) {
+            plan_issue(plan, i);
+        }
+        plan->stats.changed = list->count;
+        plan->damage[0] = dl_rect(0, 0, width, height);
+        plan->damage_count = 1;
+    } else {
+        // Match each primitive to the next unmatched identical one from last
+        // frame, looking a few entries ahead so a primitive added or dropped
+        // mid-list doesn't shift everything after it. Matches keep their
+        // order, so unchanged primitives still stack as they did. Damage:
+        // new bounds of unmatched primitives, old bounds of skipped ones. A
+        // primitive that only matches the shape of an old one (a gauge with
+        // a new sweep) covers the old pixels itself and is repainted.
+        int next_old = 0;
+        for (int i = 0; i < list->count; i++) {
+            int match = -1;
+            bool same = false;
+            for (int k = next_old; k < history->count && k < next_old + DL_MATCH_WINDOW; k++) {
+                if (history->hash[k] == hashes[i]) {
+                    match = k;
+                    same = true;
+                    break;
+                }
+                if (match < 0 && shapes[i] && history->shape[k] == shapes[i]) {
+                    match = k;
+                }
+            }
+
+            if (match < 0) {
+                damage_add(plan, bounds[i]);
+                plan_issue(plan, i);
+                plan->stats.changed++;
+                continue;
+            }
+            if (!same) {
+                plan_issue(plan, i);
+                plan_repaint(plan, i);
+                plan->stats.changed++;
+            }
+            for (; next_old < match; next_old++) {
+                damage_add(plan, history->bounds[next_old]);
+            }
+            next_old = match + 1;
+        }
+        for (; next_old < history->count; next_old++) {
+            damage_add(plan, history->bounds[next_old]);
+        }
+        damage_add(plan, rect_clip(history->revealed, width, height));
+
+        // Closure: anything overlapping the damage is cleared with it, so it
+        // must be redrawn, and its full extent joins the damage. Anything
+        // stacked on a repaint is drawn over, so it must be redrawn too.
+        bool grew = true;
+        while (grew) {
+            grew = false;
+            for (int i = 0; i < list->count; i++) {
+                if (display_list_plan_issues(plan, i) || rect_empty(bounds[i])) continue;
+                if (damage_hits(plan, &list->prims[i]) || under_repaint(plan, list, bounds, i)) {
+                    plan_redraw(plan, i, shapes[i], bounds[i]);
+                    grew = true;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < list->count; i++) {
+        if (display_list_plan_issues(plan, i)) {
+            plan->stats.draw_calls++;
+            plan->stats.repainted += display_list_plan_repaints(plan, i);
+            plan->stats.drawn_area += rect_area(bounds[i]);
+        }
+    }
+    for (int i = 0; i < plan->damage_count; i++) {
+        plan->stats.damaged_area += rect_area(plan->damage[i]);
+    }
+
+    // Overflowed lists aren't comparable next frame
+    memcpy(history->hash, hashes, sizeof(uint32_t) * list->count);
+    memcpy(history->shape, shapes, sizeof(uint32_t) * list->count);
+    memcpy(history->bounds, bounds, sizeof(DlRect) * list->count);
+    history->count = list->count;
+    history->revealed = dl_rect(0, 0, 0, 0);
+    history->valid = !list->overflow;
+}
+
+bool display_list_plan_touches(const DisplayListPlan *plan, const DisplayList *list, DlRect rect) {
+    if (rect_empty(rect)) return false;
+    for (int i = 0; i < plan->damage_count; i++) {
+        if (rects_intersect(plan->damage[i], rect)) return true;
+    }
+    for (int i = 0; i < list->count; i++) {
+        if (display_list_plan_issues(plan, i) && dl_prim_touches(&list->prims[i], rect)) return true;
+    }
+    return false;
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// =============================================================================
+// Display List - Retained Drawing Primitives (No SDK Dependencies)
+// =============================================================================
+// Modes emit a compact list of typed primitives into a fixed-size buffer
+// instead of calling graphics_* directly. Each frame's list is compared with
+// the previous frame's (by per-primitive hash), and a plan is built that
+// repaints only the damaged areas: changed primitives, plus every primitive
+// overlapping the damage (the closure), after the damage is cleared to the
+// background. The SDK executor lives in display_modes.c.
+
+#define DISPLAY_LIST_MAX 64
+#define DL_TEXT_MAX 16
+#define DL_DAMAGE_MAX 6
+#define DL_MATCH_WINDOW 8   // How far ahead diffing looks for a moved primitive
+
+// Angles use the Pebble convention: a full turn is DL_ANGLE_MAX, 0 is 3 o'clock
+#define DL_ANGLE_MAX 0x10000
+#define DL_TRIG_ONE 0x10000
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+} DlRect;
+
+typedef enum {
+    DL_FILL_RECT,      // rect = area, a = corner radius
+    DL_FILL_CIRCLE,    // (x, y) = center, a = radius
+    DL_STROKE_CIRCLE,  // (x, y) = center, a = radius, b = stroke width
+    DL_LINE,           // (x, y) -> (a, b), c = stroke width
+    DL_ARC,            // (x, y) = center, a = outer radius, b = band thickness,
+                       // c = sweep in degrees clockwise from 12 o'clock,
+                       // d = step in degrees, or for bands the track color
+                       // (0 = none), flags = DlArcStyle,
+                       // rect.w = stroke width (wedges) or sweep inset (bands)
+    DL_TEXT,           // rect = text box, font = DlFont, flags = DlAlign, text
+    DL_IMAGE           // rect = area, flags = image id (the caller's), font = DlHollow,
+                       // (a, b, c, d) = hollow box x, y, w, h
+} DlType;
+
+typedef enum {
+    DL_ARC_DOTS,       // Dots spanning the band every `step` degrees
+    DL_ARC_WEDGES,     // Outlined wedges from the inner to the outer radius
+    DL_ARC_SECTOR,     // One filled annulus sector, `step` degrees per segment
+    DL_ARC_BAND        // The exact annulus sector, filled by the arc primitive,
+                       // over a track filling the whole annulus if it has one
+} DlArcStyle;
+
+typedef enum {
+    DL_FONT_GOTHIC_14,
+    DL_FONT_GOTHIC_18,
+    DL_FONT_GOTHIC_18_BOLD,
+    DL_FONT_BITHAM_42_BOLD,
+    DL_FONT_NUMERAL_SMALL,   // Pre-rasterized numeral fonts (see numeral_font.h)
+    DL_FONT_NUMERAL_MEDIUM,
+    DL_FONT_NUMERAL_LARGE,
+    DL_FONT_COUNT
+} DlFont;
+
+// Art that leaves a hole in its area, so what is drawn there doesn't pull it
+// into a redraw: a box, or the circle inscribed in one
+typedef enum {
+    DL_HOLLOW_NONE,
+    DL_HOLLOW_BOX,
+    DL_HOLLOW_ROUND
+} DlHollow;
+
+typedef enum {
+    DL_ALIGN_LEFT,
+    DL_ALIGN_CENTER,
+    DL_ALIGN_RIGHT
+} DlAlign;
+
+typedef struct {
+    uint8_t type;    // DlType
+    uint8_t color;   // GColor8 ARGB
+    uint8_t font;    // DlFont (text only)
+    uint8_t flags;   // DlAlign, DlArcStyle or image id
+    DlRect rect;
+    int16_t a;
+    int16_t b;
+    int16_t c;
+    int16_t d;
+    char text[DL_TEXT_MAX];
+} DlPrim;
+
+typedef struct {
+    DlPrim prims[DISPLAY_LIST_MAX];
+    int count;
+    bool overflow;   // Primitives were dropped; the frame must be drawn in full
+} DisplayList;
+
+// =============================================================================
+// Emitting
+// =============================================================================
+
+void display_list_reset(DisplayList *list);
+
+void dl_fill_rect(DisplayList *list, int x, int y, int w, int h, int radius, uint8_t color);
+void dl_fill_circle(DisplayList *list, int x, int y, int radius, uint8_t color);
+void dl_stroke_circle(DisplayList *list, int x, int y, int radius, int stroke, uint8_t color);
+void dl_line(DisplayList *list, int x1, int y1, int x2, int y2, int stroke, uint8_t color);
+void dl_arc(DisplayList *list, int x, int y, int outer_radius, int thickness, int sweep_degrees,
+            int step_degrees, DlArcStyle style, int stroke, uint8_t color);
+// Progress gauge: a band whose track fills the whole annulus every frame, with
+// the sweep drawn `inset` pixels in from both edges. It covers the same
+// pixels whatever the sweep, so a new sweep is repainted in place.
+void dl_gauge(DisplayList *list, int x, int y, int outer_radius, int thickness, int sweep_degrees,
+              int inset, uint8_t track_color, uint8_t color);
+void dl_text(DisplayList *list, const char *text, DlFont font, int x, int y, int w, int h,
+             DlAlign align, uint8_t color);
+// A prebuilt image (the executor knows it by `image`) drawn with its origin
+// at the area's top left. It draws nothing inside `hollow_box` (or the circle
+// inscribed in it), nor anything outside the area.
+void dl_image(DisplayList *list, int image, DlRect area, DlHollow hollow, DlRect hollow_box, uint8_t color);
+
+// Scale every primitive by num / den about the origin and then move it by
+// (dx, dy), to show a list laid out for one area in a smaller one. Strokes
+// and radii stay at least a pixel, text at half the size or less takes the
+// next smaller font (its box kept big enough for a line), and images, which
+// can't be scaled, are dropped.
+void display_list_scale(DisplayList *list, int num, int den, int dx, int dy);
+
+// Screen-space area a primitive may touch (conservative)
+DlRect dl_prim_bounds(const DlPrim *prim);
+
+// True if the primitive may touch pixels inside `rect`. Tighter than a bounds
+// test for circles and arcs, whose bounding boxes are mostly empty.
+bool dl_prim_touches(const DlPrim *prim, DlRect rect);
+
+// True if any primitive of the list may touch pixels inside `rect`
+bool display_list_touches(const DisplayList *list, DlRect rect);
+
+// True if the two primitives may both touch some pixel, so the order they are
+// drawn in can matter
+bool dl_prims_overlap(const DlPrim *a, const DlPrim *b);
+
+// =============================================================================
+// Trigonometry (DL_TRIG_ONE fixed point, matching cos_lookup / sin_lookup)
+// =============================================================================
+
+int32_t dl_sin(int32_t angle);
+int32_t dl_cos(int32_t angle);
+
+// =============================================================================
+// Sector Outlines
+// =============================================================================
+// A DL_ARC_SECTOR is filled as a single polygon. The boundary points for a
+// whole turn of `segments` steps (clockwise from 12 o'clock) are laid out as
+// the inner ring reversed, then the outer ring:
+//
+//   points[segments - k]     = inner point at boundary k
+//   points[segments + 1 + k] = outer point at boundary k
+//
+// so the sector covering the first n segments is the contiguous run of
+// 2 * n + 2 points starting at points[segments - n]. As the sweep changes
+// only the run's ends move; the ring itself is computed once per geometry.
+
+#define DL_SECTOR_SEGMENTS_MAX 60
+#define DL_SECTOR_POINTS_MAX (2 * (DL_SECTOR_SEGMENTS_MAX + 1))
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+} DlPoint;
+
+// Fill 2 * (segments + 1) points; false if `segments` is out of range
+bool dl_sector_ring(DlPoint *points, int x, int y, int outer_radius, int inner_radius, int segments);
+
+// =============================================================================
+// Frame Diffing
+// =============================================================================
+
+// What was on screen last frame: one hash and bounds per primitive, plus a
+// hash of the pixels each covers for primitives that can be repainted in place
+// (0 for the rest)
+typedef struct {
+    uint32_t hash[DISPLAY_LIST_MAX];
+    uint32_t shape[DISPLAY_LIST_MAX];
+    DlRect bounds[DISPLAY_LIST_MAX];
+    DlRect revealed;   // Area to restore on the next frame (empty if none)
+    int count;
+    bool valid;
+} DisplayListHistory;
+
+typedef struct {
+    int primitives;      // Primitives in the frame
+    int changed;         // Primitives that differ from the previous frame
+    int draw_calls;      // Primitives issued (changed + closure)
+    int repainted;       // Issued primitives repainted in place, without a clear
+    int32_t damaged_area;  // Pixels cleared (screen area on full frames)
+    int32_t drawn_area;    // Sum of issued primitives' bounds; drawn / damaged = overdraw
+} DisplayListStats;
+
+typedef struct {
+    bool full;           // Repaint everything; the caller clears the screen
+    DlRect damage[DL_DAMAGE_MAX];
+    int damage_count;
+    uint8_t issue[(DISPLAY_LIST_MAX + 7) / 8];
+    uint8_t repaint[(DISPLAY_LIST_MAX + 7) / 8];   // Issued, but not under any damage
+    DisplayListStats stats;
+} DisplayListPlan;
+
+void display_list_history_invalidate(DisplayListHistory *history);
+
+// Something drawn over `rect` since the last frame has gone away (e.g. the time
+// overlay, which has its own layer): the next plan clears it and redraws
+// whatever the list has there
+void display_list_history_reveal(DisplayListHistory *history, DlRect rect);
+
+// Compare `list` with `history`, fill `plan`, and record `list` as the new history
+void display_list_plan(DisplayListHistory *history, const DisplayList *list, int width, int height,
+                       bool full_redraw, DisplayListPlan *plan);
+
+bool display_list_plan_issues(const DisplayListPlan *plan, int index);
+bool display_list_plan_repaints(const DisplayListPlan *plan, int index);
+
+// True if executing the plan may change any pixel inside `rect`
+bool display_list_plan_touches(const DisplayListPlan *plan, const DisplayList *list, DlRect rect);
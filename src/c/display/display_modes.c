@@ -10,607 +10,454 @@ DisplayContext display_context_from_timer(const TimerContext *timer, const Visua
         .total_seconds = timer->total_seconds,
         .state = timer->state,
         .display_mode = timer->display_mode,
-        .hide_time_text = timer->hide_time_text,
+        .grid_density = (timer->display_mode < DISPLAY_MODE_COUNT) ? timer->grid_density[timer->display_mode] : 0,
+        .full_redraw = true,
+        .anim_alpha = 0,
         .colors = colors
     };
     return dctx;
 }
 
 // =============================================================================
-// Animation Initialization
+// Numeral Fonts
 // =============================================================================
+// The m:ss overlay is blitted from pre-rasterized numeral fonts loaded once
+// at window load. System fonts remain the fallback when a resource is
+// missing or the framebuffer can't be captured.
 
-void animation_init_hourglass(HourglassState *state) {
-    state->num_sand_top = MAX_SAND_PARTICLES;
-    state->num_sand_bottom = 0;
-    
-    for (int i = 0; i < MAX_SAND_PARTICLES; i++) {
-        state->sand_top[i] = i / 8;
-    }
-}
+static const uint32_t s_numeral_resources[NUMERAL_SIZE_COUNT] = {
+    RESOURCE_ID_NUMERALS_18,
+    RESOURCE_ID_NUMERALS_24,
+    RESOURCE_ID_NUMERALS_34
+};
 
-void animation_init_matrix(MatrixState *state, int seed) {
-    for (int col = 0; col < MATRIX_COLS; col++) {
-        state->drops[col] = (col * 3 + seed) % MATRIX_ROWS;
-        state->speeds[col] = 1 + (col % 3);
-        
-        for (int row = 0; row < MATRIX_ROWS; row++) {
-            state->chars[col][row] = '0' + ((col + row * 7) % 10);
-        }
+static const char *const s_numeral_fallback_keys[NUMERAL_SIZE_COUNT] = {
+    FONT_KEY_GOTHIC_18_BOLD,
+    FONT_KEY_GOTHIC_24_BOLD,
+    FONT_KEY_BITHAM_34_MEDIUM_NUMBERS
+};
+
+static uint8_t *s_numeral_data[NUMERAL_SIZE_COUNT];
+static NumeralFont s_numeral_fonts[NUMERAL_SIZE_COUNT];
+static GFont s_fallback_fonts[NUMERAL_SIZE_COUNT];
+
+// What the time overlay last left on screen (see Time Overlay below): its
+// glyph cells, or with a system font, anywhere in its frame
+static NumeralText s_time_text;
+static bool s_time_text_system;
+static GRect s_time_frame;
+
+// Set up by display_draw for the canvas frame being drawn: where the overlay
+// is, whether the frame paints over it, and whether the art reaches under it
+static GRect s_time_extent;
+static bool s_time_exposed;
+static bool s_time_on_art;
+
+// System fonts for the display list modes below
+static const char *const s_list_font_keys[DL_FONT_NUMERAL_SMALL] = {
+    FONT_KEY_GOTHIC_14,
+    FONT_KEY_GOTHIC_18,
+    FONT_KEY_GOTHIC_18_BOLD,
+    FONT_KEY_BITHAM_42_BOLD
+};
+
+static GFont s_list_fonts[DL_FONT_NUMERAL_SMALL];
+
+void display_fonts_load(void) {
+    for (int i = 0; i < DL_FONT_NUMERAL_SMALL; i++) {
+        s_list_fonts[i] = fonts_get_system_font(s_list_font_keys[i]);
     }
-}
+    for (int i = 0; i < NUMERAL_SIZE_COUNT; i++) {
+        s_fallback_fonts[i] = fonts_get_system_font(s_numeral_fallback_keys[i]);
 
-// =============================================================================
-// Animation Updates
-// =============================================================================
+        ResHandle handle = resource_get_handle(s_numeral_resources[i]);
+        size_t size = resource_size(handle);
+        s_numeral_data[i] = malloc(size);
+        if (!s_numeral_data[i]) continue;
 
-void animation_update_hourglass(HourglassState *state, int remaining_seconds, int total_seconds) {
-    if (total_seconds <= 0) return;
-    
-    int elapsed = total_seconds - remaining_seconds;
-    int target_bottom = (elapsed * MAX_SAND_PARTICLES) / total_seconds;
-    
-    if (target_bottom > state->num_sand_bottom && state->num_sand_top > 0) {
-        state->num_sand_bottom = target_bottom;
-        state->num_sand_top = MAX_SAND_PARTICLES - state->num_sand_bottom;
+        resource_load(handle, s_numeral_data[i], size);
+        if (!numeral_font_init(&s_numeral_fonts[i], s_numeral_data[i], size)) {
+            free(s_numeral_data[i]);
+            s_numeral_data[i] = NULL;
+        }
     }
+    s_time_text.valid = false;
+    s_time_text_system = false;
 }
 
-void animation_update_matrix(MatrixState *state, int remaining_seconds) {
-    for (int col = 0; col < MATRIX_COLS; col++) {
-        state->drops[col] = (state->drops[col] + state->speeds[col]) % (MATRIX_ROWS + 5);
-        
-        int change_row = (remaining_seconds + col) % MATRIX_ROWS;
-        state->chars[col][change_row] = '0' + ((remaining_seconds + col) % 10);
+void display_fonts_unload(void) {
+    for (int i = 0; i < NUMERAL_SIZE_COUNT; i++) {
+        free(s_numeral_data[i]);
+        s_numeral_data[i] = NULL;
+        s_numeral_fonts[i].count = 0;
     }
+    s_time_text.valid = false;
+    s_time_text_system = false;
 }
 
 // =============================================================================
-// Helper: Draw Time Text at Position
+// Frame Scratch
 // =============================================================================
+// Per-frame temporaries too big for the stack come from here. The block is
+// allocated along with the active mode's caches, sized by its registry entry,
+// and reset at the start of every frame.
 
-static void draw_time_text(GContext *ctx, int remaining_seconds, GRect text_rect, GFont font) {
-    static char time_buf[16];
-    time_format_adaptive(remaining_seconds, time_buf, sizeof(time_buf));
-    graphics_context_set_text_color(ctx, COLOR_TEXT_NORMAL);
-    graphics_draw_text(ctx, time_buf, font, text_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-}
+static Arena s_scratch;
+static void *s_scratch_block;
 
 // =============================================================================
-// Blocks Mode
+// Unobstructed Area Reflow
 // =============================================================================
+// Set up by display_reflow_begin (after the registry) for the length of a
+// slide.
 
-#define BLOCK_COLS 12
-#define BLOCK_ROWS 8
-#define BLOCK_PADDING 2
+typedef struct {
+    DisplayMode mode;     // The mode it was set up for
+    int32_t progress;
+    GRect time_from;      // The time overlay's frame at either end
+    GRect time_to;
+    ListReflow list;      // Empty unless the mode was on screen and emits a list
+} DisplayReflow;
 
-void display_draw_blocks(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int available_width = bounds.size.w - 20;
-    int available_height = bounds.size.h - 60;
-    
-    int block_width = (available_width - (BLOCK_COLS - 1) * BLOCK_PADDING) / BLOCK_COLS;
-    int block_height = (available_height - (BLOCK_ROWS - 1) * BLOCK_PADDING) / BLOCK_ROWS;
-    int block_size = (block_width < block_height) ? block_width : block_height;
-    
-    int grid_width = BLOCK_COLS * block_size + (BLOCK_COLS - 1) * BLOCK_PADDING;
-    int grid_height = BLOCK_ROWS * block_size + (BLOCK_ROWS - 1) * BLOCK_PADDING;
-    int start_x = (bounds.size.w - grid_width) / 2;
-    int start_y = (bounds.size.h - grid_height) / 2 - 10;
-    
-    int total_blocks = BLOCK_COLS * BLOCK_ROWS;
-    int filled_blocks = progress_calculate_blocks(dctx->remaining_seconds, dctx->total_seconds, total_blocks);
-    
-    for (int row = 0; row < BLOCK_ROWS; row++) {
-        for (int col = 0; col < BLOCK_COLS; col++) {
-            int block_index = (BLOCK_ROWS - 1 - row) * BLOCK_COLS + (BLOCK_COLS - 1 - col);
-            int x = start_x + col * (block_size + BLOCK_PADDING);
-            int y = start_y + row * (block_size + BLOCK_PADDING);
-            GRect block_rect = GRect(x, y, block_size, block_size);
-            
-            if (block_index < filled_blocks) {
-                graphics_context_set_fill_color(ctx, c->primary);
-                graphics_fill_rect(ctx, block_rect, 2, GCornersAll);
-            } else {
-                graphics_context_set_stroke_color(ctx, c->secondary);
-                graphics_draw_round_rect(ctx, block_rect, 2);
-            }
-        }
-    }
-    
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect text_rect = GRect(0, start_y + grid_height + 5, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
-    }
+static DisplayReflow *s_reflow;
+
+static bool reflowing(DisplayMode mode) {
+    return s_reflow && s_reflow->mode == mode;
 }
 
 // =============================================================================
-// Vertical Blocks Mode
+// Monochrome Dither
 // =============================================================================
+// On 1-bit screens the raster fills draw the mode's palette as dither
+// patterns (raster.h), whose tiles are rendered again only when the palette
+// changes. Lines, circles and text still go through the SDK.
 
-#define VERTICAL_BLOCK_COLS 8
-#define VERTICAL_BLOCK_ROWS 12
-#define VERTICAL_BLOCK_PADDING 2
+#if RASTER_HAS_1BIT
+static RasterDither s_dither;
+#endif
 
-void display_draw_vertical_blocks(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int available_width = bounds.size.w - 20;
-    int available_height = bounds.size.h - 60;
-    
-    int block_width = (available_width - (VERTICAL_BLOCK_COLS - 1) * VERTICAL_BLOCK_PADDING) / VERTICAL_BLOCK_COLS;
-    int block_height = (available_height - (VERTICAL_BLOCK_ROWS - 1) * VERTICAL_BLOCK_PADDING) / VERTICAL_BLOCK_ROWS;
-    int block_size = (block_width < block_height) ? block_width : block_height;
-    
-    int grid_width = VERTICAL_BLOCK_COLS * block_size + (VERTICAL_BLOCK_COLS - 1) * VERTICAL_BLOCK_PADDING;
-    int grid_height = VERTICAL_BLOCK_ROWS * block_size + (VERTICAL_BLOCK_ROWS - 1) * VERTICAL_BLOCK_PADDING;
-    int start_x = (bounds.size.w - grid_width) / 2;
-    int start_y = (bounds.size.h - grid_height) / 2 - 10;
-    
-    int total_blocks = VERTICAL_BLOCK_COLS * VERTICAL_BLOCK_ROWS;
-    int filled_blocks = progress_calculate_blocks(dctx->remaining_seconds, dctx->total_seconds, total_blocks);
-    
-    for (int col = 0; col < VERTICAL_BLOCK_COLS; col++) {
-        for (int row = VERTICAL_BLOCK_ROWS - 1; row >= 0; row--) {
-            int reversed_col = VERTICAL_BLOCK_COLS - 1 - col;
-            int block_index = reversed_col * VERTICAL_BLOCK_ROWS + (VERTICAL_BLOCK_ROWS - 1 - row);
-            int x = start_x + col * (block_size + VERTICAL_BLOCK_PADDING);
-            int y = start_y + row * (block_size + VERTICAL_BLOCK_PADDING);
-            GRect block_rect = GRect(x, y, block_size, block_size);
-            
-            if (block_index < filled_blocks) {
-                graphics_context_set_fill_color(ctx, c->primary);
-                graphics_fill_rect(ctx, block_rect, 2, GCornersAll);
-            } else {
-                graphics_context_set_stroke_color(ctx, c->secondary);
-                graphics_draw_round_rect(ctx, block_rect, 2);
-            }
+static void dither_palette(const VisualizationColors *c) {
+    #if RASTER_HAS_1BIT
+        uint8_t argb[RASTER_DITHER_COLORS] = {
+            c->background.argb, c->primary.argb, c->secondary.argb, c->accent.argb
+        };
+        if (s_dither.count == RASTER_DITHER_COLORS && memcmp(s_dither.argb, argb, sizeof(argb)) == 0) {
+            return;
         }
-    }
-    
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect text_rect = GRect(0, start_y + grid_height + 5, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
-    }
+        raster_dither_init(&s_dither, argb, RASTER_DITHER_COLORS);
+        raster_surface_set_dither(&s_dither);
+    #else
+        (void)c;
+    #endif
 }
 
 // =============================================================================
-// Clock Mode
+// Last Frame Cache
 // =============================================================================
+// The buffer is allocated by the first store after the canvas is shown and
+// freed with the mode caches by display_release.
 
-void display_draw_clock(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int center_x = bounds.size.w / 2;
-    int center_y = bounds.size.h / 2 - 10;
-    int radius = (bounds.size.w < bounds.size.h ? bounds.size.w : bounds.size.h) / 2 - 20;
-    GPoint center = GPoint(center_x, center_y);
-    
-    // Clock face
-    graphics_context_set_stroke_color(ctx, c->secondary);
-    graphics_context_set_stroke_width(ctx, 2);
-    graphics_draw_circle(ctx, center, radius);
-    
-    // Hour markers
-    for (int i = 0; i < 12; i++) {
-        int angle = (i * 360 / 12) - 90;
-        int angle_rad_x = (angle * TRIG_MAX_ANGLE) / 360;
-        int inner_r = radius - 8;
-        int outer_r = radius - 3;
-        int x1 = center_x + (cos_lookup(angle_rad_x) * inner_r / TRIG_MAX_RATIO);
-        int y1 = center_y + (sin_lookup(angle_rad_x) * inner_r / TRIG_MAX_RATIO);
-        int x2 = center_x + (cos_lookup(angle_rad_x) * outer_r / TRIG_MAX_RATIO);
-        int y2 = center_y + (sin_lookup(angle_rad_x) * outer_r / TRIG_MAX_RATIO);
-        graphics_context_set_stroke_width(ctx, (i % 3 == 0) ? 3 : 1);
-        graphics_draw_line(ctx, GPoint(x1, y1), GPoint(x2, y2));
+#if FRAME_CACHE_ENABLED
+static FrameCache s_frame_cache;
+static bool s_frame_cache_tried;   // One allocation attempt per showing
+#endif
+
+FrameKey display_frame_key(GRect bounds, const TimerContext *timer, const AnimationState *anim,
+                           const VisualizationColors *palettes) {
+    DisplayMode mode = timer->display_mode;
+    if (mode >= DISPLAY_MODE_COUNT) {
+        mode = DISPLAY_MODE_TEXT;
     }
-    
-    // Progress arc
-    if (dctx->remaining_seconds > 0 && dctx->total_seconds > 0) {
-        graphics_context_set_fill_color(ctx, c->primary);
-        int segments = 60;
-        int filled_segments = (dctx->remaining_seconds * segments) / dctx->total_seconds;
-        
-        for (int i = 0; i < filled_segments; i++) {
-            int32_t seg_angle = -TRIG_MAX_ANGLE / 4 + (i * TRIG_MAX_ANGLE / segments);
-            int32_t next_angle = -TRIG_MAX_ANGLE / 4 + ((i + 1) * TRIG_MAX_ANGLE / segments);
-            int inner_r = radius / 3;
-            int outer_r = radius - 12;
-            
-            GPoint p1 = GPoint(
-                center_x + (cos_lookup(seg_angle) * inner_r / TRIG_MAX_RATIO),
-                center_y + (sin_lookup(seg_angle) * inner_r / TRIG_MAX_RATIO));
-            GPoint p2 = GPoint(
-                center_x + (cos_lookup(seg_angle) * outer_r / TRIG_MAX_RATIO),
-                center_y + (sin_lookup(seg_angle) * outer_r / TRIG_MAX_RATIO));
-            GPoint p3 = GPoint(
-                center_x + (cos_lookup(next_angle) * outer_r / TRIG_MAX_RATIO),
-                center_y + (sin_lookup(next_angle) * outer_r / TRIG_MAX_RATIO));
-            
-            graphics_context_set_stroke_color(ctx, c->primary);
-            graphics_context_set_stroke_width(ctx, 3);
-            graphics_draw_line(ctx, p1, p2);
-            graphics_draw_line(ctx, p2, p3);
-            graphics_draw_line(ctx, p3, p1);
-        }
+    DisplayContext dctx = display_context_from_timer(timer, &palettes[mode]);
+    const VisualizationColors *c = dctx.colors;
+
+    FrameKey key = FRAME_KEY_INIT;
+    key = frame_key_add(key, (uint32_t)mode);
+    key = frame_key_add(key, (uint32_t)dctx.remaining_seconds);
+    key = frame_key_add(key, (uint32_t)dctx.total_seconds);
+    key = frame_key_add(key, (uint32_t)dctx.state);
+    key = frame_key_add(key, (uint32_t)dctx.grid_density);
+    key = frame_key_add(key, anim->clock.steps);
+    key = frame_key_add(key, (uint32_t)animation_alpha(anim));
+    key = frame_key_add(key, (uint32_t)c->background.argb | (uint32_t)c->primary.argb << 8 |
+                             (uint32_t)c->secondary.argb << 16 | (uint32_t)c->accent.argb << 24);
+    key = frame_key_add(key, (uint32_t)(uint16_t)bounds.size.w << 16 | (uint16_t)bounds.size.h);
+    if (reflowing(mode)) {
+        key = frame_key_add(key, (uint32_t)s_reflow->progress);
     }
-    
-    // Center dot
-    graphics_context_set_fill_color(ctx, c->secondary);
-    graphics_fill_circle(ctx, center, 5);
-    
-    // Clock hand
-    if (dctx->total_seconds > 0) {
-        int32_t hand_angle = -TRIG_MAX_ANGLE / 4;
-        if (dctx->remaining_seconds < dctx->total_seconds) {
-            hand_angle = -TRIG_MAX_ANGLE / 4 + 
-                         ((dctx->total_seconds - dctx->remaining_seconds) * TRIG_MAX_ANGLE / dctx->total_seconds);
+    return key;
+}
+
+bool display_frame_restore(GContext *ctx, FrameKey key) {
+    #if FRAME_CACHE_ENABLED
+        if (!s_frame_cache.valid) {
+            return false;
         }
-        int hand_length = radius - 15;
-        GPoint hand_end = GPoint(
-            center_x + (cos_lookup(hand_angle) * hand_length / TRIG_MAX_RATIO),
-            center_y + (sin_lookup(hand_angle) * hand_length / TRIG_MAX_RATIO));
-        graphics_context_set_stroke_color(ctx, c->accent);
-        graphics_context_set_stroke_width(ctx, 3);
-        graphics_draw_line(ctx, center, hand_end);
-    }
-    
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD);
-        GRect text_rect = GRect(center_x - 40, center_y + radius + 5, 80, 24);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
-    }
+        RasterSurface surface;
+        raster_surface_begin(&surface, ctx);
+        bool restored = raster_surface_is_direct(&surface) &&
+                        frame_cache_restore(&s_frame_cache, &surface.target, key);
+        raster_surface_end(&surface);
+        return restored;
+    #else
+        return false;
+    #endif
+}
+
+void display_frame_store(GContext *ctx, FrameKey key) {
+    #if FRAME_CACHE_ENABLED
+        if (s_frame_cache.valid && s_frame_cache.key == key) {
+            return;
+        }
+        RasterSurface surface;
+        raster_surface_begin(&surface, ctx);
+        if (!raster_surface_is_direct(&surface)) {
+            frame_cache_invalidate(&s_frame_cache);
+            return;
+        }
+        const RasterTarget *target = &surface.target;
+        if (!s_frame_cache.pixels && !s_frame_cache_tried) {
+            size_t bytes = frame_cache_bytes(target->format, target->width, target->height);
+            frame_cache_init(&s_frame_cache, malloc(bytes), bytes);
+            s_frame_cache_tried = true;
+        }
+        frame_cache_store(&s_frame_cache, target, key);
+        raster_surface_end(&surface);
+    #endif
 }
 
 // =============================================================================
-// Ring Mode
+// Mode Transitions
 // =============================================================================
+// The outgoing frame is the frame cache's buffer, handed over when the
+// transition begins; the cache allocates a new one for the incoming frame
+// when it next stores, after the incoming mode has taken its caches. If
+// that fails, there is no transition.
 
-void display_draw_ring(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int center_x = bounds.size.w / 2;
-    int center_y = bounds.size.h / 2 - 5;
-    int radius = (bounds.size.w < bounds.size.h ? bounds.size.w : bounds.size.h) / 2 - 15;
-    GPoint center = GPoint(center_x, center_y);
-    
-    // Background ring
-    graphics_context_set_stroke_color(ctx, c->secondary);
-    graphics_context_set_stroke_width(ctx, 12);
-    graphics_draw_circle(ctx, center, radius);
-    
-    // Progress arc
-    if (dctx->remaining_seconds > 0 && dctx->total_seconds > 0) {
-        int progress_degrees = progress_calculate_degrees(dctx->remaining_seconds, dctx->total_seconds);
-        
-        graphics_context_set_stroke_color(ctx, c->primary);
-        graphics_context_set_stroke_width(ctx, 10);
-        
-        for (int deg = 0; deg < progress_degrees; deg += 3) {
-            int32_t angle = (-90 + deg) * TRIG_MAX_ANGLE / 360;
-            int x = center_x + (cos_lookup(angle) * radius / TRIG_MAX_RATIO);
-            int y = center_y + (sin_lookup(angle) * radius / TRIG_MAX_RATIO);
-            graphics_fill_circle(ctx, GPoint(x, y), 5);
+#if FRAME_CACHE_ENABLED
+static FrameCache s_transition_from;
+static int32_t s_transition_progress;
+static bool s_transition_active;
+#endif
+
+bool display_transition_begin(void) {
+    display_transition_end();
+    #if FRAME_CACHE_ENABLED
+        if (!s_frame_cache.valid) {
+            return false;
         }
-    }
-    
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_BITHAM_34_MEDIUM_NUMBERS);
-        GRect text_rect = GRect(0, center_y - 20, bounds.size.w, 44);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
-    }
+        s_transition_from = s_frame_cache;
+        frame_cache_init(&s_frame_cache, NULL, 0);
+        s_frame_cache_tried = false;
+        s_transition_progress = 0;
+        s_transition_active = true;
+        return true;
+    #else
+        return false;
+    #endif
 }
 
-// =============================================================================
-// Hourglass Mode
-// =============================================================================
+void display_transition_set_progress(int32_t progress) {
+    #if FRAME_CACHE_ENABLED
+        s_transition_progress = progress;
+    #else
+        (void)progress;
+    #endif
+}
 
-void display_draw_hourglass(GContext *ctx, GRect bounds, const DisplayContext *dctx, HourglassState *anim) {
-    const VisualizationColors *c = dctx->colors;
-    animation_update_hourglass(anim, dctx->remaining_seconds, dctx->total_seconds);
-    
-    int center_x = bounds.size.w / 2;
-    int center_y = bounds.size.h / 2;
-    int glass_width = 60;
-    int glass_height = 100;
-    int neck_width = 8;
-    
-    int top = center_y - glass_height / 2;
-    int bottom = center_y + glass_height / 2;
-    int middle = center_y;
-    
-    // Hourglass outline
-    graphics_context_set_stroke_color(ctx, c->secondary);
-    graphics_context_set_stroke_width(ctx, 2);
-    
-    // Top triangle
-    graphics_draw_line(ctx, GPoint(center_x - glass_width/2, top), 
-                           GPoint(center_x - neck_width/2, middle));
-    graphics_draw_line(ctx, GPoint(center_x + glass_width/2, top), 
-                           GPoint(center_x + neck_width/2, middle));
-    graphics_draw_line(ctx, GPoint(center_x - glass_width/2, top), 
-                           GPoint(center_x + glass_width/2, top));
-    
-    // Bottom triangle
-    graphics_draw_line(ctx, GPoint(center_x - neck_width/2, middle), 
-                           GPoint(center_x - glass_width/2, bottom));
-    graphics_draw_line(ctx, GPoint(center_x + neck_width/2, middle), 
-                           GPoint(center_x + glass_width/2, bottom));
-    graphics_draw_line(ctx, GPoint(center_x - glass_width/2, bottom), 
-                           GPoint(center_x + glass_width/2, bottom));
-    
-    // Sand in top chamber
-    graphics_context_set_fill_color(ctx, c->primary);
-    int top_chamber_bottom = middle - 5;
-    int sand_rows_top = (anim->num_sand_top + 7) / 8;
-    
-    for (int row = 0; row < sand_rows_top && row < 6; row++) {
-        int y = top_chamber_bottom - (row + 1) * 7;
-        int row_from_neck = row;
-        int row_width = neck_width + row_from_neck * 8;
-        if (row_width > glass_width - 10) row_width = glass_width - 10;
-        
-        int particles_in_row = (row < sand_rows_top - 1) ? 8 : (anim->num_sand_top % 8);
-        if (particles_in_row == 0 && row < sand_rows_top) particles_in_row = 8;
-        
-        for (int p = 0; p < particles_in_row; p++) {
-            int x = center_x - row_width/2 + (row_width * p) / 7;
-            graphics_fill_circle(ctx, GPoint(x, y), 3);
+bool display_transition_draw(GContext *ctx) {
+    #if FRAME_CACHE_ENABLED
+        if (!s_transition_active || !s_frame_cache.valid) {
+            return false;
         }
-    }
-    
-    // Sand in bottom chamber
-    int sand_rows_bottom = (anim->num_sand_bottom + 7) / 8;
-    
-    for (int row = 0; row < sand_rows_bottom && row < 6; row++) {
-        int y = bottom - 8 - row * 7;
-        int row_from_bottom = row;
-        int row_width = glass_width - 10 - row_from_bottom * 8;
-        if (row_width < neck_width) row_width = neck_width;
-        
-        int particles_in_row = (row < sand_rows_bottom - 1) ? 8 : (anim->num_sand_bottom % 8);
-        if (particles_in_row == 0 && row < sand_rows_bottom) particles_in_row = 8;
-        
-        for (int p = 0; p < particles_in_row; p++) {
-            int x = center_x - row_width/2 + (row_width * p) / 7;
-            graphics_fill_circle(ctx, GPoint(x, y), 3);
+        RasterSurface surface;
+        raster_surface_begin(&surface, ctx);
+        bool drawn = false;
+        if (raster_surface_is_direct(&surface)) {
+            // The incoming mode wipes in from the right
+            const RasterTarget *target = &surface.target;
+            int split = target->width - (int)(target->width * s_transition_progress / ANIMATION_NORMALIZED_MAX);
+            drawn = frame_cache_wipe(&s_transition_from, &s_frame_cache, target, split);
         }
-    }
-    
-    // Falling sand particle
-    if (dctx->state == STATE_RUNNING && anim->num_sand_top > 0) {
-        int fall_y = middle + ((dctx->remaining_seconds % 2) * 5);
-        graphics_context_set_fill_color(ctx, c->primary);
-        graphics_fill_circle(ctx, GPoint(center_x, fall_y), 2);
-    }
-    
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect text_rect = GRect(0, bottom + 5, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
-    }
+        raster_surface_end(&surface);
+        return drawn;
+    #else
+        (void)ctx;
+        return false;
+    #endif
+}
+
+void display_transition_end(void) {
+    #if FRAME_CACHE_ENABLED
+        free(s_transition_from.pixels);
+        frame_cache_init(&s_transition_from, NULL, 0);
+        s_transition_active = false;
+    #endif
 }
 
 // =============================================================================
-// Binary Mode
+// Grid Modes (Blocks, Vertical Blocks, Spiral Out, Spiral In)
 // =============================================================================
+// All grid modes share one engine. Only one grid is visible at a time, so a
+// single state, allocated while a grid mode is active, holds the layout, fill
+// order and last rendered frame.
 
-void display_draw_binary(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    TimeComponents t = time_decompose(dctx->remaining_seconds);
-    
-    int center_x = bounds.size.w / 2;
-    int start_y = 25;
-    int dot_radius = 8;
-    int dot_spacing = 22;
-    int row_spacing = 30;
-    
-    GFont label_font = fonts_get_system_font(FONT_KEY_GOTHIC_14);
-    graphics_context_set_text_color(ctx, COLOR_HINT);
-    
-    // Hours row
-    graphics_draw_text(ctx, "H", label_font, GRect(5, start_y, 20, 20),
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
-    for (int bit = 5; bit >= 0; bit--) {
-        int x = center_x - (3 * dot_spacing) + (5 - bit) * dot_spacing + dot_spacing/2;
-        bool is_set = (t.hours >> bit) & 1;
-        
-        if (is_set) {
-            graphics_context_set_fill_color(ctx, c->primary);
-            graphics_fill_circle(ctx, GPoint(x, start_y + 10), dot_radius);
-        } else {
-            graphics_context_set_stroke_color(ctx, c->secondary);
-            graphics_context_set_stroke_width(ctx, 2);
-            graphics_draw_circle(ctx, GPoint(x, start_y + 10), dot_radius);
-        }
-    }
-    
-    // Minutes row
-    int min_y = start_y + row_spacing;
-    graphics_draw_text(ctx, "M", label_font, GRect(5, min_y, 20, 20),
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
-    for (int bit = 5; bit >= 0; bit--) {
-        int x = center_x - (3 * dot_spacing) + (5 - bit) * dot_spacing + dot_spacing/2;
-        bool is_set = (t.minutes >> bit) & 1;
-        
-        if (is_set) {
-            graphics_context_set_fill_color(ctx, c->primary);
-            graphics_fill_circle(ctx, GPoint(x, min_y + 10), dot_radius);
-        } else {
-            graphics_context_set_stroke_color(ctx, c->secondary);
-            graphics_context_set_stroke_width(ctx, 2);
-            graphics_draw_circle(ctx, GPoint(x, min_y + 10), dot_radius);
-        }
-    }
-    
-    // Seconds row
-    int sec_y = start_y + row_spacing * 2;
-    graphics_draw_text(ctx, "S", label_font, GRect(5, sec_y, 20, 20),
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
-    for (int bit = 5; bit >= 0; bit--) {
-        int x = center_x - (3 * dot_spacing) + (5 - bit) * dot_spacing + dot_spacing/2;
-        bool is_set = (t.seconds >> bit) & 1;
-        
-        if (is_set) {
-            graphics_context_set_fill_color(ctx, c->primary);
-            graphics_fill_circle(ctx, GPoint(x, sec_y + 10), dot_radius);
-        } else {
-            graphics_context_set_stroke_color(ctx, c->secondary);
-            graphics_context_set_stroke_width(ctx, 2);
-            graphics_draw_circle(ctx, GPoint(x, sec_y + 10), dot_radius);
+#define BLOCK_COLS 12
+#define BLOCK_ROWS 8
+#define VERTICAL_BLOCK_COLS 8
+#define VERTICAL_BLOCK_ROWS 12
+#define SPIRAL_COLS 9
+#define SPIRAL_ROWS 9
+
+// Frame scratch: the list of cells that changed
+#define GRID_SCRATCH_BYTES (GRID_MAX_CELLS * sizeof(uint16_t))
+
+static GridState *s_grid_state;
+
+static bool grid_activate(void) {
+    s_grid_state = calloc(1, sizeof(GridState));
+    return s_grid_state != NULL;
+}
+
+static void grid_deactivate(void) {
+    free(s_grid_state);
+    s_grid_state = NULL;
+}
+
+typedef enum {
+    GRID_PASS_CLEAR,
+    GRID_PASS_FILLED,
+    GRID_PASS_EMPTY
+} GridPass;
+
+// Draw `count` cells, `cells` or the first `count` if NULL, as `next` has
+// them. With `prev`, only cells that differ from it are drawn, each cleared
+// first. Cells don't overlap, so they go in one pass per color: the SDK
+// fallback sets each color once instead of once per cell.
+static void draw_grid_cells(RasterSurface *surface, const GridLayout *layout, GPoint at, const uint16_t *cells,
+                            int count, const GridBitset *next, const GridBitset *prev,
+                            const VisualizationColors *c) {
+    for (int pass = prev ? GRID_PASS_CLEAR : GRID_PASS_FILLED; pass <= GRID_PASS_EMPTY; pass++) {
+        for (int i = 0; i < count; i++) {
+            int cell = cells ? cells[i] : i;
+            bool filled = grid_bitset_test(next, cell);
+            if (prev && filled == grid_bitset_test(prev, cell)) continue;
+            if ((pass == GRID_PASS_FILLED && !filled) || (pass == GRID_PASS_EMPTY && filled)) continue;
+
+            int x, y;
+            grid_cell_origin(layout, cell, &x, &y);
+            GRect cell_rect = GRect(at.x + x, at.y + y, layout->cell_size, layout->cell_size);
+            if (pass == GRID_PASS_CLEAR) {
+                raster_surface_fill_rect(surface, cell_rect, 0, c->background);
+            } else if (pass == GRID_PASS_FILLED) {
+                raster_surface_fill_rect(surface, cell_rect, 2, c->primary);
+            } else {
+                raster_surface_draw_round_rect(surface, cell_rect, 2, c->secondary);
+            }
         }
     }
-    
-    // Bit labels
-    graphics_context_set_text_color(ctx, COLOR_HINT);
-    GFont tiny_font = fonts_get_system_font(FONT_KEY_GOTHIC_14);
-    for (int bit = 5; bit >= 0; bit--) {
-        int x = center_x - (3 * dot_spacing) + (5 - bit) * dot_spacing + dot_spacing/2 - 8;
-        static char bit_label[4];
-        snprintf(bit_label, sizeof(bit_label), "%d", 1 << bit);
-        graphics_draw_text(ctx, bit_label, tiny_font, GRect(x, sec_y + 25, 20, 16),
-                           GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-    }
-    
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect text_rect = GRect(0, bounds.size.h - 40, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
-    }
 }
 
-// =============================================================================
-// Radial Mode
-// =============================================================================
-
-void display_draw_radial(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
+static void draw_grid_mode(GContext *ctx, GRect bounds, const DisplayContext *dctx,
+                           int base_cols, int base_rows, GridOrderBuilder order) {
     const VisualizationColors *c = dctx->colors;
-    int center_x = bounds.size.w / 2;
-    int center_y = bounds.size.h / 2 - 10;
-    GPoint center = GPoint(center_x, center_y);
+    GridState *grid = s_grid_state;
+    GridSpec spec = grid_spec_scaled(base_cols, base_rows, order, dctx->grid_density);
     
-    TimeComponents t = time_decompose(dctx->remaining_seconds);
-    
-    int ring_width = 8;
-    int ring_gap = 4;
-    int outer_radius = (bounds.size.w < bounds.size.h ? bounds.size.w : bounds.size.h) / 2 - 20;
-    
-    // Seconds ring (innermost)
-    int sec_radius = outer_radius - 2 * (ring_width + ring_gap);
-    graphics_context_set_stroke_color(ctx, c->secondary);
-    graphics_context_set_stroke_width(ctx, ring_width);
-    graphics_draw_circle(ctx, center, sec_radius);
-    
-    if (t.seconds > 0) {
-        int sec_degrees = (t.seconds * 360) / 60;
-        graphics_context_set_stroke_color(ctx, c->accent);
-        for (int deg = 0; deg < sec_degrees; deg += 4) {
-            int32_t angle = (-90 + deg) * TRIG_MAX_ANGLE / 360;
-            int x = center_x + (cos_lookup(angle) * sec_radius / TRIG_MAX_RATIO);
-            int y = center_y + (sin_lookup(angle) * sec_radius / TRIG_MAX_RATIO);
-            graphics_fill_circle(ctx, GPoint(x, y), ring_width / 2 - 1);
-        }
+    if (!grid_state_matches(grid, &spec, bounds.size.w, bounds.size.h)) {
+        grid_state_configure(grid, &spec, bounds.size.w, bounds.size.h);
     }
-    
-    // Minutes ring (middle)
-    int min_radius = outer_radius - (ring_width + ring_gap);
-    graphics_context_set_stroke_color(ctx, c->secondary);
-    graphics_context_set_stroke_width(ctx, ring_width);
-    graphics_draw_circle(ctx, center, min_radius);
-    
-    if (t.minutes > 0) {
-        int min_degrees = (t.minutes * 360) / 60;
-        graphics_context_set_stroke_color(ctx, c->secondary);
-        for (int deg = 0; deg < min_degrees; deg += 4) {
-            int32_t angle = (-90 + deg) * TRIG_MAX_ANGLE / 360;
-            int x = center_x + (cos_lookup(angle) * min_radius / TRIG_MAX_RATIO);
-            int y = center_y + (sin_lookup(angle) * min_radius / TRIG_MAX_RATIO);
-            graphics_fill_circle(ctx, GPoint(x, y), ring_width / 2 - 1);
-        }
+    RasterSurface surface;
+    raster_surface_begin(&surface, ctx);
+    
+    if (dctx->full_redraw) {
+        grid->valid = false;
+    } else if (!grid->valid) {
+        // Layout changed under an incremental frame; start from a clean canvas
+        raster_surface_fill_rect(&surface, bounds, 0, c->background);
+        s_time_exposed = true;
     }
     
-    // Hours ring (outermost)
-    graphics_context_set_stroke_color(ctx, c->secondary);
-    graphics_context_set_stroke_width(ctx, ring_width);
-    graphics_draw_circle(ctx, center, outer_radius);
+    const GridLayout *layout = &grid->layout;
+    int total_cells = layout->cols * layout->rows;
+    int filled_cells = progress_calculate_blocks(dctx->remaining_seconds, dctx->total_seconds, total_cells);
     
-    if (t.hours > 0) {
-        int hour_degrees = (t.hours * 360) / 24;
-        graphics_context_set_stroke_color(ctx, c->primary);
-        for (int deg = 0; deg < hour_degrees; deg += 4) {
-            int32_t angle = (-90 + deg) * TRIG_MAX_ANGLE / 360;
-            int x = center_x + (cos_lookup(angle) * outer_radius / TRIG_MAX_RATIO);
-            int y = center_y + (sin_lookup(angle) * outer_radius / TRIG_MAX_RATIO);
-            graphics_fill_circle(ctx, GPoint(x, y), ring_width / 2 - 1);
-        }
-    }
+    GridBitset next;
+    grid_state_bitset_for(grid, filled_cells, &next);
     
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect text_rect = GRect(0, center_y - 14, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
+    if (!grid->valid) {
+        draw_grid_cells(&surface, layout, GPointZero, NULL, total_cells, &next, NULL, c);
+    } else {
+        // Repaint only the cells whose filled bit flipped since the last frame
+        uint16_t *changed = arena_alloc(&s_scratch, GRID_SCRATCH_BYTES);
+        int num_changed = grid_bitset_diff(&grid->filled, &next, changed, GRID_MAX_CELLS);
+        draw_grid_cells(&surface, layout, GPointZero, changed, num_changed, &next, &grid->filled, c);
     }
+    grid->filled = next;
+    grid->valid = true;
     
-    // Legend
-    GFont tiny = fonts_get_system_font(FONT_KEY_GOTHIC_14);
-    graphics_context_set_text_color(ctx, c->primary);
-    graphics_draw_text(ctx, "H", tiny, GRect(center_x - 45, bounds.size.h - 25, 20, 16),
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-    graphics_context_set_text_color(ctx, c->secondary);
-    graphics_draw_text(ctx, "M", tiny, GRect(center_x - 10, bounds.size.h - 25, 20, 16),
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-    graphics_context_set_text_color(ctx, c->accent);
-    graphics_draw_text(ctx, "S", tiny, GRect(center_x + 25, bounds.size.h - 25, 20, 16),
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+    raster_surface_end(&surface);
 }
 
-// =============================================================================
-// Hex Mode
-// =============================================================================
+// Under the grid
+static GRect grid_time_frame(GRect bounds, const DisplayContext *dctx, int base_cols, int base_rows,
+                             GridOrderBuilder order) {
+    GridSpec spec = grid_spec_scaled(base_cols, base_rows, order, dctx->grid_density);
+    GridLayout layout;
+    grid_layout_compute(&layout, &spec, bounds.size.w, bounds.size.h);
+    return GRect(0, layout.origin_y + layout.height + 5, bounds.size.w, 30);
+}
 
-void display_draw_hex(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int center_y = bounds.size.h / 2;
-    
-    static char hex_buf[16];
-    time_format_hex(dctx->remaining_seconds, hex_buf, sizeof(hex_buf));
-    
-    // Hex time
-    GFont hex_font = fonts_get_system_font(FONT_KEY_BITHAM_42_BOLD);
-    GRect hex_rect = GRect(0, center_y - 30, bounds.size.w, 50);
-    graphics_context_set_text_color(ctx, c->primary);
-    graphics_draw_text(ctx, hex_buf, hex_font, hex_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-    
-    // 0x prefix
-    GFont prefix_font = fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD);
-    GRect prefix_rect = GRect(10, center_y - 50, 30, 24);
-    graphics_context_set_text_color(ctx, c->secondary);
-    graphics_draw_text(ctx, "0x", prefix_font, prefix_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentLeft, NULL);
-    
-    // Decimal equivalent
-    static char dec_buf[20];
-    snprintf(dec_buf, sizeof(dec_buf), "= %d sec", dctx->remaining_seconds);
-    GFont dec_font = fonts_get_system_font(FONT_KEY_GOTHIC_18);
-    GRect dec_rect = GRect(0, center_y + 25, bounds.size.w, 24);
-    graphics_context_set_text_color(ctx, c->secondary);
-    graphics_draw_text(ctx, dec_buf, dec_font, dec_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-    
-    // Progress bar
-    int bar_y = bounds.size.h - 30;
-    int bar_height = 10;
-    int bar_margin = 20;
-    int bar_width = bounds.size.w - bar_margin * 2;
-    
-    graphics_context_set_fill_color(ctx, c->secondary);
-    graphics_fill_rect(ctx, GRect(bar_margin, bar_y, bar_width, bar_height), 3, GCornersAll);
-    
-    if (dctx->total_seconds > 0) {
-        int progress_width = (dctx->remaining_seconds * bar_width) / dctx->total_seconds;
-        graphics_context_set_fill_color(ctx, c->primary);
-        graphics_fill_rect(ctx, GRect(bar_margin, bar_y, progress_width, bar_height), 3, GCornersAll);
+static void draw_blocks(GContext *ctx, GRect bounds, const DisplayContext *dctx, const AnimationState *anim) {
+    draw_grid_mode(ctx, bounds, dctx, BLOCK_COLS, BLOCK_ROWS, grid_order_rows);
+}
+
+static void draw_vertical_blocks(GContext *ctx, GRect bounds, const DisplayContext *dctx,
+                                 const AnimationState *anim) {
+    draw_grid_mode(ctx, bounds, dctx, VERTICAL_BLOCK_COLS, VERTICAL_BLOCK_ROWS, grid_order_columns);
+}
+
+static void draw_spiral_out(GContext *ctx, GRect bounds, const DisplayContext *dctx, const AnimationState *anim) {
+    draw_grid_mode(ctx, bounds, dctx, SPIRAL_COLS, SPIRAL_ROWS, grid_order_spiral_out);
+}
+
+static void draw_spiral_in(GContext *ctx, GRect bounds, const DisplayContext *dctx, const AnimationState *anim) {
+    draw_grid_mode(ctx, bounds, dctx, SPIRAL_COLS, SPIRAL_ROWS, grid_order_spiral_in);
+}
+
+static void blocks_time(GRect bounds, const DisplayContext *dctx, DisplayTimeOverlay *overlay) {
+    overlay->frame = grid_time_frame(bounds, dctx, BLOCK_COLS, BLOCK_ROWS, grid_order_rows);
+}
+
+static void vertical_blocks_time(GRect bounds, const DisplayContext *dctx, DisplayTimeOverlay *overlay) {
+    overlay->frame = grid_time_frame(bounds, dctx, VERTICAL_BLOCK_COLS, VERTICAL_BLOCK_ROWS, grid_order_columns);
+}
+
+static void spiral_out_time(GRect bounds, const DisplayContext *dctx, DisplayTimeOverlay *overlay) {
+    overlay->frame = grid_time_frame(bounds, dctx, SPIRAL_COLS, SPIRAL_ROWS, grid_order_spiral_out);
+}
+
+static void spiral_in_time(GRect bounds, const DisplayContext *dctx, DisplayTimeOverlay *overlay) {
+    overlay->frame = grid_time_frame(bounds, dctx, SPIRAL_COLS, SPIRAL_ROWS, grid_order_spiral_in);
+}
+
+// The grid `mode` draws at `density`; false for the other modes
+static bool grid_spec_for(DisplayMode mode, int density, GridSpec *spec) {
+    switch (mode) {
+        case DISPLAY_MODE_BLOCKS:
+            *spec = grid_spec_scaled(BLOCK_COLS, BLOCK_ROWS, grid_order_rows, density);
+            return true;
+        case DISPLAY_MODE_VERTICAL_BLOCKS:
+            *spec = grid_spec_scaled(VERTICAL_BLOCK_COLS, VERTICAL_BLOCK_ROWS, grid_order_columns, density);
+            return true;
+        case DISPLAY_MODE_SPIRAL_OUT:
+            *spec = grid_spec_scaled(SPIRAL_COLS, SPIRAL_ROWS, grid_order_spiral_out, density);
+            return true;
+        case DISPLAY_MODE_SPIRAL_IN:
+            *spec = grid_spec_scaled(SPIRAL_COLS, SPIRAL_ROWS, grid_order_spiral_in, density);
+            return true;
+        default:
+            return false;
     }
 }
 
@@ -618,62 +465,157 @@ void display_draw_hex(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
 // Matrix Mode
 // =============================================================================
 
-void display_draw_matrix(GContext *ctx, GRect bounds, const DisplayContext *dctx, MatrixState *anim) {
-    const VisualizationColors *c = dctx->colors;
-    animation_update_matrix(anim, dctx->remaining_seconds);
-    
+// Cells are drawn from a glyph atlas and only repainted when their digit or
+// trail shade changes; the SDK text path is kept as a fallback for when the
+// framebuffer can't be captured.
+
+#define MATRIX_ROW_HEIGHT 14
+#define MATRIX_START_Y 10
+#define MATRIX_TRAIL_LENGTH 6
+#define MATRIX_CELL_EMPTY 0xFF
+
+typedef struct {
+    GlyphAtlas atlas;
+    uint8_t shown[MATRIX_COLS][MATRIX_ROWS];  // glyph * GLYPH_SHADE_COUNT + shade, or MATRIX_CELL_EMPTY
+    bool valid;
+} MatrixFrame;
+
+// Allocated while Matrix is active
+static MatrixFrame *s_matrix_frame;
+
+static bool matrix_activate(void) {
+    s_matrix_frame = calloc(1, sizeof(MatrixFrame));
+    return s_matrix_frame != NULL;
+}
+
+static void matrix_deactivate(void) {
+    free(s_matrix_frame);
+    s_matrix_frame = NULL;
+}
+
+// Trail shade for a cell, or -1 when the cell is dark
+static int matrix_cell_shade(const int drop_rows[MATRIX_COLS], int col, int row) {
+    int dist = drop_rows[col] - row;
+    if (dist < 0) dist += MATRIX_ROWS + 5;
+
+    if (dist == 0) return GLYPH_SHADE_HEAD;
+    if (dist <= 2) return GLYPH_SHADE_NEAR;
+    if (dist <= MATRIX_TRAIL_LENGTH) return GLYPH_SHADE_TAIL;
+    return -1;
+}
+
+static void draw_matrix_rain_text(GContext *ctx, GRect bounds, const VisualizationColors *c,
+                                  const MatrixState *anim, const int drop_rows[MATRIX_COLS]) {
     int col_width = bounds.size.w / MATRIX_COLS;
-    int row_height = 14;
-    int start_y = 10;
-    
     GFont char_font = fonts_get_system_font(FONT_KEY_GOTHIC_14);
-    
-    // Falling characters
-    for (int col = 0; col < MATRIX_COLS; col++) {
-        int drop_head = anim->drops[col];
-        int x = col * col_width + col_width / 2 - 4;
-        
-        for (int row = 0; row < MATRIX_ROWS; row++) {
-            int y = start_y + row * row_height;
-            
-            int dist = drop_head - row;
-            if (dist < 0) dist += MATRIX_ROWS + 5;
-            
-            if (dist <= 6) {
-                static char char_buf[2];
+    GColor shade_colors[GLYPH_SHADE_COUNT] = { c->primary, c->secondary, c->accent };
+
+    // One pass per shade, so the text color is set at most three times
+    for (int pass = 0; pass < GLYPH_SHADE_COUNT; pass++) {
+        bool color_set = false;
+        for (int col = 0; col < MATRIX_COLS; col++) {
+            int x = col * col_width + col_width / 2 - 4;
+            for (int row = 0; row < MATRIX_ROWS; row++) {
+                if (matrix_cell_shade(drop_rows, col, row) != pass) continue;
+
+                if (!color_set) {
+                    graphics_context_set_text_color(ctx, shade_colors[pass]);
+                    color_set = true;
+                }
+                char char_buf[2];
                 char_buf[0] = anim->chars[col][row];
                 char_buf[1] = '\0';
-                
-                if (dist == 0) {
-                    graphics_context_set_text_color(ctx, c->primary);
-                } else if (dist <= 2) {
-                    graphics_context_set_text_color(ctx, c->secondary);
-                } else {
-                    graphics_context_set_text_color(ctx, c->accent);
-                }
-                
-                graphics_draw_text(ctx, char_buf, char_font, 
-                                  GRect(x, y, 12, 16),
-                                  GTextOverflowModeTrailingEllipsis, 
-                                  GTextAlignmentCenter, NULL);
+                graphics_draw_text(ctx, char_buf, char_font,
+                                   GRect(x, MATRIX_START_Y + row * MATRIX_ROW_HEIGHT, 12, 16),
+                                   GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
             }
         }
     }
+}
+
+// No cell is drawn under `overlay`, the time overlay's frame, so the rain
+// never touches the text
+static void draw_matrix_rain_atlas(RasterSurface *surface, GRect bounds, GRect overlay,
+                                   const VisualizationColors *c, const MatrixState *anim,
+                                   const int drop_rows[MATRIX_COLS], bool full_redraw) {
+    MatrixFrame *frame = s_matrix_frame;
+    const RasterTarget *target = &surface->target;
+
+    uint8_t shades[GLYPH_SHADE_COUNT] = { c->primary.argb, c->secondary.argb, c->accent.argb };
+    if (!glyph_atlas_matches(&frame->atlas, target->format, shades, c->background.argb)) {
+        glyph_atlas_build(&frame->atlas, target->format, shades, c->background.argb);
+        frame->valid = false;
+    }
+    if (full_redraw || !frame->valid) {
+        // The background was just cleared, so every cell starts out empty
+        memset(frame->shown, MATRIX_CELL_EMPTY, sizeof(frame->shown));
+        frame->valid = true;
+    }
+
+    int col_width = bounds.size.w / MATRIX_COLS;
+    for (int col = 0; col < MATRIX_COLS; col++) {
+        int x = col * col_width + col_width / 2;
+        for (int row = 0; row < MATRIX_ROWS; row++) {
+            int y = MATRIX_START_Y + row * MATRIX_ROW_HEIGHT + 4;
+            if (y < overlay.origin.y + overlay.size.h && y + GLYPH_HEIGHT > overlay.origin.y) {
+                continue;
+            }
+
+            int shade = matrix_cell_shade(drop_rows, col, row);
+            int glyph = anim->chars[col][row] - '0';
+
+            uint8_t code = (shade < 0) ? MATRIX_CELL_EMPTY : (uint8_t)(glyph * GLYPH_SHADE_COUNT + shade);
+            if (code == frame->shown[col][row]) continue;
+
+            if (shade < 0) {
+                glyph_atlas_clear(&frame->atlas, target, x, y);
+            } else {
+                glyph_atlas_blit(&frame->atlas, target, glyph, (GlyphShade)shade, x, y);
+            }
+            frame->shown[col][row] = code;
+        }
+    }
+}
+
+// Across the middle, on a plate
+static GRect matrix_time_frame(GRect bounds) {
+    return GRect(10, bounds.size.h / 2 - 22, bounds.size.w - 20, 44);
+}
+
+// Part of the art, so it stays when the overlay is hidden elsewhere
+static void matrix_time(GRect bounds, const DisplayContext *dctx, DisplayTimeOverlay *overlay) {
+    overlay->frame = matrix_time_frame(bounds);
+    overlay->size = NUMERAL_SIZE_LARGE;
+    overlay->color = dctx->colors->primary;
+    overlay->plate = true;
+    overlay->shown = true;
+}
+
+static void draw_matrix(GContext *ctx, GRect bounds, const DisplayContext *dctx, const AnimationState *anim_state) {
+    const VisualizationColors *c = dctx->colors;
+    const MatrixState *anim = &anim_state->matrix;
     
-    // Time display with background
-    static char time_buf[16];
-    time_format_adaptive(dctx->remaining_seconds, time_buf, sizeof(time_buf));
-    
-    int time_center_y = bounds.size.h / 2;
-    GFont time_font = fonts_get_system_font(FONT_KEY_BITHAM_34_MEDIUM_NUMBERS);
-    GRect time_rect = GRect(10, time_center_y - 22, bounds.size.w - 20, 44);
-    
-    graphics_context_set_fill_color(ctx, c->background);
-    graphics_fill_rect(ctx, GRect(15, time_center_y - 20, bounds.size.w - 30, 40), 4, GCornersAll);
+    int drop_rows[MATRIX_COLS];
+    for (int col = 0; col < MATRIX_COLS; col++) {
+        drop_rows[col] = animation_matrix_drop_row(anim, col, dctx->anim_alpha);
+    }
     
-    graphics_context_set_text_color(ctx, c->primary);
-    graphics_draw_text(ctx, time_buf, time_font, time_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+    RasterSurface surface;
+    raster_surface_begin(&surface, ctx);
+    if (raster_surface_is_direct(&surface)) {
+        draw_matrix_rain_atlas(&surface, bounds, matrix_time_frame(bounds), c, anim, drop_rows,
+                               dctx->full_redraw);
+    } else {
+        raster_surface_end(&surface);
+        s_matrix_frame->valid = false;
+        if (!dctx->full_redraw) {
+            graphics_context_set_fill_color(ctx, c->background);
+            graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+            s_time_exposed = true;
+        }
+        draw_matrix_rain_text(ctx, bounds, c, anim, drop_rows);
+        raster_surface_begin(&surface, ctx);
+    }
     
     // Progress bar
     int bar_y = bounds.size.h - 8;
@@ -683,406 +625,962 @@ void display_draw_matrix(GContext *ctx, GRect bounds, const DisplayContext *dctx
     
     if (dctx->total_seconds > 0) {
         int progress_width = (dctx->remaining_seconds * bar_width) / dctx->total_seconds;
-        graphics_context_set_fill_color(ctx, c->accent);
-        graphics_fill_rect(ctx, GRect(bar_margin, bar_y, bar_width, bar_height), 1, GCornersAll);
-        graphics_context_set_fill_color(ctx, c->primary);
-        graphics_fill_rect(ctx, GRect(bar_margin, bar_y, progress_width, bar_height), 1, GCornersAll);
+        raster_surface_fill_rect(&surface, GRect(bar_margin, bar_y, bar_width, bar_height), 1, c->accent);
+        raster_surface_fill_rect(&surface, GRect(bar_margin, bar_y, progress_width, bar_height), 1, c->primary);
     }
+    raster_surface_end(&surface);
 }
 
 // =============================================================================
-// Water Level Mode
+// Display List Modes
 // =============================================================================
+// Clock, ring, hourglass, binary, radial, hex, water level and the percent
+// modes emit display lists (display_emit.c). Each frame's list is planned
+// against the previous one: on incremental frames the damage is cleared to
+// the background and only the primitives the plan marks are redrawn, in list
+// order. Fills go through the raster surface; everything else uses the SDK.
 
-void display_draw_water_level(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int center_x = bounds.size.w / 2;
-    int center_y = bounds.size.h / 2 - 10;
-    
-    int container_width = 50;
-    int container_height = 100;
-    int container_top = center_y - container_height / 2;
-    int container_bottom = container_top + container_height;
-    int container_left = center_x - container_width / 2;
-    int container_right = center_x + container_width / 2;
-    
-    // Container outline
-    graphics_context_set_stroke_color(ctx, c->secondary);
-    graphics_context_set_stroke_width(ctx, 2);
-    
-    graphics_draw_line(ctx, GPoint(container_left, container_top + 10), 
-                           GPoint(container_left, container_bottom));
-    graphics_draw_line(ctx, GPoint(container_right, container_top + 10), 
-                           GPoint(container_right, container_bottom));
-    graphics_draw_line(ctx, GPoint(container_left, container_bottom), 
-                           GPoint(container_right, container_bottom));
-    
-    int rim_width = container_width + 8;
-    graphics_draw_line(ctx, GPoint(center_x - rim_width/2, container_top + 10), 
-                           GPoint(center_x + rim_width/2, container_top + 10));
-    graphics_draw_line(ctx, GPoint(center_x - rim_width/2, container_top + 10), 
-                           GPoint(container_left, container_top + 10));
-    graphics_draw_line(ctx, GPoint(center_x + rim_width/2, container_top + 10), 
-                           GPoint(container_right, container_top + 10));
-    
-    // Water level
-    int water_height = 0;
-    if (dctx->total_seconds > 0) {
-        water_height = (dctx->remaining_seconds * (container_height - 20)) / dctx->total_seconds;
-    }
-    
-    if (water_height > 0) {
-        int water_top = container_bottom - water_height;
-        
-        graphics_context_set_fill_color(ctx, c->primary);
-        graphics_fill_rect(ctx, GRect(container_left + 1, water_top, 
-                                      container_width - 2, water_height), 0, GCornerNone);
-        
-        // Wave effect
-        graphics_context_set_stroke_color(ctx, c->primary);
-        graphics_context_set_stroke_width(ctx, 2);
-        
-        int wave_offset = (dctx->remaining_seconds % 4) - 2;
-        for (int x = container_left + 2; x < container_right - 2; x += 3) {
-            int y = water_top + (wave_offset * (x % 3 - 1)) / 2;
-            if (y >= water_top - 1 && y <= water_top + 1) {
-                graphics_draw_line(ctx, GPoint(x, y), GPoint(x + 2, y));
-            }
-        }
-    }
-    
-    // Measurement marks
-    graphics_context_set_stroke_color(ctx, c->accent);
-    graphics_context_set_stroke_width(ctx, 1);
-    for (int i = 1; i <= 4; i++) {
-        int mark_y = container_top + 10 + (i * (container_height - 20) / 5);
-        graphics_draw_line(ctx, GPoint(container_left - 5, mark_y), 
-                               GPoint(container_left, mark_y));
-    }
-    
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect text_rect = GRect(0, container_bottom + 10, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
-    }
+static GPoint polar_point(GPoint center, int degrees, int radius) {
+    int32_t angle = (-90 + degrees) * TRIG_MAX_ANGLE / 360;
+    return GPoint(center.x + (cos_lookup(angle) * radius / TRIG_MAX_RATIO),
+                  center.y + (sin_lookup(angle) * radius / TRIG_MAX_RATIO));
 }
 
-// =============================================================================
-// Spiral Out Mode
-// =============================================================================
+// Sector fill cache: the boundary ring (see display_list.h) is computed
+// about the origin, and only when the radii or segment count change; the
+// path's offset puts it in place. A new sweep just moves the ends of the run
+// of points handed to the path, so a frame costs one polygon fill and no
+// trig. The ring is computed as DlPoints and converted to GPoints in place.
+typedef union {
+    DlPoint ring[DL_SECTOR_POINTS_MAX];
+    GPoint points[DL_SECTOR_POINTS_MAX];
+} SectorRing;
 
-#define SPIRAL_COLS 9
-#define SPIRAL_ROWS 9
-#define SPIRAL_PADDING 2
+// What the list modes keep between frames, allocated while one is active
+typedef struct {
+    DisplayList list;
+    DisplayListPlan plan;
+    DisplayListHistory history;
+    SectorRing sector;
+    int16_t sector_key[3];   // Outer radius, inner radius, segments
+    #if VECTOR_ART_ENABLED
+    GDrawCommandImage *art[DISPLAY_ART_COUNT];   // Loaded when first drawn
+    uint8_t art_color[DISPLAY_ART_COUNT];        // What each one's strokes are set to
+    bool art_missing;                            // One failed to load: draw lines instead
+    #endif
+} ListCache;
 
-// Generate spiral indices from center outward
-// Returns the order in which blocks should fill (0 = first to fill from center)
-static int spiral_out_index(int row, int col) {
-    int center_row = SPIRAL_ROWS / 2;
-    int center_col = SPIRAL_COLS / 2;
-    
-    // Distance from center determines spiral ring
-    int dr = row - center_row;
-    int dc = col - center_col;
-    int ring = (dr < 0 ? -dr : dr);
-    int dc_abs = (dc < 0 ? -dc : dc);
-    if (dc_abs > ring) ring = dc_abs;
-    
-    if (ring == 0) return 0;  // Center block
-    
-    // Calculate position within ring (clockwise from top)
-    int ring_start = (2 * ring - 1) * (2 * ring - 1);  // First index in this ring
-    int ring_size = 8 * ring;  // Number of blocks in this ring
-    
-    int pos = 0;
-    if (row == center_row - ring) {
-        // Top edge: left to right
-        pos = (col - (center_col - ring));
-    } else if (col == center_col + ring) {
-        // Right edge: top to bottom
-        pos = (2 * ring) + (row - (center_row - ring));
-    } else if (row == center_row + ring) {
-        // Bottom edge: right to left
-        pos = (4 * ring) + ((center_col + ring) - col);
-    } else if (col == center_col - ring) {
-        // Left edge: bottom to top
-        pos = (6 * ring) + ((center_row + ring) - row);
+static ListCache *s_list;
+
+#if VECTOR_ART_ENABLED
+static const uint32_t s_art_resources[DISPLAY_ART_COUNT] = {
+    [DISPLAY_ART_HOURGLASS]   = RESOURCE_ID_ART_HOURGLASS,
+    [DISPLAY_ART_WATER_GLASS] = RESOURCE_ID_ART_WATER_GLASS,
+    [DISPLAY_ART_WATER_MARKS] = RESOURCE_ID_ART_WATER_MARKS,
+    [DISPLAY_ART_CLOCK_FACE]  = RESOURCE_ID_ART_CLOCK_FACE,
+};
+#endif
+
+static ListCache *list_cache_create(void) {
+    ListCache *cache = calloc(1, sizeof(ListCache));
+    if (cache) {
+        display_list_history_invalidate(&cache->history);
     }
-    
-    return ring_start + (pos % ring_size);
+    return cache;
 }
 
-void display_draw_spiral_out(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int available_width = bounds.size.w - 20;
-    int available_height = bounds.size.h - 60;
-    
-    int block_width = (available_width - (SPIRAL_COLS - 1) * SPIRAL_PADDING) / SPIRAL_COLS;
-    int block_height = (available_height - (SPIRAL_ROWS - 1) * SPIRAL_PADDING) / SPIRAL_ROWS;
-    int block_size = (block_width < block_height) ? block_width : block_height;
-    
-    int grid_width = SPIRAL_COLS * block_size + (SPIRAL_COLS - 1) * SPIRAL_PADDING;
-    int grid_height = SPIRAL_ROWS * block_size + (SPIRAL_ROWS - 1) * SPIRAL_PADDING;
-    int start_x = (bounds.size.w - grid_width) / 2;
-    int start_y = (bounds.size.h - grid_height) / 2 - 10;
-    
-    int total_blocks = SPIRAL_COLS * SPIRAL_ROWS;
-    int filled_blocks = progress_calculate_blocks(dctx->remaining_seconds, dctx->total_seconds, total_blocks);
-    
-    for (int row = 0; row < SPIRAL_ROWS; row++) {
-        for (int col = 0; col < SPIRAL_COLS; col++) {
-            int spiral_idx = spiral_out_index(row, col);
-            int x = start_x + col * (block_size + SPIRAL_PADDING);
-            int y = start_y + row * (block_size + SPIRAL_PADDING);
-            GRect block_rect = GRect(x, y, block_size, block_size);
-            
-            // Spiral out fills from center, so lower spiral indices fill first
-            if (spiral_idx < filled_blocks) {
-                graphics_context_set_fill_color(ctx, c->primary);
-                graphics_fill_rect(ctx, block_rect, 2, GCornersAll);
-            } else {
-                graphics_context_set_stroke_color(ctx, c->secondary);
-                graphics_draw_round_rect(ctx, block_rect, 2);
+static void list_cache_destroy(ListCache *cache) {
+    #if VECTOR_ART_ENABLED
+        for (int i = 0; i < DISPLAY_ART_COUNT; i++) {
+            if (cache->art[i]) gdraw_command_image_destroy(cache->art[i]);
+        }
+    #endif
+    free(cache);
+}
+
+static bool list_activate(void) {
+    s_list = list_cache_create();
+    return s_list != NULL;
+}
+
+static void list_deactivate(void) {
+    list_cache_destroy(s_list);
+    s_list = NULL;
+}
+
+// Whether the list modes' outlines come as images this frame
+static bool list_vector_art(void) {
+    #if VECTOR_ART_ENABLED
+        return s_list && !s_list->art_missing;
+    #else
+        return false;
+    #endif
+}
+
+// Context setters, called only when the value changes (draw_batch.h)
+static void set_fill_color(GContext *ctx, DrawStateCache *state, GColor color) {
+    if (draw_state_fill(state, color.argb)) {
+        graphics_context_set_fill_color(ctx, color);
+    }
+}
+
+static void set_stroke(GContext *ctx, DrawStateCache *state, GColor color, int width) {
+    if (draw_state_stroke(state, color.argb)) {
+        graphics_context_set_stroke_color(ctx, color);
+    }
+    if (draw_state_stroke_width(state, (uint8_t)width)) {
+        graphics_context_set_stroke_width(ctx, (uint8_t)width);
+    }
+}
+
+static bool draw_list_sector(GContext *ctx, DrawStateCache *state, ListCache *cache, const DlPrim *prim,
+                             GColor color) {
+    if (prim->d <= 0 || 360 % prim->d != 0) return false;
+    int segments = 360 / prim->d;
+    int inner_r = prim->a - prim->b;
+
+    int16_t key[3] = { prim->a, (int16_t)inner_r, (int16_t)segments };
+    if (memcmp(key, cache->sector_key, sizeof(key)) != 0) {
+        if (!dl_sector_ring(cache->sector.ring, 0, 0, prim->a, inner_r, segments)) {
+            return false;
+        }
+        for (int i = 0; i < 2 * (segments + 1); i++) {
+            DlPoint p = cache->sector.ring[i];
+            cache->sector.points[i] = GPoint(p.x, p.y);
+        }
+        memcpy(cache->sector_key, key, sizeof(key));
+    }
+
+    int filled = prim->c / prim->d;
+    if (filled > segments) filled = segments;
+    GPath path = {
+        .num_points = (uint32_t)(2 * filled + 2),
+        .points = &cache->sector.points[segments - filled],
+        .rotation = 0,
+        .offset = GPoint(prim->rect.x, prim->rect.y)
+    };
+    set_fill_color(ctx, state, color);
+    gpath_draw_filled(ctx, &path);
+    return true;
+}
+
+static void draw_list_arc(GContext *ctx, DrawStateCache *state, ListCache *cache, const DlPrim *prim,
+                          GColor color) {
+    GPoint center = GPoint(prim->rect.x, prim->rect.y);
+    int sweep = prim->c;
+    int step = prim->d;
+
+    if (prim->flags == DL_ARC_SECTOR && draw_list_sector(ctx, state, cache, prim, color)) {
+        return;
+    }
+
+    if (prim->flags == DL_ARC_DOTS) {
+        int dot_radius = prim->b / 2;
+        int radius = prim->a - dot_radius;
+        set_fill_color(ctx, state, color);
+        for (int deg = 0; deg < sweep; deg += step) {
+            graphics_fill_circle(ctx, polar_point(center, deg, radius), dot_radius);
+        }
+        return;
+    }
+
+    // Wedges, also the fallback for sectors the cache can't hold
+    int outer_r = prim->a;
+    int inner_r = prim->a - prim->b;
+    set_stroke(ctx, state, color, prim->rect.w > 0 ? prim->rect.w : 3);
+    for (int deg = 0; deg < sweep; deg += step) {
+        GPoint p1 = polar_point(center, deg, inner_r);
+        GPoint p2 = polar_point(center, deg, outer_r);
+        GPoint p3 = polar_point(center, deg + step, outer_r);
+        graphics_draw_line(ctx, p1, p2);
+        graphics_draw_line(ctx, p2, p3);
+        graphics_draw_line(ctx, p3, p1);
+    }
+}
+
+// A band, over its track if it has one. Gauges (bands with a track) are
+// repainted in place, which only leaves the pixels unchanged when drawn
+// without antialiasing, so they go to the framebuffer; if it can't be
+// captured, the next frame starts over.
+static void draw_list_band(RasterSurface *surface, DisplayListHistory *history, const DlPrim *prim) {
+    GPoint center = GPoint(prim->rect.x, prim->rect.y);
+    int outer_r = prim->a;
+    int inner_r = prim->a - prim->b;
+
+    if (prim->d) {
+        raster_surface_fill_arc(surface, center, inner_r, outer_r, TRIG_MAX_ANGLE,
+                                (GColor){ .argb = (uint8_t)prim->d });
+        if (!raster_surface_is_direct(surface)) {
+            display_list_history_invalidate(history);
+        }
+        outer_r -= prim->rect.w;
+        inner_r += prim->rect.w;
+    }
+    raster_surface_fill_arc(surface, center, inner_r, outer_r, (int32_t)prim->c * TRIG_MAX_ANGLE / 360,
+                            (GColor){ .argb = prim->color });
+}
+
+#if VECTOR_ART_ENABLED
+static bool set_stroke_color(GDrawCommand *command, uint32_t index, void *context) {
+    gdraw_command_set_stroke_color(command, *(GColor *)context);
+    return true;
+}
+#endif
+
+// The images are white as built; their strokes take the primitive's color
+static void draw_list_image(GContext *ctx, ListCache *cache, DisplayListHistory *history, const DlPrim *prim) {
+    #if VECTOR_ART_ENABLED
+        int id = prim->flags;
+        if (id >= DISPLAY_ART_COUNT || cache->art_missing) return;
+
+        GDrawCommandImage *image = cache->art[id];
+        if (!image) {
+            image = gdraw_command_image_create_with_resource(s_art_resources[id]);
+            if (!image) {
+                // Start over next frame with lines
+                cache->art_missing = true;
+                display_list_history_invalidate(history);
+                return;
+            }
+            cache->art[id] = image;
+            cache->art_color[id] = (uint8_t)~prim->color;
+        }
+        if (cache->art_color[id] != prim->color) {
+            GColor color = (GColor){ .argb = prim->color };
+            gdraw_command_list_iterate(gdraw_command_image_get_command_list(image), set_stroke_color, &color);
+            cache->art_color[id] = prim->color;
+        }
+        gdraw_command_image_draw(ctx, image, GPoint(prim->rect.x, prim->rect.y));
+    #endif
+}
+
+static void draw_list_prim(GContext *ctx, DrawStateCache *state, ListCache *cache, DisplayListHistory *history,
+                           const DlPrim *prim) {
+    static const GTextAlignment alignments[] = {
+        GTextAlignmentLeft, GTextAlignmentCenter, GTextAlignmentRight
+    };
+    GColor color = (GColor){ .argb = prim->color };
+    GPoint origin = GPoint(prim->rect.x, prim->rect.y);
+
+    switch (prim->type) {
+        case DL_FILL_CIRCLE:
+            set_fill_color(ctx, state, color);
+            graphics_fill_circle(ctx, origin, prim->a);
+            break;
+        case DL_STROKE_CIRCLE:
+            set_stroke(ctx, state, color, prim->b);
+            graphics_draw_circle(ctx, origin, prim->a);
+            break;
+        case DL_LINE:
+            set_stroke(ctx, state, color, prim->c);
+            graphics_draw_line(ctx, origin, GPoint(prim->a, prim->b));
+            break;
+        case DL_ARC:
+            draw_list_arc(ctx, state, cache, prim, color);
+            break;
+        case DL_IMAGE:
+            // Draw commands set the context's colors themselves
+            draw_list_image(ctx, cache, history, prim);
+            draw_state_reset(state);
+            break;
+        case DL_TEXT:
+            if (draw_state_text(state, color.argb)) {
+                graphics_context_set_text_color(ctx, color);
             }
+            graphics_draw_text(ctx, prim->text, s_list_fonts[prim->font],
+                               GRect(prim->rect.x, prim->rect.y, prim->rect.w, prim->rect.h),
+                               GTextOverflowModeTrailingEllipsis, alignments[prim->flags], NULL);
+            break;
+        default:
+            break;
+    }
+}
+
+// Draw what `cache`'s plan issues from its list, which the plan recorded in
+// `history`. Incremental frames first clear the plan's damage inside `area`.
+// Primitives go in batches of one graphics state (draw_batch.h).
+static void execute_display_list(GContext *ctx, ListCache *cache, DisplayListHistory *history, GRect area,
+                                 bool full_redraw, GColor background) {
+    DisplayList *list = &cache->list;
+    DisplayListPlan *plan = &cache->plan;
+
+    // The surface stays open across runs of fills and gauges (and other
+    // bands where there is no native radial fill) and is ended before any
+    // graphics_* call. Closed, it draws through the SDK. Its state cache
+    // tracks the context for both; beginning it again forgets what it knew.
+    RasterSurface surface = { .ctx = ctx, .framebuffer = NULL };
+    bool surface_open = false;
+
+    if (!full_redraw) {
+        raster_surface_begin(&surface, ctx);
+        surface_open = true;
+        for (int i = 0; i < plan->damage_count; i++) {
+            const DlRect *d = &plan->damage[i];
+            GRect damage = GRect(d->x, d->y, d->w, d->h);
+            grect_clip(&damage, &area);
+            raster_surface_fill_rect(&surface, damage, 0, background);
         }
     }
-    
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect text_rect = GRect(0, start_y + grid_height + 5, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
+
+    uint8_t order[DISPLAY_LIST_MAX];
+    int count = draw_batch_order(list, plan, RASTER_NATIVE_RADIAL, order);
+    for (int n = 0; n < count; n++) {
+        const DlPrim *prim = &list->prims[order[n]];
+        bool band = prim->type == DL_ARC && prim->flags == DL_ARC_BAND;
+        bool raster = draw_state_for(prim, RASTER_NATIVE_RADIAL).kind == DRAW_STATE_RASTER;
+        if (raster && !surface_open) {
+            raster_surface_begin(&surface, ctx);
+            surface_open = true;
+        } else if (!raster && surface_open) {
+            raster_surface_end(&surface);
+            surface_open = false;
+        }
+
+        if (prim->type == DL_FILL_RECT) {
+            raster_surface_fill_rect(&surface, GRect(prim->rect.x, prim->rect.y, prim->rect.w, prim->rect.h),
+                                     prim->a, (GColor){ .argb = prim->color });
+        } else if (band) {
+            draw_list_band(&surface, history, prim);
+        } else {
+            draw_list_prim(ctx, &surface.state, cache, history, prim);
+        }
+    }
+
+    if (surface_open) {
+        raster_surface_end(&surface);
     }
 }
 
+static DisplayInput display_input_for(GRect bounds, const DisplayContext *dctx, const HourglassState *hourglass,
+                                      const WaterState *water) {
+    const VisualizationColors *c = dctx->colors;
+    DisplayInput in = {
+        .width = bounds.size.w,
+        .height = bounds.size.h,
+        .remaining_seconds = dctx->remaining_seconds,
+        .total_seconds = dctx->total_seconds,
+        .running = dctx->state == STATE_RUNNING,
+        .sand = hourglass ? hourglass->sand.rows : NULL,
+        .water = water ? &water->surface : NULL,
+        .background = c->background.argb,
+        .primary = c->primary.argb,
+        .secondary = c->secondary.argb,
+        .accent = c->accent.argb,
+        .hint = COLOR_HINT.argb,
+        .vector_art = list_vector_art()
+    };
+    return in;
+}
+
+static void draw_list_mode(GContext *ctx, GRect bounds, const DisplayContext *dctx, const AnimationState *anim) {
+    DisplayInput in = display_input_for(bounds, dctx, &anim->hourglass, &anim->water);
+    display_emit(&s_list->list, dctx->display_mode, &in);
+    if (reflowing(dctx->display_mode)) {
+        list_reflow_apply(&s_reflow->list, &s_list->list, s_reflow->progress);
+    }
+    display_list_plan(&s_list->history, &s_list->list, bounds.size.w, bounds.size.h, dctx->full_redraw,
+                      &s_list->plan);
+
+    // Note whether the art reaches under the time overlay, and whether this
+    // frame paints over it
+    DlRect text = { s_time_extent.origin.x, s_time_extent.origin.y, s_time_extent.size.w, s_time_extent.size.h };
+    s_time_on_art = display_list_touches(&s_list->list, text);
+    if (display_list_plan_touches(&s_list->plan, &s_list->list, text)) {
+        s_time_exposed = true;
+    }
+
+    execute_display_list(ctx, s_list, &s_list->history, bounds, dctx->full_redraw, dctx->colors->background);
+}
+
+// In the slot the mode's layout leaves for it
+static void list_time(GRect bounds, const DisplayContext *dctx, DisplayTimeOverlay *overlay) {
+    DisplayInput in = display_input_for(bounds, dctx, NULL, NULL);
+    DisplayTimeSlot slot;
+    if (!display_emit_time_slot(dctx->display_mode, &in, &slot)) {
+        overlay->shown = false;
+        return;
+    }
+    overlay->frame = GRect(slot.rect.x, slot.rect.y, slot.rect.w, slot.rect.h);
+    overlay->size = (NumeralSize)(slot.font - DL_FONT_NUMERAL_SMALL);
+}
+
 // =============================================================================
-// Percent Elapsed Mode
+// Mode Registry
 // =============================================================================
+// The drawing side of each mode, indexed like the pure descriptors in
+// mode_registry.c. Only the mode on screen holds caches: display_draw
+// activates a mode when it first draws it and deactivates the one before.
 
-void display_draw_percent(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int center_y = bounds.size.h / 2;
-    
-    // Calculate elapsed percentage
-    int percent = 0;
-    if (dctx->total_seconds > 0) {
-        int elapsed = dctx->total_seconds - dctx->remaining_seconds;
-        percent = (elapsed * 100) / dctx->total_seconds;
+// Colors by their SDK names without the GColor prefix
+#ifdef PBL_COLOR
+  #define PALETTE(p, s, a, mono) { \
+      .background = { .argb = GColorBlackARGB8 }, .primary = { .argb = GColor##p##ARGB8 }, \
+      .secondary = { .argb = GColor##s##ARGB8 }, .accent = { .argb = GColor##a##ARGB8 } }
+#else
+  #define PALETTE(p, s, a, mono) mono
+#endif
+
+// Monochrome tones: raster fills dither the grays; SDK strokes and text
+// round them to black or white, so those stay at white or light gray
+#define MONO(p, s, a) { \
+    .background = { .argb = GColorBlackARGB8 }, .primary = { .argb = GColor##p##ARGB8 }, \
+    .secondary = { .argb = GColor##s##ARGB8 }, .accent = { .argb = GColor##a##ARGB8 } }
+
+#define GRID_MODE(draw_fn, time_fn, palette_) { \
+    .palette = palette_, .incremental = true, .scratch_bytes = GRID_SCRATCH_BYTES, \
+    .activate = grid_activate, .deactivate = grid_deactivate, .draw = draw_fn, .place_time = time_fn }
+#define LIST_MODE(palette_) { \
+    .palette = palette_, .incremental = true, \
+    .activate = list_activate, .deactivate = list_deactivate, .draw = draw_list_mode, .place_time = list_time }
+
+static const DisplayModeOps s_mode_ops[DISPLAY_MODE_COUNT] = {
+    [DISPLAY_MODE_TEXT]              = { .palette = PALETTE(White, LightGray, White, MONO(White, LightGray, White)) },
+    [DISPLAY_MODE_BLOCKS]            = GRID_MODE(draw_blocks, blocks_time,
+                                                 PALETTE(VividCerulean, DarkGray, VividCerulean, MONO(White, DarkGray, White))),
+    [DISPLAY_MODE_VERTICAL_BLOCKS]   = GRID_MODE(draw_vertical_blocks, vertical_blocks_time,
+                                                 PALETTE(VividCerulean, DarkGray, VividCerulean, MONO(White, DarkGray, White))),
+    [DISPLAY_MODE_CLOCK]             = LIST_MODE(PALETTE(Melon, White, Red, MONO(LightGray, White, White))),
+    [DISPLAY_MODE_RING]              = LIST_MODE(PALETTE(Cyan, DarkGray, Cyan, MONO(White, DarkGray, White))),
+    [DISPLAY_MODE_HOURGLASS]         = LIST_MODE(PALETTE(Rajah, White, Rajah, MONO(LightGray, White, LightGray))),
+    [DISPLAY_MODE_BINARY]            = LIST_MODE(PALETTE(MintGreen, DarkGray, MintGreen, MONO(White, DarkGray, White))),
+    [DISPLAY_MODE_RADIAL]            = LIST_MODE(PALETTE(Red, Orange, Yellow, MONO(White, LightGray, White))),
+    [DISPLAY_MODE_HEX]               = LIST_MODE(PALETTE(VividViolet, LightGray, VividViolet, MONO(White, LightGray, White))),
+    [DISPLAY_MODE_MATRIX]            = { .palette = PALETTE(BrightGreen, Green, DarkGreen, MONO(White, LightGray, LightGray)),
+                                         .incremental = true,
+                                         .activate = matrix_activate, .deactivate = matrix_deactivate,
+                                         .draw = draw_matrix, .place_time = matrix_time },
+    [DISPLAY_MODE_WATER_LEVEL]       = LIST_MODE(PALETTE(VividCerulean, White, VividCerulean, MONO(LightGray, White, White))),
+    [DISPLAY_MODE_SPIRAL_OUT]        = GRID_MODE(draw_spiral_out, spiral_out_time,
+                                                 PALETTE(Magenta, DarkGray, Magenta, MONO(White, DarkGray, White))),
+    [DISPLAY_MODE_SPIRAL_IN]         = GRID_MODE(draw_spiral_in, spiral_in_time,
+                                                 PALETTE(Magenta, DarkGray, Magenta, MONO(White, DarkGray, White))),
+    [DISPLAY_MODE_PERCENT]           = LIST_MODE(PALETTE(ChromeYellow, DarkGray, ChromeYellow, MONO(White, DarkGray, White))),
+    [DISPLAY_MODE_PERCENT_REMAINING] = LIST_MODE(PALETTE(ChromeYellow, DarkGray, ChromeYellow, MONO(White, DarkGray, White))),
+};
+
+const DisplayModeOps *display_mode_ops(DisplayMode mode) {
+    if ((unsigned)mode >= DISPLAY_MODE_COUNT) {
+        mode = DISPLAY_MODE_TEXT;
     }
-    
-    // Large percentage display
-    static char percent_buf[8];
-    snprintf(percent_buf, sizeof(percent_buf), "%d%%", percent);
-    
-    GFont large_font = fonts_get_system_font(FONT_KEY_BITHAM_42_BOLD);
-    GRect percent_rect = GRect(0, center_y - 35, bounds.size.w, 50);
-    graphics_context_set_text_color(ctx, c->primary);
-    graphics_draw_text(ctx, percent_buf, large_font, percent_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-    
-    // "elapsed" label
-    GFont label_font = fonts_get_system_font(FONT_KEY_GOTHIC_14);
-    GRect label_rect = GRect(0, center_y - 55, bounds.size.w, 20);
-    graphics_context_set_text_color(ctx, c->primary);
-    graphics_draw_text(ctx, "elapsed", label_font, label_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-    
-    // Progress bar
-    int bar_y = center_y + 25;
-    int bar_height = 12;
-    int bar_margin = 20;
-    int bar_width = bounds.size.w - bar_margin * 2;
-    
-    // Background bar
-    graphics_context_set_fill_color(ctx, c->secondary);
-    graphics_fill_rect(ctx, GRect(bar_margin, bar_y, bar_width, bar_height), 4, GCornersAll);
-    
-    // Filled portion (elapsed)
-    if (dctx->total_seconds > 0) {
-        int elapsed = dctx->total_seconds - dctx->remaining_seconds;
-        int progress_width = (elapsed * bar_width) / dctx->total_seconds;
-        if (progress_width > 0) {
-            graphics_context_set_fill_color(ctx, c->primary);
-            graphics_fill_rect(ctx, GRect(bar_margin, bar_y, progress_width, bar_height), 4, GCornersAll);
-        }
+    return &s_mode_ops[mode];
+}
+
+// The mode holding caches, and whether its activation succeeded
+static DisplayMode s_active_mode = DISPLAY_MODE_COUNT;
+static bool s_active_ready = false;
+
+static void display_deactivate(void) {
+    if (s_active_mode < DISPLAY_MODE_COUNT && s_active_ready && s_mode_ops[s_active_mode].deactivate) {
+        s_mode_ops[s_active_mode].deactivate();
     }
-    
-    // Remaining time below
-    if (!dctx->hide_time_text) {
-        GFont time_font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect time_rect = GRect(0, bar_y + bar_height + 10, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, time_rect, time_font);
+    free(s_scratch_block);
+    s_scratch_block = NULL;
+    arena_init(&s_scratch, NULL, 0);
+    s_active_mode = DISPLAY_MODE_COUNT;
+    s_active_ready = false;
+}
+
+void display_release(void) {
+    display_reflow_end();
+    display_transition_end();
+    display_deactivate();
+    #if FRAME_CACHE_ENABLED
+        free(s_frame_cache.pixels);
+        frame_cache_init(&s_frame_cache, NULL, 0);
+        s_frame_cache_tried = false;
+    #endif
+}
+
+// Make `mode` the one holding caches; sets *fresh when it wasn't already.
+// Returns false if its caches don't fit, and tries again next frame.
+static bool display_activate(DisplayMode mode, bool *fresh) {
+    *fresh = false;
+    if (mode == s_active_mode && s_active_ready) return true;
+
+    display_deactivate();
+    const DisplayModeOps *ops = &s_mode_ops[mode];
+    s_active_mode = mode;
+    s_active_ready = !ops->activate || ops->activate();
+    if (s_active_ready && ops->scratch_bytes > 0) {
+        s_scratch_block = malloc(ops->scratch_bytes);
+        if (!s_scratch_block) {
+            if (ops->deactivate) ops->deactivate();
+            s_active_ready = false;
+        }
     }
+    arena_init(&s_scratch, s_scratch_block, ops->scratch_bytes);
+    *fresh = true;
+    return s_active_ready;
 }
 
 // =============================================================================
-// Percent Remaining Mode
+// Time Overlay
 // =============================================================================
+// The m:ss text has its own layer on top of the canvas, so neither redraws
+// for the other: a new time repaints just the glyph cells that changed, and
+// canvas frames leave the text alone unless they paint over it. Where the art
+// reaches under the text (Ring and Radial with long times), or the text went
+// through a system font, changing or hiding it has the canvas restore what
+// lies beneath first.
 
-void display_draw_percent_remaining(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int center_y = bounds.size.h / 2;
-    
-    // Calculate remaining percentage
-    int percent = 0;
-    if (dctx->total_seconds > 0) {
-        percent = (dctx->remaining_seconds * 100) / dctx->total_seconds;
+// Screen area the overlay's last draw covers, or false if it has drawn
+// nothing since it was last cleared
+static bool time_overlay_extent(GRect *extent) {
+    if (s_time_text.valid) {
+        *extent = GRect(s_time_text.x, s_time_text.y,
+                        numeral_font_text_width(s_time_text.font, s_time_text.len), s_time_text.font->height);
+        return true;
     }
-    
-    // Large percentage display
-    static char percent_buf[8];
-    snprintf(percent_buf, sizeof(percent_buf), "%d%%", percent);
-    
-    GFont large_font = fonts_get_system_font(FONT_KEY_BITHAM_42_BOLD);
-    GRect percent_rect = GRect(0, center_y - 35, bounds.size.w, 50);
-    graphics_context_set_text_color(ctx, c->primary);
-    graphics_draw_text(ctx, percent_buf, large_font, percent_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-    
-    // "remaining" label
-    GFont label_font = fonts_get_system_font(FONT_KEY_GOTHIC_14);
-    GRect label_rect = GRect(0, center_y - 55, bounds.size.w, 20);
-    graphics_context_set_text_color(ctx, c->primary);
-    graphics_draw_text(ctx, "remaining", label_font, label_rect,
-                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
-    
-    // Progress bar
-    int bar_y = center_y + 25;
-    int bar_height = 12;
-    int bar_margin = 20;
-    int bar_width = bounds.size.w - bar_margin * 2;
-    
-    // Background bar
-    graphics_context_set_fill_color(ctx, c->secondary);
-    graphics_fill_rect(ctx, GRect(bar_margin, bar_y, bar_width, bar_height), 4, GCornersAll);
-    
-    // Filled portion (remaining)
-    if (dctx->total_seconds > 0) {
-        int progress_width = (dctx->remaining_seconds * bar_width) / dctx->total_seconds;
-        if (progress_width > 0) {
-            graphics_context_set_fill_color(ctx, c->primary);
-            graphics_fill_rect(ctx, GRect(bar_margin, bar_y, progress_width, bar_height), 4, GCornersAll);
-        }
+    if (s_time_text_system) {
+        *extent = s_time_frame;
+        return true;
     }
-    
-    // Remaining time below
-    if (!dctx->hide_time_text) {
-        GFont time_font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect time_rect = GRect(0, bar_y + bar_height + 10, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, time_rect, time_font);
+    return false;
+}
+
+DisplayTimeOverlay display_time_overlay(GRect bounds, const TimerContext *timer, const VisualizationColors *palettes) {
+    DisplayMode mode = (timer->display_mode < DISPLAY_MODE_COUNT) ? timer->display_mode : DISPLAY_MODE_TEXT;
+    const VisualizationColors *c = &palettes[mode];
+    DisplayContext dctx = display_context_from_timer(timer, c);
+    dctx.display_mode = mode;
+
+    DisplayTimeOverlay overlay = {
+        .frame = GRect(0, 0, 0, 0),
+        .size = NUMERAL_SIZE_MEDIUM,
+        .color = COLOR_TEXT_NORMAL,
+        .background = c->background,
+        .plate = false,
+        .shown = !timer->hide_time_text
+    };
+
+    const DisplayModeOps *ops = &s_mode_ops[mode];
+    if (ops->place_time) {
+        ops->place_time(bounds, &dctx, &overlay);
+    } else {
+        overlay.shown = false;
     }
+    if (reflowing(mode)) {
+        GRect a = s_reflow->time_from;
+        GRect b = s_reflow->time_to;
+        DlRect r = reflow_rect((DlRect){ a.origin.x, a.origin.y, a.size.w, a.size.h },
+                               (DlRect){ b.origin.x, b.origin.y, b.size.w, b.size.h }, s_reflow->progress);
+        overlay.frame = GRect(r.x, r.y, r.w, r.h);
+    }
+    return overlay;
+}
+
+void display_draw_time_overlay(GContext *ctx, const DisplayTimeOverlay *overlay, int remaining_seconds,
+                               bool full_redraw) {
+    char time_buf[16];
+    time_format_adaptive(remaining_seconds, time_buf, sizeof(time_buf));
+
+    // `ctx` belongs to the overlay layer: SDK calls are relative to its frame,
+    // the framebuffer is not
+    GRect frame = overlay->frame;
+    GRect local = GRect(0, 0, frame.size.w, frame.size.h);
+    if (full_redraw && overlay->plate) {
+        graphics_context_set_fill_color(ctx, overlay->background);
+        graphics_fill_rect(ctx, GRect(5, 2, frame.size.w - 10, frame.size.h - 4), 4, GCornersAll);
+    }
+
+    const NumeralFont *font = &s_numeral_fonts[overlay->size];
+    if (numeral_font_supports(font, time_buf)) {
+        RasterSurface surface;
+        raster_surface_begin(&surface, ctx);
+        if (raster_surface_is_direct(&surface)) {
+            numeral_text_draw(&s_time_text, font, &surface.target, time_buf, frame.origin.x, frame.origin.y,
+                              frame.size.w, frame.size.h, overlay->color.argb, overlay->background.argb,
+                              !full_redraw && !s_time_text_system);
+            raster_surface_end(&surface);
+            s_time_text_system = false;
+            return;
+        }
+        raster_surface_end(&surface);
+    }
+
+    // A system font draws transparently and may spill past the glyph cells,
+    // so from here on the canvas clears the frame before each change
+    s_time_text.valid = false;
+    s_time_text_system = true;
+    s_time_frame = frame;
+    graphics_context_set_text_color(ctx, overlay->color);
+    graphics_draw_text(ctx, time_buf, s_fallback_fonts[overlay->size], local,
+                       GTextOverflowModeTrailingEllipsis, GTextAlignmentCenter, NULL);
+}
+
+bool display_time_overlay_needs_canvas(void) {
+    return s_time_text_system || s_time_on_art;
 }
 
 // =============================================================================
-// Spiral In Mode
+// Unobstructed Area Reflow
 // =============================================================================
+// Both layouts are made here, once per slide: the time overlay's frames, and
+// for a list mode on screen, the list at either end (emitted in turn into
+// its own buffer, which the next frame emits over). The grid modes and
+// Matrix just lay out for the bounds they're drawn with.
 
-void display_draw_spiral_in(GContext *ctx, GRect bounds, const DisplayContext *dctx) {
-    const VisualizationColors *c = dctx->colors;
-    int available_width = bounds.size.w - 20;
-    int available_height = bounds.size.h - 60;
-    
-    int block_width = (available_width - (SPIRAL_COLS - 1) * SPIRAL_PADDING) / SPIRAL_COLS;
-    int block_height = (available_height - (SPIRAL_ROWS - 1) * SPIRAL_PADDING) / SPIRAL_ROWS;
-    int block_size = (block_width < block_height) ? block_width : block_height;
-    
-    int grid_width = SPIRAL_COLS * block_size + (SPIRAL_COLS - 1) * SPIRAL_PADDING;
-    int grid_height = SPIRAL_ROWS * block_size + (SPIRAL_ROWS - 1) * SPIRAL_PADDING;
-    int start_x = (bounds.size.w - grid_width) / 2;
-    int start_y = (bounds.size.h - grid_height) / 2 - 10;
-    
-    int total_blocks = SPIRAL_COLS * SPIRAL_ROWS;
-    int filled_blocks = progress_calculate_blocks(dctx->remaining_seconds, dctx->total_seconds, total_blocks);
-    
-    for (int row = 0; row < SPIRAL_ROWS; row++) {
-        for (int col = 0; col < SPIRAL_COLS; col++) {
-            int spiral_idx = spiral_out_index(row, col);
-            // Invert: higher spiral index (outer) fills first
-            int inverted_idx = (total_blocks - 1) - spiral_idx;
-            int x = start_x + col * (block_size + SPIRAL_PADDING);
-            int y = start_y + row * (block_size + SPIRAL_PADDING);
-            GRect block_rect = GRect(x, y, block_size, block_size);
-            
-            // Spiral in fills from outside, so higher spiral indices fill first
-            if (inverted_idx < filled_blocks) {
-                graphics_context_set_fill_color(ctx, c->primary);
-                graphics_fill_rect(ctx, block_rect, 2, GCornersAll);
-            } else {
-                graphics_context_set_stroke_color(ctx, c->secondary);
-                graphics_draw_round_rect(ctx, block_rect, 2);
-            }
-        }
+void display_reflow_begin(GRect from, GRect to, const TimerContext *timer, const AnimationState *anim,
+                          const VisualizationColors *palettes) {
+    display_reflow_end();
+    DisplayMode mode = (timer->display_mode < DISPLAY_MODE_COUNT) ? timer->display_mode : DISPLAY_MODE_TEXT;
+    GRect time_from = display_time_overlay(from, timer, palettes).frame;
+    GRect time_to = display_time_overlay(to, timer, palettes).frame;
+
+    // Without the memory, the slide jumps to the end layout
+    s_reflow = malloc(sizeof(DisplayReflow));
+    if (!s_reflow) return;
+    s_reflow->mode = mode;
+    s_reflow->progress = 0;
+    s_reflow->time_from = time_from;
+    s_reflow->time_to = time_to;
+    s_reflow->list.count = 0;
+
+    if (display_emit_supports(mode) && mode == s_active_mode && s_active_ready) {
+        DisplayContext dctx = display_context_from_timer(timer, &palettes[mode]);
+        dctx.display_mode = mode;
+        DisplayInput in = display_input_for(from, &dctx, &anim->hourglass, &anim->water);
+        display_emit(&s_list->list, mode, &in);
+        list_reflow_from(&s_reflow->list, &s_list->list);
+
+        in.width = to.size.w;
+        in.height = to.size.h;
+        display_emit(&s_list->list, mode, &in);
+        list_reflow_to(&s_reflow->list, &s_list->list);
     }
-    
-    if (!dctx->hide_time_text) {
-        GFont font = fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD);
-        GRect text_rect = GRect(0, start_y + grid_height + 5, bounds.size.w, 30);
-        draw_time_text(ctx, dctx->remaining_seconds, text_rect, font);
+}
+
+void display_reflow_set_progress(int32_t progress) {
+    if (s_reflow) {
+        s_reflow->progress = progress;
     }
 }
 
+void display_reflow_end(void) {
+    free(s_reflow);
+    s_reflow = NULL;
+}
+
 // =============================================================================
 // Master Draw Function
 // =============================================================================
 
-void display_draw(GContext *ctx, GRect bounds, const TimerContext *timer, AnimationState *anim, const VisualizationColors *palettes) {
+bool display_draw(GContext *ctx, GRect bounds, const TimerContext *timer, const AnimationState *anim,
+                  const VisualizationColors *palettes, bool full_redraw, bool reveal_overlay) {
     DisplayMode mode = timer->display_mode;
     if (mode >= DISPLAY_MODE_COUNT) {
         mode = DISPLAY_MODE_TEXT;
     }
     
+    const DisplayModeOps *ops = &s_mode_ops[mode];
+    bool fresh;
+    bool ready = display_activate(mode, &fresh);
+    arena_reset(&s_scratch);
+    
     const VisualizationColors *colors = &palettes[mode];
     DisplayContext dctx = display_context_from_timer(timer, colors);
     dctx.display_mode = mode;
+    dctx.full_redraw = full_redraw || fresh || !ops->incremental;
+    dither_palette(colors);
+    dctx.anim_alpha = animation_alpha(anim);
+    
+    // A full frame clears the overlay's text along with everything else
+    if (dctx.full_redraw) {
+        s_time_text.valid = false;
+        s_time_text_system = false;
+    }
     
-    // Clear background
-    graphics_context_set_fill_color(ctx, colors->background);
-    graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+    // Where the time overlay is (its frame until it has drawn), for the modes
+    // to check against
+    bool overlay_drawn = time_overlay_extent(&s_time_extent);
+    if (!overlay_drawn) {
+        s_time_extent = display_time_overlay(bounds, timer, palettes).frame;
+    }
+    s_time_exposed = dctx.full_redraw;
+    s_time_on_art = false;
+    
+    // Clear background, through the raster surface like the incremental
+    // clears so a dithered background matches
+    if (dctx.full_redraw) {
+        RasterSurface surface;
+        raster_surface_begin(&surface, ctx);
+        raster_surface_fill_rect(&surface, bounds, 0, colors->background);
+        raster_surface_end(&surface);
+    } else if (reveal_overlay && overlay_drawn) {
+        // List modes redraw whatever their art has there; the others keep
+        // their art clear of the overlay
+        if (display_emit_supports(mode)) {
+            DlRect text = { s_time_extent.origin.x, s_time_extent.origin.y,
+                            s_time_extent.size.w, s_time_extent.size.h };
+            display_list_history_reveal(&s_list->history, text);
+        } else {
+            RasterSurface surface;
+            raster_surface_begin(&surface, ctx);
+            raster_surface_fill_rect(&surface, s_time_extent, 0, colors->background);
+            raster_surface_end(&surface);
+        }
+        s_time_exposed = true;
+    }
+    if (reveal_overlay) {
+        s_time_text.valid = false;
+        s_time_text_system = false;
+    }
     
-    switch (mode) {
-        case DISPLAY_MODE_BLOCKS:
-            display_draw_blocks(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_VERTICAL_BLOCKS:
-            display_draw_vertical_blocks(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_CLOCK:
-            display_draw_clock(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_RING:
-            display_draw_ring(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_HOURGLASS:
-            display_draw_hourglass(ctx, bounds, &dctx, &anim->hourglass);
-            break;
-        case DISPLAY_MODE_BINARY:
-            display_draw_binary(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_RADIAL:
-            display_draw_radial(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_HEX:
-            display_draw_hex(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_MATRIX:
-            display_draw_matrix(ctx, bounds, &dctx, &anim->matrix);
-            break;
-        case DISPLAY_MODE_WATER_LEVEL:
-            display_draw_water_level(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_SPIRAL_OUT:
-            display_draw_spiral_out(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_SPIRAL_IN:
-            display_draw_spiral_in(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_PERCENT:
-            display_draw_percent(ctx, bounds, &dctx);
-            break;
-        case DISPLAY_MODE_PERCENT_REMAINING:
-            display_draw_percent_remaining(ctx, bounds, &dctx);
-            break;
-        default:
-            break;
+    // Without its caches a mode shows just its background
+    if (ready && ops->draw) {
+        ops->draw(ctx, bounds, &dctx, anim);
+    }
+    return s_time_exposed;
+}
+
+
+// =============================================================================
+// Dashboard
+// =============================================================================
+// The tiles share one list cache (list, plan and sector ring) and one grid
+// state for each grid layout on show; each tile keeps the history of what it
+// last drew. A tile whose timer, selection and palette are as they were is
+// skipped, and one that changed repaints only what its plan says.
+
+typedef struct {
+    bool valid;                   // The framebuffer holds its last frame
+    DisplayListHistory history;
+    GridState *grid;              // Grid modes: the state it uses, and its cells
+    GridBitset filled;
+} DashboardTile;
+
+typedef struct {
+    ListCache *list;
+    GridState *grids[DASHBOARD_MAX_TIMERS];   // Allocated as grid tiles need them
+    DashboardTile tiles[DASHBOARD_MAX_TIMERS];
+    SandGrid sand;                            // Hourglass tiles, settled for their progress
+    DisplayTileState state;                   // What the framebuffer holds of each tile
+} DashboardCache;
+
+static DashboardCache *s_dashboard;
+
+static FrameKey dashboard_tile_key(const DashboardTimer *timer, const VisualizationColors *c, int density,
+                                   bool selected) {
+    FrameKey key = FRAME_KEY_INIT;
+    key = frame_key_add(key, (uint32_t)timer->display_mode | (uint32_t)density << 8 | (uint32_t)selected << 16);
+    key = frame_key_add(key, (uint32_t)timer->remaining_seconds);
+    key = frame_key_add(key, (uint32_t)timer->total_seconds);
+    key = frame_key_add(key, (uint32_t)c->background.argb | (uint32_t)c->primary.argb << 8 |
+                             (uint32_t)c->secondary.argb << 16 | (uint32_t)c->accent.argb << 24);
+    return key;
+}
+
+// The grid state for `spec` in a width x height area: one a tile before this
+// one set up, or a free one set up now. NULL without the memory.
+static GridState *dashboard_grid(const GridSpec *spec, int width, int height, unsigned *claimed) {
+    for (int i = 0; i < DASHBOARD_MAX_TIMERS; i++) {
+        GridState *grid = s_dashboard->grids[i];
+        if (grid && grid_state_matches(grid, spec, width, height)) {
+            *claimed |= 1u << i;
+            return grid;
+        }
+    }
+    for (int i = 0; i < DASHBOARD_MAX_TIMERS; i++) {
+        if (*claimed & (1u << i)) continue;
+        if (!s_dashboard->grids[i]) {
+            s_dashboard->grids[i] = calloc(1, sizeof(GridState));
+            if (!s_dashboard->grids[i]) return NULL;
+        }
+        grid_state_configure(s_dashboard->grids[i], spec, width, height);
+        *claimed |= 1u << i;
+        return s_dashboard->grids[i];
+    }
+    return NULL;
+}
+
+static void draw_dashboard_grid(GContext *ctx, DashboardTile *tile, GRect art, const DashboardTimer *timer,
+                                const VisualizationColors *c, bool full_redraw) {
+    const GridLayout *layout = &tile->grid->layout;
+    int total_cells = layout->cols * layout->rows;
+    int filled_cells = progress_calculate_blocks(timer->remaining_seconds, timer->total_seconds, total_cells);
+    GridBitset next;
+    grid_state_bitset_for(tile->grid, filled_cells, &next);
+
+    RasterSurface surface;
+    raster_surface_begin(&surface, ctx);
+    draw_grid_cells(&surface, layout, art.origin, NULL, total_cells, &next, full_redraw ? NULL : &tile->filled, c);
+    raster_surface_end(&surface);
+    tile->filled = next;
+}
+
+static void draw_dashboard_tile(GContext *ctx, GRect bounds, ListCache *list, SandGrid *sand, DashboardTile *tile,
+                                DlRect rect, const DashboardTimer *timer, const VisualizationColors *c,
+                                bool selected) {
+    bool full_redraw = !tile->valid;
+    GRect area = GRect(rect.x, rect.y, rect.w, rect.h);
+    dither_palette(c);
+    if (full_redraw) {
+        RasterSurface surface;
+        raster_surface_begin(&surface, ctx);
+        raster_surface_fill_rect(&surface, area, 0, c->background);
+        raster_surface_end(&surface);
+    }
+
+    DisplayContext dctx = {
+        .remaining_seconds = timer->remaining_seconds,
+        .total_seconds = timer->total_seconds,
+        .state = timer->remaining_seconds > 0 ? STATE_RUNNING : STATE_COMPLETED,
+        .display_mode = timer->display_mode,
+        .full_redraw = full_redraw,
+        .colors = c
+    };
+    DisplayInput in = display_input_for(bounds, &dctx, NULL, NULL);
+    if (timer->display_mode == DISPLAY_MODE_HOURGLASS && timer->total_seconds > 0) {
+        int elapsed = timer->total_seconds - timer->remaining_seconds;
+        sand_init(sand, elapsed * SAND_GRAINS / timer->total_seconds);
+        in.sand = sand->rows;
+    }
+
+    display_emit_tile(&list->list, timer->display_mode, &in, rect, selected);
+    display_list_plan(&tile->history, &list->list, bounds.size.w, bounds.size.h, full_redraw, &list->plan);
+    execute_display_list(ctx, list, &tile->history, area, full_redraw, c->background);
+
+    if (tile->grid) {
+        DlRect art = display_tile_art(rect);
+        draw_dashboard_grid(ctx, tile, GRect(art.x, art.y, art.w, art.h), timer, c, full_redraw);
     }
 }
 
+void display_draw_dashboard(GContext *ctx, GRect bounds, const Dashboard *dashboard, const TimerContext *timer,
+                            const VisualizationColors *palettes, bool full_redraw) {
+    if (!s_dashboard) {
+        s_dashboard = calloc(1, sizeof(DashboardCache));
+        if (s_dashboard) {
+            s_dashboard->list = list_cache_create();
+        }
+        if (!s_dashboard || !s_dashboard->list) {
+            display_dashboard_release();
+            graphics_context_set_fill_color(ctx, GColorBlack);
+            graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+            return;
+        }
+    }
+
+    DlRect tiles[DISPLAY_TILE_MAX];
+    display_tile_layout(dashboard->count, bounds.size.w, bounds.size.h, tiles);
+    // Grids are laid out for the first tile's art area, the smallest, so
+    // tiles of a mode share them
+    DlRect art = display_tile_art(tiles[0]);
+    unsigned claimed = 0;
+    unsigned missing = 0;
+    FrameKey keys[DASHBOARD_MAX_TIMERS];
+
+    for (int i = 0; i < dashboard->count; i++) {
+        const DashboardTimer *parked = &dashboard->timers[i];
+        DashboardTile *tile = &s_dashboard->tiles[i];
+        DisplayMode mode = parked->display_mode < DISPLAY_MODE_COUNT ? parked->display_mode : DISPLAY_MODE_TEXT;
+        int density = timer->grid_density[mode];
+
+        GridSpec spec;
+        GridState *grid = NULL;
+        if (grid_spec_for(mode, density, &spec)) {
+            grid = dashboard_grid(&spec, art.w, art.h, &claimed);
+            if (!grid) missing |= 1u << i;
+        }
+        if (grid != tile->grid) {
+            display_tiles_forget(&s_dashboard->state, i);
+        }
+        tile->grid = grid;
+        keys[i] = dashboard_tile_key(parked, &palettes[mode], density, i == dashboard->selected);
+    }
+
+    unsigned held = s_dashboard->state.drawn;
+    bool clear;
+    unsigned draw = display_tiles_to_draw(&s_dashboard->state, dashboard->count, keys, full_redraw, &clear);
+    if (clear) {
+        graphics_context_set_fill_color(ctx, GColorBlack);
+        graphics_fill_rect(ctx, bounds, 0, GCornerNone);
+        held = 0;
+    }
+
+    for (int i = 0; i < dashboard->count; i++) {
+        if (!(draw & (1u << i))) continue;
+        if (missing & (1u << i)) {
+            // Without its grid it stays blank, and is tried again next time
+            display_tiles_forget(&s_dashboard->state, i);
+            continue;
+        }
+        const DashboardTimer *parked = &dashboard->timers[i];
+        DashboardTile *tile = &s_dashboard->tiles[i];
+        DisplayMode mode = parked->display_mode < DISPLAY_MODE_COUNT ? parked->display_mode : DISPLAY_MODE_TEXT;
+        tile->valid = held & (1u << i);
+        draw_dashboard_tile(ctx, bounds, s_dashboard->list, &s_dashboard->sand, tile, tiles[i], parked,
+                            &palettes[mode], i == dashboard->selected);
+    }
+}
+
+void display_dashboard_release(void) {
+    if (!s_dashboard) return;
+    if (s_dashboard->list) {
+        list_cache_destroy(s_dashboard->list);
+    }
+    for (int i = 0; i < DASHBOARD_MAX_TIMERS; i++) {
+        free(s_dashboard->grids[i]);
+    }
+    free(s_dashboard);
+    s_dashboard = NULL;
+}
+
+// =============================================================================
+// Thumbnails
+// =============================================================================
+// A thumbnail is its mode drawn the way the dashboard draws a lone tile,
+// filling the screen, at a fixed point halfway through, then shrunk into
+// the atlas. The caches it draws with are held only while drawing.
+
+#define THUMBNAIL_TOTAL_SECONDS 300
+
+bool display_render_thumbnails(GContext *ctx, GRect bounds, ThumbnailAtlas *atlas, const TimerContext *timer,
+                               const VisualizationColors *palettes) {
+    int slot = thumbnail_atlas_next_pending(atlas);
+    if (slot < 0) return true;
+
+    ListCache *list = list_cache_create();
+    SandGrid *sand = malloc(sizeof(SandGrid));
+    GridState *grid = malloc(sizeof(GridState));
+    DashboardTile *tile = calloc(1, sizeof(DashboardTile));
+    bool drawn = list && sand && grid && tile;
+
+    DlRect rect;
+    display_tile_layout(1, bounds.size.w, bounds.size.h, &rect);
+    rect.x = (int16_t)(rect.x + bounds.origin.x);
+    rect.y = (int16_t)(rect.y + bounds.origin.y);
+    DlRect art = display_tile_art(rect);
+    DashboardTimer halfway = {
+        .remaining_seconds = THUMBNAIL_TOTAL_SECONDS / 2,
+        .total_seconds = THUMBNAIL_TOTAL_SECONDS
+    };
+
+    for (; drawn && slot >= 0; slot = thumbnail_atlas_next_pending(atlas)) {
+        DisplayMode mode = (DisplayMode)slot;
+        halfway.display_mode = mode;
+        tile->valid = false;
+        tile->grid = NULL;
+        GridSpec spec;
+        if (grid_spec_for(mode, timer->grid_density[mode], &spec)) {
+            grid_state_configure(grid, &spec, art.w, art.h);
+            tile->grid = grid;
+        }
+        draw_dashboard_tile(ctx, bounds, list, sand, tile, rect, &halfway, &palettes[mode], false);
+
+        RasterSurface surface;
+        raster_surface_begin(&surface, ctx);
+        drawn = raster_surface_is_direct(&surface);
+        if (drawn) {
+            thumbnail_atlas_store(atlas, slot, &surface.target, bounds.origin.x, bounds.origin.y,
+                                  bounds.size.w, bounds.size.h);
+        }
+        raster_surface_end(&surface);
+    }
+
+    if (list) list_cache_destroy(list);
+    free(sand);
+    free(grid);
+    free(tile);
+    return drawn;
+}
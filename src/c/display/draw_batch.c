@@ -0,0 +1,150 @@
+#include "draw_batch.h"
+
+#define KNOWN_FILL 0x01
+#define KNOWN_STROKE 0x02
+#define KNOWN_STROKE_WIDTH 0x04
+#define KNOWN_TEXT 0x08
+
+// =============================================================================
+// States
+// =============================================================================
+
+static DrawState state(DrawStateKind kind, uint8_t color, int stroke_width) {
+    DrawState s = { (uint8_t)kind, color, (uint8_t)stroke_width };
+    return s;
+}
+
+DrawState draw_state_for(const DlPrim *prim, bool native_radial) {
+    switch (prim->type) {
+        case DL_FILL_RECT:
+            return state(DRAW_STATE_RASTER, prim->color, 0);
+        case DL_FILL_CIRCLE:
+            return state(DRAW_STATE_FILL, prim->color, 0);
+        case DL_STROKE_CIRCLE:
+            return state(DRAW_STATE_STROKE, prim->color, prim->b);
+        case DL_LINE:
+            return state(DRAW_STATE_STROKE, prim->color, prim->c);
+        case DL_ARC:
+            if (prim->flags == DL_ARC_WEDGES) {
+                return state(DRAW_STATE_STROKE, prim->color, prim->rect.w > 0 ? prim->rect.w : 3);
+            }
+            if (prim->flags == DL_ARC_BAND && (prim->d || !native_radial)) {
+                return state(DRAW_STATE_RASTER, prim->color, 0);
+            }
+            return state(DRAW_STATE_FILL, prim->color, 0);
+        case DL_TEXT:
+            return state(DRAW_STATE_TEXT, prim->color, 0);
+        default:
+            return state(DRAW_STATE_NONE, 0, 0);
+    }
+}
+
+bool draw_state_equal(DrawState a, DrawState b) {
+    if (a.kind != b.kind) return false;
+    switch (a.kind) {
+        case DRAW_STATE_FILL:
+        case DRAW_STATE_TEXT:
+            return a.color == b.color;
+        case DRAW_STATE_STROKE:
+            return a.color == b.color && a.stroke_width == b.stroke_width;
+        default:
+            return true;
+    }
+}
+
+// =============================================================================
+// State Cache
+// =============================================================================
+
+void draw_state_reset(DrawStateCache *cache) {
+    cache->known = 0;
+}
+
+static bool set(DrawStateCache *cache, uint8_t *field, uint8_t bit, uint8_t value) {
+    if ((cache->known & bit) && *field == value) return false;
+    *field = value;
+    cache->known |= bit;
+    cache->changes++;
+    return true;
+}
+
+bool draw_state_fill(DrawStateCache *cache, uint8_t argb) {
+    return set(cache, &cache->fill, KNOWN_FILL, argb);
+}
+
+bool draw_state_stroke(DrawStateCache *cache, uint8_t argb) {
+    return set(cache, &cache->stroke, KNOWN_STROKE, argb);
+}
+
+bool draw_state_stroke_width(DrawStateCache *cache, uint8_t width) {
+    return set(cache, &cache->stroke_width, KNOWN_STROKE_WIDTH, width);
+}
+
+bool draw_state_text(DrawStateCache *cache, uint8_t argb) {
+    return set(cache, &cache->text, KNOWN_TEXT, argb);
+}
+
+int draw_state_apply(DrawStateCache *cache, DrawState state) {
+    switch (state.kind) {
+        case DRAW_STATE_FILL:
+            return draw_state_fill(cache, state.color);
+        case DRAW_STATE_STROKE:
+            return draw_state_stroke(cache, state.color) + draw_state_stroke_width(cache, state.stroke_width);
+        case DRAW_STATE_TEXT:
+            return draw_state_text(cache, state.color);
+        default:
+            return 0;
+    }
+}
+
+// =============================================================================
+// Display List Order
+// =============================================================================
+
+int draw_batch_order(const DisplayList *list, const DisplayListPlan *plan, bool native_radial, uint8_t *order) {
+    // Issued primitives, and how many before each that it overlaps are
+    // still to be drawn
+    uint8_t pending[DISPLAY_LIST_MAX];
+    uint8_t blockers[DISPLAY_LIST_MAX];
+    int count = 0;
+    for (int i = 0; i < list->count; i++) {
+        if (!display_list_plan_issues(plan, i)) continue;
+        blockers[count] = 0;
+        for (int j = 0; j < count; j++) {
+            if (dl_prims_overlap(&list->prims[pending[j]], &list->prims[i])) blockers[count]++;
+        }
+        pending[count++] = (uint8_t)i;
+    }
+
+    DrawState current = state(DRAW_STATE_NONE, 0, 0);
+    int left = count;
+    for (int n = 0; n < count; n++) {
+        // The earliest left is never blocked
+        int pick = -1;
+        int first = -1;
+        for (int j = 0; j < left; j++) {
+            if (blockers[j]) continue;
+            if (first < 0) first = j;
+            DrawState s = draw_state_for(&list->prims[pending[j]], native_radial);
+            if (s.kind == DRAW_STATE_NONE || draw_state_equal(s, current)) {
+                pick = j;
+                break;
+            }
+        }
+        if (pick < 0) pick = first;
+
+        const DlPrim *prim = &list->prims[pending[pick]];
+        DrawState s = draw_state_for(prim, native_radial);
+        if (s.kind != DRAW_STATE_NONE) current = s;
+        order[n] = pending[pick];
+
+        // Unblock what it held back, keeping the rest in list order
+        for (int j = pick + 1; j < left; j++) {
+            if (blockers[j] && dl_prims_overlap(prim, &list->prims[pending[j]])) blockers[j]--;
+            pending[j - 1] = pending[j];
+            blockers[j - 1] = blockers[j];
+        }
+        left--;
+    }
+    return count;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "display_list.h"
+
+// =============================================================================
+// Draw Batching - Grouping by Graphics State (No SDK Dependencies)
+// =============================================================================
+// Every graphics_context_set_* call is a trip into the firmware, and drawing
+// through the SDK used to make one or two for each primitive, grid cell and
+// Matrix character. Two things cut that down:
+//
+// - A DrawStateCache remembers what the context was last set to, so a setter
+//   is only called when its value changes.
+// - draw_batch_order issues a display list grouped by the state each
+//   primitive needs, so the cache sees long runs of one state. A primitive
+//   only moves ahead of ones it can't overlap, so the picture is the same.
+//
+// No mode changes antialiasing, so it isn't part of the state. The SDK side
+// lives in display_modes.c and raster_surface.c.
+
+typedef enum {
+    DRAW_STATE_NONE,     // Sets nothing (images carry their own colors)
+    DRAW_STATE_RASTER,   // Written to the framebuffer (raster_surface.h)
+    DRAW_STATE_FILL,     // Fill color
+    DRAW_STATE_STROKE,   // Stroke color and width
+    DRAW_STATE_TEXT      // Text color
+} DrawStateKind;
+
+typedef struct {
+    uint8_t kind;           // DrawStateKind
+    uint8_t color;          // GColor8 ARGB
+    uint8_t stroke_width;
+} DrawState;
+
+// What the display list executor sets up to draw `prim`. Bands are written
+// to the framebuffer when they have a track or there is no native radial fill.
+DrawState draw_state_for(const DlPrim *prim, bool native_radial);
+
+// Both need the same context state (framebuffer writes need none)
+bool draw_state_equal(DrawState a, DrawState b);
+
+// =============================================================================
+// State Cache
+// =============================================================================
+
+// The context's state, as far as calls made through the cache go. Zeroed,
+// it knows nothing.
+typedef struct {
+    uint8_t fill;
+    uint8_t stroke;
+    uint8_t stroke_width;
+    uint8_t text;
+    uint8_t known;      // Which of the above are known
+    uint16_t changes;   // Setter calls let through since it was zeroed
+} DrawStateCache;
+
+// Forget what the context holds: a new layer render, or calls made around
+// the cache. `changes` keeps counting.
+void draw_state_reset(DrawStateCache *cache);
+
+// Whether the setter must be called for the context to hold the value. If
+// so, the cache records it as set.
+bool draw_state_fill(DrawStateCache *cache, uint8_t argb);
+bool draw_state_stroke(DrawStateCache *cache, uint8_t argb);
+bool draw_state_stroke_width(DrawStateCache *cache, uint8_t width);
+bool draw_state_text(DrawStateCache *cache, uint8_t argb);
+
+// Let through what `state` needs; returns the setter calls it takes (0-2)
+int draw_state_apply(DrawStateCache *cache, DrawState state);
+
+// =============================================================================
+// Display List Order
+// =============================================================================
+
+// The primitives `plan` issues, grouped into runs of one state: each next one
+// is the earliest that needs the current state and overlaps nothing still to
+// be drawn before it, or failing that the earliest left. Primitives that set
+// nothing join whatever run they come up in. Writes their indices to `order`
+// (DISPLAY_LIST_MAX entries) and returns how many.
+int draw_batch_order(const DisplayList *list, const DisplayListPlan *plan, bool native_radial, uint8_t *order);
@@ -0,0 +1,125 @@
+#include <string.h>
+#include "frame_cache.h"
+
+// =============================================================================
+// Keys
+// =============================================================================
+
+#define FNV_PRIME 16777619u
+
+FrameKey frame_key_add(FrameKey key, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        key ^= (value >> (i * 8)) & 0xFF;
+        key *= FNV_PRIME;
+    }
+    return key;
+}
+
+// =============================================================================
+// Storage
+// =============================================================================
+
+static int row_bytes(RasterFormat format, int width) {
+    return (format == RASTER_FORMAT_1BIT) ? (width + 7) / 8 : width;
+}
+
+// Byte span [*first, *last] backing columns [min_x, max_x] of a row
+static void row_span(RasterFormat format, RasterRow row, int *first, int *last) {
+    if (format == RASTER_FORMAT_1BIT) {
+        *first = row.min_x / 8;
+        *last = row.max_x / 8;
+    } else {
+        *first = row.min_x;
+        *last = row.max_x;
+    }
+}
+
+size_t frame_cache_bytes(RasterFormat format, int width, int height) {
+    if (width <= 0 || height <= 0) return 0;
+    return (size_t)row_bytes(format, width) * (size_t)height;
+}
+
+void frame_cache_init(FrameCache *cache, uint8_t *pixels, size_t size) {
+    cache->pixels = pixels;
+    cache->size = pixels ? size : 0;
+    cache->width = 0;
+    cache->height = 0;
+    cache->key = 0;
+    cache->valid = false;
+}
+
+void frame_cache_invalidate(FrameCache *cache) {
+    cache->valid = false;
+}
+
+void frame_cache_store(FrameCache *cache, const RasterTarget *src, FrameKey key) {
+    size_t needed = frame_cache_bytes(src->format, src->width, src->height);
+    if (needed == 0 || needed > cache->size) {
+        cache->valid = false;
+        return;
+    }
+
+    int pitch = row_bytes(src->format, src->width);
+    for (int y = 0; y < src->height; y++) {
+        RasterRow row = raster_target_row(src, y);
+        if (row.max_x < row.min_x) continue;
+        int first, last;
+        row_span(src->format, row, &first, &last);
+        memcpy(cache->pixels + y * pitch + first, row.data + first, (size_t)(last - first + 1));
+    }
+    cache->format = src->format;
+    cache->width = (int16_t)src->width;
+    cache->height = (int16_t)src->height;
+    cache->key = key;
+    cache->valid = true;
+}
+
+static bool same_layout(const FrameCache *cache, const RasterTarget *dst) {
+    return cache->valid && cache->format == dst->format &&
+           cache->width == dst->width && cache->height == dst->height;
+}
+
+bool frame_cache_restore(const FrameCache *cache, const RasterTarget *dst, FrameKey key) {
+    if (!same_layout(cache, dst) || cache->key != key) {
+        return false;
+    }
+
+    int pitch = row_bytes(dst->format, dst->width);
+    for (int y = 0; y < dst->height; y++) {
+        RasterRow row = raster_target_row(dst, y);
+        if (row.max_x < row.min_x) continue;
+        int first, last;
+        row_span(dst->format, row, &first, &last);
+        memcpy(row.data + first, cache->pixels + y * pitch + first, (size_t)(last - first + 1));
+    }
+    return true;
+}
+
+// =============================================================================
+// Transitions
+// =============================================================================
+
+bool frame_cache_wipe(const FrameCache *left, const FrameCache *right, const RasterTarget *dst, int split) {
+    if (!same_layout(left, dst) || !same_layout(right, dst)) {
+        return false;
+    }
+
+    int pitch = row_bytes(dst->format, dst->width);
+    int split_byte = (dst->format == RASTER_FORMAT_1BIT) ? split / 8 : split;
+    for (int y = 0; y < dst->height; y++) {
+        RasterRow row = raster_target_row(dst, y);
+        if (row.max_x < row.min_x) continue;
+        int first, last;
+        row_span(dst->format, row, &first, &last);
+
+        int mid = split_byte < first ? first : (split_byte > last + 1 ? last + 1 : split_byte);
+        int offset = y * pitch;
+        if (mid > first) {
+            memcpy(row.data + first, left->pixels + offset + first, (size_t)(mid - first));
+        }
+        if (mid <= last) {
+            memcpy(row.data + mid, right->pixels + offset + mid, (size_t)(last - mid + 1));
+        }
+    }
+    return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "raster.h"
+
+// =============================================================================
+// Frame Cache - Last Composed Frame (No SDK Dependencies)
+// =============================================================================
+// A copy of the framebuffer as the last render left it, tagged with a key
+// hashed from everything that frame was drawn from. When the system forces a
+// render (a notification closing, the window reappearing) and the key still
+// matches, copying the frame back replaces redrawing it. The SDK glue lives
+// in display_modes.c.
+//
+// Only the columns a row backs are copied, so round framebuffers work as
+// long as the same target layout is used in both directions.
+
+typedef uint32_t FrameKey;
+
+#define FRAME_KEY_INIT 2166136261u   // FNV-1a offset basis
+
+// Mix one value into a key (FNV-1a over its four bytes)
+FrameKey frame_key_add(FrameKey key, uint32_t value);
+
+typedef struct {
+    uint8_t *pixels;      // Row-major copy, frame_cache_bytes() long
+    size_t size;          // Bytes available at pixels
+    RasterFormat format;
+    int16_t width;
+    int16_t height;
+    FrameKey key;
+    bool valid;
+} FrameCache;
+
+// Bytes needed to hold a frame of this format and size
+size_t frame_cache_bytes(RasterFormat format, int width, int height);
+
+// Use `size` bytes at `pixels`; a NULL buffer keeps the cache always empty
+void frame_cache_init(FrameCache *cache, uint8_t *pixels, size_t size);
+
+void frame_cache_invalidate(FrameCache *cache);
+
+// Copy what `src` holds into the cache under `key`. A frame too big for the
+// buffer leaves the cache empty.
+void frame_cache_store(FrameCache *cache, const RasterTarget *src, FrameKey key);
+
+// Copy the cached frame into `dst` if it was stored under `key` from a
+// target of the same layout; false (and `dst` untouched) otherwise
+bool frame_cache_restore(const FrameCache *cache, const RasterTarget *dst, FrameKey key);
+
+// =============================================================================
+// Transitions
+// =============================================================================
+
+// Compose a wipe between two cached frames into `dst`: columns left of
+// `split` from `left`, the rest from `right` (on 1-bit targets, whole bytes
+// of 8 columns). False, with `dst` untouched, unless both were stored from
+// a target of its layout. Keys aren't checked.
+bool frame_cache_wipe(const FrameCache *left, const FrameCache *right, const RasterTarget *dst, int split);
@@ -0,0 +1,155 @@
+#include "glyph_atlas.h"
+#include <string.h>
+
+// =============================================================================
+// Digit Font
+// =============================================================================
+
+// 5x7 digits, one byte per row with bit 4 as the leftmost pixel
+static const uint8_t s_digit_font[GLYPH_COUNT][GLYPH_HEIGHT] = {
+    { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E },  // 0
+    { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E },  // 1
+    { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F },  // 2
+    { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E },  // 3
+    { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 },  // 4
+    { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E },  // 5
+    { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E },  // 6
+    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },  // 7
+    { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E },  // 8
+    { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C },  // 9
+};
+
+#define GLYPH_ROW_MASK ((1u << GLYPH_WIDTH) - 1)
+
+// Mirror a font row so bit 0 is the leftmost pixel, matching 1-bit framebuffers
+static uint8_t font_row_lsb_first(uint8_t row) {
+    uint8_t out = 0;
+    for (int i = 0; i < GLYPH_WIDTH; i++) {
+        if (row & (1u << (GLYPH_WIDTH - 1 - i))) {
+            out |= (uint8_t)(1u << i);
+        }
+    }
+    return out;
+}
+
+// =============================================================================
+// Atlas Construction
+// =============================================================================
+
+bool glyph_atlas_matches(const GlyphAtlas *atlas, RasterFormat format,
+                         const uint8_t shades[GLYPH_SHADE_COUNT], uint8_t background) {
+    return atlas->valid &&
+           atlas->format == format &&
+           atlas->background == background &&
+           memcmp(atlas->shades, shades, sizeof(atlas->shades)) == 0;
+}
+
+void glyph_atlas_build(GlyphAtlas *atlas, RasterFormat format,
+                       const uint8_t shades[GLYPH_SHADE_COUNT], uint8_t background) {
+    atlas->format = format;
+    atlas->background = background;
+    memcpy(atlas->shades, shades, sizeof(atlas->shades));
+
+    for (int g = 0; g < GLYPH_COUNT; g++) {
+        for (int r = 0; r < GLYPH_HEIGHT; r++) {
+            atlas->masks[g][r] = font_row_lsb_first(s_digit_font[g][r]);
+        }
+    }
+
+    #if RASTER_HAS_8BIT
+        if (format == RASTER_FORMAT_8BIT) {
+            for (int s = 0; s < GLYPH_SHADE_COUNT; s++) {
+                for (int g = 0; g < GLYPH_COUNT; g++) {
+                    for (int r = 0; r < GLYPH_HEIGHT; r++) {
+                        for (int c = 0; c < GLYPH_WIDTH; c++) {
+                            bool on = (atlas->masks[g][r] >> c) & 1;
+                            atlas->pixels[s][g][r][c] = on ? shades[s] : background;
+                        }
+                    }
+                }
+            }
+        }
+    #endif
+
+    atlas->valid = true;
+}
+
+// =============================================================================
+// Blitting
+// =============================================================================
+
+static void set_pixel(const RasterTarget *target, RasterRow row, int x, uint8_t pixel) {
+    if (target->format == RASTER_FORMAT_8BIT) {
+        row.data[x] = pixel;
+    } else if (pixel) {
+        row.data[x >> 3] |= (uint8_t)(1u << (x & 7));
+    } else {
+        row.data[x >> 3] &= (uint8_t)~(1u << (x & 7));
+    }
+}
+
+// Slow path for cells that straddle the edge of a row's visible span
+static void blit_row_clipped(const RasterTarget *target, RasterRow row, int x, uint8_t mask,
+                             uint8_t fg, uint8_t bg) {
+    for (int c = 0; c < GLYPH_WIDTH; c++) {
+        int px = x + c;
+        if (px < row.min_x || px > row.max_x) continue;
+        set_pixel(target, row, px, ((mask >> c) & 1) ? fg : bg);
+    }
+}
+
+// Write one glyph row into a 1-bit row through a two-byte window
+static void blit_row_1bit(uint8_t *data, int x, uint8_t mask, uint8_t fg, uint8_t bg) {
+    uint16_t bits = (uint16_t)((fg ? mask : 0) | (bg ? (~mask & GLYPH_ROW_MASK) : 0));
+    int shift = x & 7;
+    uint16_t window = (uint16_t)(GLYPH_ROW_MASK << shift);
+    uint16_t value = (uint16_t)(bits << shift);
+    uint8_t *b = data + (x >> 3);
+
+    b[0] = (uint8_t)((b[0] & ~window) | value);
+    if (window >> 8) {
+        b[1] = (uint8_t)((b[1] & ~(window >> 8)) | (value >> 8));
+    }
+}
+
+// glyph < 0 paints an empty cell
+static void blit_cell(const GlyphAtlas *atlas, const RasterTarget *target,
+                      int glyph, GlyphShade shade, int x, int y) {
+    uint8_t fg = raster_pixel_for(target, atlas->shades[shade]);
+    uint8_t bg = raster_pixel_for(target, atlas->background);
+
+    for (int r = 0; r < GLYPH_HEIGHT; r++) {
+        int py = y + r;
+        if (py < 0 || py >= target->height) continue;
+
+        RasterRow row = raster_target_row(target, py);
+        uint8_t mask = (glyph >= 0) ? atlas->masks[glyph][r] : 0;
+
+        if (x < row.min_x || x + GLYPH_WIDTH - 1 > row.max_x) {
+            blit_row_clipped(target, row, x, mask, fg, bg);
+            continue;
+        }
+
+        #if RASTER_HAS_8BIT
+            if (target->format == RASTER_FORMAT_8BIT) {
+                if (glyph >= 0) {
+                    memcpy(row.data + x, atlas->pixels[shade][glyph][r], GLYPH_WIDTH);
+                } else {
+                    memset(row.data + x, bg, GLYPH_WIDTH);
+                }
+                continue;
+            }
+        #endif
+        blit_row_1bit(row.data, x, mask, fg, bg);
+    }
+}
+
+void glyph_atlas_blit(const GlyphAtlas *atlas, const RasterTarget *target,
+                      int glyph, GlyphShade shade, int x, int y) {
+    if (glyph < 0 || glyph >= GLYPH_COUNT || shade >= GLYPH_SHADE_COUNT) return;
+    blit_cell(atlas, target, glyph, shade, x, y);
+}
+
+void glyph_atlas_clear(const GlyphAtlas *atlas, const RasterTarget *target, int x, int y) {
+    blit_cell(atlas, target, -1, GLYPH_SHADE_HEAD, x, y);
+}
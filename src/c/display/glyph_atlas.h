@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "raster.h"
+
+// =============================================================================
+// Glyph Atlas - Pre-rendered Digits for Matrix Rain (No SDK Dependencies)
+// =============================================================================
+// The ten digits are stored once as 5x7 bit masks and, on color framebuffers,
+// pre-rendered into GColor8 pixels for every trail shade with the background
+// baked in. A cell is then drawn by copying GLYPH_HEIGHT short rows into the
+// framebuffer, which is opaque: blitting over an old glyph replaces it.
+
+#define GLYPH_WIDTH 5
+#define GLYPH_HEIGHT 7
+#define GLYPH_COUNT 10
+
+// Trail shades, brightest first
+typedef enum {
+    GLYPH_SHADE_HEAD,
+    GLYPH_SHADE_NEAR,
+    GLYPH_SHADE_TAIL,
+    GLYPH_SHADE_COUNT
+} GlyphShade;
+
+typedef struct {
+    RasterFormat format;
+    uint8_t background;                  // GColor8 ARGB
+    uint8_t shades[GLYPH_SHADE_COUNT];   // GColor8 ARGB per shade
+    uint8_t masks[GLYPH_COUNT][GLYPH_HEIGHT];  // LSB is the leftmost pixel
+#if RASTER_HAS_8BIT
+    uint8_t pixels[GLYPH_SHADE_COUNT][GLYPH_COUNT][GLYPH_HEIGHT][GLYPH_WIDTH];
+#endif
+    bool valid;
+} GlyphAtlas;
+
+// Whether the atlas was built for this format and palette
+bool glyph_atlas_matches(const GlyphAtlas *atlas, RasterFormat format,
+                         const uint8_t shades[GLYPH_SHADE_COUNT], uint8_t background);
+
+void glyph_atlas_build(GlyphAtlas *atlas, RasterFormat format,
+                       const uint8_t shades[GLYPH_SHADE_COUNT], uint8_t background);
+
+// Draw digit `glyph` in `shade` with its top-left corner at (x, y)
+void glyph_atlas_blit(const GlyphAtlas *atlas, const RasterTarget *target,
+                      int glyph, GlyphShade shade, int x, int y);
+
+// Paint a glyph-sized cell with the atlas background
+void glyph_atlas_clear(const GlyphAtlas *atlas, const RasterTarget *target, int x, int y);
@@ -0,0 +1,186 @@
+#include "grid.h"
+#include <string.h>
+
+// =============================================================================
+// Fill Orders
+// =============================================================================
+
+void grid_order_rows(int cols, int rows, uint16_t *cell_for_rank) {
+    int total = cols * rows;
+    for (int rank = 0; rank < total; rank++) {
+        int row = rows - 1 - rank / cols;
+        int col = cols - 1 - rank % cols;
+        cell_for_rank[rank] = (uint16_t)(row * cols + col);
+    }
+}
+
+void grid_order_columns(int cols, int rows, uint16_t *cell_for_rank) {
+    int total = cols * rows;
+    for (int rank = 0; rank < total; rank++) {
+        int col = cols - 1 - rank / rows;
+        int row = rows - 1 - rank % rows;
+        cell_for_rank[rank] = (uint16_t)(row * cols + col);
+    }
+}
+
+// Append a cell to the spiral if it lies inside the grid
+static int spiral_visit(int cols, int rows, int row, int col, uint16_t *cell_for_rank, int rank) {
+    if (row < 0 || row >= rows || col < 0 || col >= cols) {
+        return rank;
+    }
+    cell_for_rank[rank] = (uint16_t)(row * cols + col);
+    return rank + 1;
+}
+
+void grid_order_spiral_out(int cols, int rows, uint16_t *cell_for_rank) {
+    int total = cols * rows;
+    int center_row = rows / 2;
+    int center_col = cols / 2;
+    int rank = spiral_visit(cols, rows, center_row, center_col, cell_for_rank, 0);
+
+    // Walk each square ring clockwise starting at its top-left corner,
+    // skipping positions that fall outside non-square grids
+    for (int ring = 1; rank < total; ring++) {
+        int top = center_row - ring;
+        int bottom = center_row + ring;
+        int left = center_col - ring;
+        int right = center_col + ring;
+
+        for (int col = left; col <= right; col++) {
+            rank = spiral_visit(cols, rows, top, col, cell_for_rank, rank);
+        }
+        for (int row = top + 1; row <= bottom; row++) {
+            rank = spiral_visit(cols, rows, row, right, cell_for_rank, rank);
+        }
+        for (int col = right - 1; col >= left; col--) {
+            rank = spiral_visit(cols, rows, bottom, col, cell_for_rank, rank);
+        }
+        for (int row = bottom - 1; row > top; row--) {
+            rank = spiral_visit(cols, rows, row, left, cell_for_rank, rank);
+        }
+    }
+}
+
+void grid_order_spiral_in(int cols, int rows, uint16_t *cell_for_rank) {
+    int total = cols * rows;
+    grid_order_spiral_out(cols, rows, cell_for_rank);
+
+    for (int i = 0; i < total / 2; i++) {
+        uint16_t tmp = cell_for_rank[i];
+        cell_for_rank[i] = cell_for_rank[total - 1 - i];
+        cell_for_rank[total - 1 - i] = tmp;
+    }
+}
+
+// =============================================================================
+// Layout
+// =============================================================================
+
+GridSpec grid_spec_scaled(int base_cols, int base_rows, GridOrderBuilder order, int density) {
+    if (density < 0 || density >= GRID_DENSITY_COUNT) {
+        density = GRID_DENSITY_NORMAL;
+    }
+
+    // Normal = 1x, Dense = 1.5x, Fine = 2x the mode's base dimensions
+    int cols = base_cols * (2 + density) / 2;
+    int rows = base_rows * (2 + density) / 2;
+
+    // Keep odd dimensions odd so spirals stay centered
+    if ((base_cols & 1) && !(cols & 1)) cols--;
+    if ((base_rows & 1) && !(rows & 1)) rows--;
+
+    if (cols > GRID_MAX_DIM) cols = GRID_MAX_DIM;
+    if (rows > GRID_MAX_DIM) rows = GRID_MAX_DIM;
+    while (cols * rows > GRID_MAX_CELLS) {
+        if (cols >= rows) cols--; else rows--;
+    }
+
+    GridSpec spec = {
+        .cols = cols,
+        .rows = rows,
+        .padding = (density == GRID_DENSITY_NORMAL) ? 2 : 1,
+        .order = order
+    };
+    return spec;
+}
+
+void grid_layout_compute(GridLayout *layout, const GridSpec *spec, int width, int height) {
+    int available_width = width - 20;
+    int available_height = height - 60;
+
+    int cell_width = (available_width - (spec->cols - 1) * spec->padding) / spec->cols;
+    int cell_height = (available_height - (spec->rows - 1) * spec->padding) / spec->rows;
+    int cell_size = (cell_width < cell_height) ? cell_width : cell_height;
+    if (cell_size < 1) cell_size = 1;
+
+    layout->cols = spec->cols;
+    layout->rows = spec->rows;
+    layout->padding = spec->padding;
+    layout->cell_size = cell_size;
+    layout->width = spec->cols * cell_size + (spec->cols - 1) * spec->padding;
+    layout->height = spec->rows * cell_size + (spec->rows - 1) * spec->padding;
+    layout->origin_x = (width - layout->width) / 2;
+    layout->origin_y = (height - layout->height) / 2 - 10;
+}
+
+void grid_cell_origin(const GridLayout *layout, int cell, int *x, int *y) {
+    int row = cell / layout->cols;
+    int col = cell % layout->cols;
+    *x = layout->origin_x + col * (layout->cell_size + layout->padding);
+    *y = layout->origin_y + row * (layout->cell_size + layout->padding);
+}
+
+// =============================================================================
+// State Management
+// =============================================================================
+
+bool grid_state_matches(const GridState *state, const GridSpec *spec, int width, int height) {
+    return state->spec.cols == spec->cols &&
+           state->spec.rows == spec->rows &&
+           state->spec.padding == spec->padding &&
+           state->spec.order == spec->order &&
+           state->bounds_w == width &&
+           state->bounds_h == height;
+}
+
+void grid_state_configure(GridState *state, const GridSpec *spec, int width, int height) {
+    state->spec = *spec;
+    state->bounds_w = width;
+    state->bounds_h = height;
+    grid_layout_compute(&state->layout, spec, width, height);
+    spec->order(spec->cols, spec->rows, state->cell_for_rank);
+    memset(&state->filled, 0, sizeof(state->filled));
+    state->valid = false;
+}
+
+void grid_state_bitset_for(const GridState *state, int filled, GridBitset *out) {
+    int total = state->spec.cols * state->spec.rows;
+    if (filled > total) filled = total;
+
+    memset(out, 0, sizeof(*out));
+    for (int rank = 0; rank < filled; rank++) {
+        int cell = state->cell_for_rank[rank];
+        out->words[cell >> 5] |= (uint32_t)1 << (cell & 31);
+    }
+}
+
+// =============================================================================
+// Bitset Diffing
+// =============================================================================
+
+bool grid_bitset_test(const GridBitset *set, int cell) {
+    return (set->words[cell >> 5] >> (cell & 31)) & 1;
+}
+
+int grid_bitset_diff(const GridBitset *a, const GridBitset *b, uint16_t *changed, int max_changed) {
+    int count = 0;
+    for (int w = 0; w < GRID_BITSET_WORDS; w++) {
+        uint32_t flipped = a->words[w] ^ b->words[w];
+        while (flipped && count < max_changed) {
+            int bit = __builtin_ctz(flipped);
+            changed[count++] = (uint16_t)(w * 32 + bit);
+            flipped &= flipped - 1;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// =============================================================================
+// Grid Engine - Pure Layout & Diff Logic (No SDK Dependencies)
+// =============================================================================
+// Shared by every block-style visualization (Blocks, Vertical Blocks, Spiral
+// Out, Spiral In). A grid is described by its dimensions and a pluggable fill
+// order; the engine keeps the previous frame's filled cells as a bitset so the
+// renderer only has to repaint the cells whose bit flipped.
+
+// =============================================================================
+// Limits
+// =============================================================================
+
+#define GRID_MAX_DIM 24
+#define GRID_MAX_CELLS 384  // 24x16 / 16x24 at the finest density
+#define GRID_BITSET_WORDS ((GRID_MAX_CELLS + 31) / 32)
+
+// Density levels a user can pick per grid mode. Only emery's larger screen
+// has room for the finest level.
+#define GRID_DENSITY_NORMAL 0
+#define GRID_DENSITY_DENSE  1
+#define GRID_DENSITY_FINE   2
+#ifdef PBL_PLATFORM_EMERY
+  #define GRID_DENSITY_COUNT 3
+#else
+  #define GRID_DENSITY_COUNT 2
+#endif
+
+// =============================================================================
+// Grid Description
+// =============================================================================
+
+// Fill order builder: writes the cell index (row * cols + col) that fills at
+// each rank, for every rank in [0, cols * rows)
+typedef void (*GridOrderBuilder)(int cols, int rows, uint16_t *cell_for_rank);
+
+typedef struct {
+    int cols;
+    int rows;
+    int padding;
+    GridOrderBuilder order;
+} GridSpec;
+
+typedef struct {
+    int cols;
+    int rows;
+    int padding;
+    int cell_size;
+    int origin_x;
+    int origin_y;
+    int width;
+    int height;
+} GridLayout;
+
+typedef struct {
+    uint32_t words[GRID_BITSET_WORDS];
+} GridBitset;
+
+// =============================================================================
+// Grid State - Layout, Fill Order and Last Rendered Frame
+// =============================================================================
+
+typedef struct {
+    GridSpec spec;
+    GridLayout layout;
+    int bounds_w;
+    int bounds_h;
+    uint16_t cell_for_rank[GRID_MAX_CELLS];
+    GridBitset filled;  // Cells painted filled in the last rendered frame
+    bool valid;         // false until a full frame has been rendered
+} GridState;
+
+// =============================================================================
+// Fill Orders
+// =============================================================================
+
+// Bottom-right to top-left, row by row (Blocks)
+void grid_order_rows(int cols, int rows, uint16_t *cell_for_rank);
+
+// Bottom-right to top-left, column by column (Vertical Blocks)
+void grid_order_columns(int cols, int rows, uint16_t *cell_for_rank);
+
+// Clockwise square spiral from the center outward (Spiral Out)
+void grid_order_spiral_out(int cols, int rows, uint16_t *cell_for_rank);
+
+// Same spiral, filled from the outside in (Spiral In)
+void grid_order_spiral_in(int cols, int rows, uint16_t *cell_for_rank);
+
+// =============================================================================
+// Layout
+// =============================================================================
+
+// Scale a mode's base dimensions to the requested density level
+GridSpec grid_spec_scaled(int base_cols, int base_rows, GridOrderBuilder order, int density);
+
+// Fit the grid into a width x height canvas (leaves room for the time text)
+void grid_layout_compute(GridLayout *layout, const GridSpec *spec, int width, int height);
+
+// Top-left corner of a cell in canvas coordinates
+void grid_cell_origin(const GridLayout *layout, int cell, int *x, int *y);
+
+// =============================================================================
+// State Management
+// =============================================================================
+
+// True if the state was configured for this spec and canvas size
+bool grid_state_matches(const GridState *state, const GridSpec *spec, int width, int height);
+
+// Compute layout and fill order; invalidates the last rendered frame
+void grid_state_configure(GridState *state, const GridSpec *spec, int width, int height);
+
+// Build the filled-cell bitset for the first `filled` ranks of the fill order
+void grid_state_bitset_for(const GridState *state, int filled, GridBitset *out);
+
+// =============================================================================
+// Bitset Diffing
+// =============================================================================
+
+bool grid_bitset_test(const GridBitset *set, int cell);
+
+// Write the indices of cells that differ between two bitsets into `changed`
+// Returns: number of changed cells written (at most max_changed)
+int grid_bitset_diff(const GridBitset *a, const GridBitset *b, uint16_t *changed, int max_changed);
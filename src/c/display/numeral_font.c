@@ -0,0 +1,121 @@
+#include "numeral_font.h"
+#include <string.h>
+
+#define NUMERAL_HEADER_SIZE 4
+
+// =============================================================================
+// Font Loading
+// =============================================================================
+
+bool numeral_font_init(NumeralFont *font, const uint8_t *data, size_t size) {
+    memset(font, 0, sizeof(*font));
+    if (!data || size < NUMERAL_HEADER_SIZE) return false;
+
+    int width = data[0];
+    int height = data[1];
+    int count = data[3];
+    int row_bytes = (width + 7) / 8;
+    size_t expected = NUMERAL_HEADER_SIZE + (size_t)count + (size_t)count * height * row_bytes;
+    if (width == 0 || height == 0 || count == 0 || size < expected) return false;
+
+    font->width = (uint8_t)width;
+    font->height = (uint8_t)height;
+    font->advance = data[2];
+    font->row_bytes = row_bytes;
+    font->chars = data + NUMERAL_HEADER_SIZE;
+    font->bits = font->chars + count;
+    font->count = (uint8_t)count;
+    return true;
+}
+
+int numeral_font_glyph(const NumeralFont *font, char ch) {
+    for (int i = 0; i < font->count; i++) {
+        if (font->chars[i] == (uint8_t)ch) return i;
+    }
+    return -1;
+}
+
+bool numeral_font_supports(const NumeralFont *font, const char *text) {
+    if (font->count == 0) return false;
+
+    int len = 0;
+    for (const char *p = text; *p; p++, len++) {
+        if (len >= NUMERAL_TEXT_MAX || numeral_font_glyph(font, *p) < 0) return false;
+    }
+    return true;
+}
+
+int numeral_font_text_width(const NumeralFont *font, int len) {
+    if (len <= 0) return 0;
+    return (len - 1) * font->advance + font->width;
+}
+
+// =============================================================================
+// Glyph Drawing
+// =============================================================================
+
+void numeral_font_draw_glyph(const NumeralFont *font, const RasterTarget *target, int glyph,
+                             int x, int y, uint8_t fg, uint8_t bg, bool opaque) {
+    const uint8_t *rows = font->bits + (size_t)glyph * font->height * font->row_bytes;
+
+    for (int r = 0; r < font->height; r++) {
+        const uint8_t *bits = rows + r * font->row_bytes;
+
+        // Fill each run of equal pixels with one span
+        int run_start = 0;
+        bool run_ink = bits[0] & 1;
+        for (int c = 1; c <= font->width; c++) {
+            bool ink = (c < font->width) && ((bits[c >> 3] >> (c & 7)) & 1);
+            if (c < font->width && ink == run_ink) continue;
+
+            if (run_ink) {
+                raster_fill_span(target, y + r, x + run_start, x + c - 1, fg);
+            } else if (opaque) {
+                raster_fill_span(target, y + r, x + run_start, x + c - 1, bg);
+            }
+            run_start = c;
+            run_ink = ink;
+        }
+    }
+}
+
+// =============================================================================
+// Cell-Diffed Text
+// =============================================================================
+
+int numeral_text_draw(NumeralText *state, const NumeralFont *font, const RasterTarget *target,
+                      const char *text, int rect_x, int rect_y, int rect_w, int rect_h,
+                      uint8_t fg, uint8_t bg, bool incremental) {
+    int len = (int)strlen(text);
+    if (len > NUMERAL_TEXT_MAX) len = NUMERAL_TEXT_MAX;
+
+    int x = rect_x + (rect_w - numeral_font_text_width(font, len)) / 2;
+    int y = rect_y + (rect_h - font->height) / 2;
+
+    bool same_layout = incremental && state->valid && state->font == font &&
+                       state->len == len && state->x == x && state->y == y;
+
+    if (incremental && state->valid && !same_layout) {
+        raster_fill_rect(target, state->x, state->y,
+                         numeral_font_text_width(state->font, state->len), state->font->height, bg);
+    }
+
+    int drawn = 0;
+    for (int i = 0; i < len; i++) {
+        if (same_layout && state->shown[i] == text[i]) continue;
+
+        int glyph = numeral_font_glyph(font, text[i]);
+        if (glyph < 0) continue;
+        numeral_font_draw_glyph(font, target, glyph, x + i * font->advance, y, fg, bg, incremental);
+        drawn++;
+    }
+
+    state->font = font;
+    memcpy(state->shown, text, (size_t)len);
+    state->shown[len] = '\0';
+    state->x = x;
+    state->y = y;
+    state->len = len;
+    state->valid = true;
+    return drawn;
+}
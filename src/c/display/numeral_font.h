@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "raster.h"
+
+// =============================================================================
+// Numeral Font - Pre-rasterized Time Overlay Glyphs (No SDK Dependencies)
+// =============================================================================
+// Glyphs come from raw resources generated by tools/gen_numeral_fonts.py:
+//
+//   u8 width, u8 height, u8 advance, u8 count
+//   count bytes of character codes
+//   count glyphs of `height` rows, ceil(width / 8) bytes per row,
+//   bit 0 of each byte is the leftmost pixel
+//
+// Every glyph occupies the same cell, so text is composed by blitting cells
+// at a fixed advance and a changed character only touches its own cell.
+
+#define NUMERAL_TEXT_MAX 12
+
+typedef struct {
+    uint8_t width;
+    uint8_t height;
+    uint8_t advance;
+    uint8_t count;      // 0 when no font is loaded
+    int row_bytes;
+    const uint8_t *chars;
+    const uint8_t *bits;
+} NumeralFont;
+
+// Point `font` at resource data; returns false (and leaves count at 0) if malformed
+bool numeral_font_init(NumeralFont *font, const uint8_t *data, size_t size);
+
+// Glyph index for a character, or -1 if the font doesn't have it
+int numeral_font_glyph(const NumeralFont *font, char ch);
+
+// True when every character of `text` has a glyph and it fits NUMERAL_TEXT_MAX
+bool numeral_font_supports(const NumeralFont *font, const char *text);
+
+int numeral_font_text_width(const NumeralFont *font, int len);
+
+// Draw one glyph cell at (x, y). Opaque cells also paint `bg` where there is
+// no ink; transparent cells leave those pixels alone.
+void numeral_font_draw_glyph(const NumeralFont *font, const RasterTarget *target, int glyph,
+                             int x, int y, uint8_t fg, uint8_t bg, bool opaque);
+
+// =============================================================================
+// Numeral Text - Cell-Diffed Text Rendering
+// =============================================================================
+
+typedef struct {
+    const NumeralFont *font;
+    char shown[NUMERAL_TEXT_MAX + 1];
+    int x;
+    int y;
+    int len;
+    bool valid;
+} NumeralText;
+
+// Draw `text` centered in the rect. With `incremental` set, the framebuffer
+// must still hold the previous frame's text: if the layout is unchanged only
+// cells whose character changed are repainted, otherwise the old text is
+// cleared to `bg` first. Returns the number of glyph cells drawn.
+int numeral_text_draw(NumeralText *state, const NumeralFont *font, const RasterTarget *target,
+                      const char *text, int rect_x, int rect_y, int rect_w, int rect_h,
+                      uint8_t fg, uint8_t bg, bool incremental);
@@ -0,0 +1,324 @@
+#include "raster.h"
+#include "raster_kernels.h"
+
+// =============================================================================
+// Target Setup
+// =============================================================================
+
+void raster_target_init(RasterTarget *target, uint8_t *data, int stride, int width, int height,
+                        RasterFormat format) {
+    target->data = data;
+    target->stride = stride;
+    target->width = width;
+    target->height = height;
+    target->format = format;
+    target->row_fn = 0;
+    target->row_context = 0;
+    target->dither = 0;
+}
+
+RasterRow raster_target_row(const RasterTarget *target, int y) {
+    if (target->row_fn) {
+        return target->row_fn(target->row_context, y);
+    }
+    RasterRow row = {
+        .data = target->data + y * target->stride,
+        .min_x = 0,
+        .max_x = (int16_t)(target->width - 1)
+    };
+    return row;
+}
+
+bool raster_format_supported(RasterFormat format) {
+    return (format == RASTER_FORMAT_1BIT) ? RASTER_HAS_1BIT : RASTER_HAS_8BIT;
+}
+
+// Channel sum, 0 (black) to 9 (white)
+static inline int luminance(uint8_t argb) {
+    return ((argb >> 4) & 3) + ((argb >> 2) & 3) + (argb & 3);
+}
+
+// Monochrome: light colors (channel sum above half scale) become white
+static inline uint8_t mono_pixel(uint8_t argb) {
+    return (luminance(argb) >= 5) ? 1 : 0;
+}
+
+uint8_t raster_pixel_for(const RasterTarget *target, uint8_t argb) {
+    #if RASTER_HAS_1BIT && RASTER_HAS_8BIT
+        return (target->format == RASTER_FORMAT_8BIT) ? argb : mono_pixel(argb);
+    #elif RASTER_HAS_8BIT
+        (void)target;
+        return argb;
+    #else
+        (void)target;
+        return mono_pixel(argb);
+    #endif
+}
+
+// =============================================================================
+// Dither
+// =============================================================================
+
+// 4x4 Bayer patterns by level: one nibble per row, pixel 0 at bit 0
+static const uint8_t s_dither_patterns[RASTER_DITHER_LEVELS][4] = {
+    { 0x0, 0x0, 0x0, 0x0 },
+    { 0x1, 0x0, 0x0, 0x0 },
+    { 0x1, 0x0, 0x4, 0x0 },
+    { 0x5, 0x0, 0x4, 0x0 },
+    { 0x5, 0x0, 0x5, 0x0 },
+    { 0x5, 0x2, 0x5, 0x0 },
+    { 0x5, 0x2, 0x5, 0x8 },
+    { 0x5, 0xA, 0x5, 0x8 },
+    { 0x5, 0xA, 0x5, 0xA },
+    { 0x7, 0xA, 0x5, 0xA },
+    { 0x7, 0xA, 0xD, 0xA },
+    { 0xF, 0xA, 0xD, 0xA },
+    { 0xF, 0xA, 0xF, 0xA },
+    { 0xF, 0xB, 0xF, 0xA },
+    { 0xF, 0xB, 0xF, 0xE },
+    { 0xF, 0xF, 0xF, 0xE },
+    { 0xF, 0xF, 0xF, 0xF },
+};
+
+int raster_dither_level(uint8_t argb) {
+    return (luminance(argb) * (RASTER_DITHER_LEVELS - 1) + 4) / 9;
+}
+
+void raster_dither_init(RasterDither *dither, const uint8_t *argb, int count) {
+    if (count > RASTER_DITHER_COLORS) count = RASTER_DITHER_COLORS;
+    for (int i = 0; i < count; i++) {
+        const uint8_t *pattern = s_dither_patterns[raster_dither_level(argb[i])];
+        dither->argb[i] = argb[i];
+        for (int r = 0; r < 4; r++) {
+            dither->tiles[i].rows[r] = pattern[r] * 0x11111111u;
+        }
+    }
+    dither->count = count;
+}
+
+const RasterTile *raster_dither_tile(const RasterDither *dither, uint8_t argb) {
+    for (int i = 0; i < dither->count; i++) {
+        if (dither->argb[i] == argb) return &dither->tiles[i];
+    }
+    return 0;
+}
+
+bool raster_dither_lit(int level, int x, int y) {
+    if (level < 0) level = 0;
+    if (level >= RASTER_DITHER_LEVELS) level = RASTER_DITHER_LEVELS - 1;
+    return (s_dither_patterns[level][y & 3] >> (x & 3)) & 1;
+}
+
+#if RASTER_HAS_1BIT
+// Row `y` of what a 1-bit fill stores: the color's tile, or solid black or white
+static inline uint32_t pattern_1bit(const RasterTarget *target, int y, uint8_t argb) {
+    const RasterTile *tile = target->dither ? raster_dither_tile(target->dither, argb) : 0;
+    if (tile) return tile->rows[y & 3];
+    return mono_pixel(argb) ? ~0u : 0u;
+}
+#endif
+
+// =============================================================================
+// Fills
+// =============================================================================
+
+void raster_fill_span(const RasterTarget *target, int y, int x0, int x1, uint8_t argb) {
+    if (y < 0 || y >= target->height) return;
+
+    RasterRow row = raster_target_row(target, y);
+    if (x0 < row.min_x) x0 = row.min_x;
+    if (x1 > row.max_x) x1 = row.max_x;
+    if (x0 > x1) return;
+
+    #if RASTER_HAS_1BIT && RASTER_HAS_8BIT
+        if (target->format == RASTER_FORMAT_8BIT) {
+            raster_row_fill_8bit(row.data, x0, x1, argb);
+        } else {
+            raster_row_pattern_1bit(row.data, x0, x1, pattern_1bit(target, y, argb));
+        }
+    #elif RASTER_HAS_8BIT
+        raster_row_fill_8bit(row.data, x0, x1, argb);
+    #else
+        raster_row_pattern_1bit(row.data, x0, x1, pattern_1bit(target, y, argb));
+    #endif
+}
+
+void raster_fill_rect(const RasterTarget *target, int x, int y, int w, int h, uint8_t argb) {
+    if (w <= 0 || h <= 0) return;
+
+    int y0 = (y < 0) ? 0 : y;
+    int y1 = (y + h > target->height) ? target->height : y + h;
+    for (int row = y0; row < y1; row++) {
+        raster_fill_span(target, row, x, x + w - 1, argb);
+    }
+}
+
+int raster_corner_inset(int radius, int dy) {
+    if (dy >= radius) return 0;
+
+    // Smallest inset whose pixel center lies inside the corner circle
+    // (coordinates doubled to stay in integers)
+    int r2 = 4 * radius * radius;
+    int ddy = 2 * radius - 2 * dy - 1;
+    for (int inset = 0; inset < radius; inset++) {
+        int ddx = 2 * radius - 2 * inset - 1;
+        if (ddx * ddx + ddy * ddy <= r2) {
+            return inset;
+        }
+    }
+    return radius;
+}
+
+static int clamp_radius(int radius, int w, int h) {
+    int max_radius = ((w < h) ? w : h) / 2;
+    if (radius > max_radius) radius = max_radius;
+    if (radius < 0) radius = 0;
+    return radius;
+}
+
+void raster_fill_round_rect(const RasterTarget *target, int x, int y, int w, int h, int radius, uint8_t argb) {
+    if (w <= 0 || h <= 0) return;
+    radius = clamp_radius(radius, w, h);
+    if (radius == 0) {
+        raster_fill_rect(target, x, y, w, h, argb);
+        return;
+    }
+
+    for (int r = 0; r < h; r++) {
+        int edge_dist = (r < h - 1 - r) ? r : h - 1 - r;
+        int inset = raster_corner_inset(radius, edge_dist);
+        raster_fill_span(target, y + r, x + inset, x + w - 1 - inset, argb);
+    }
+}
+
+void raster_draw_round_rect(const RasterTarget *target, int x, int y, int w, int h, int radius, uint8_t argb) {
+    if (w <= 0 || h <= 0) return;
+    radius = clamp_radius(radius, w, h);
+
+    for (int r = 0; r < h; r++) {
+        int edge_dist = (r < h - 1 - r) ? r : h - 1 - r;
+        int inset = raster_corner_inset(radius, edge_dist);
+
+        if (edge_dist == 0) {
+            raster_fill_span(target, y + r, x + inset, x + w - 1 - inset, argb);
+            continue;
+        }
+
+        // Bridge the step to the row nearer the edge so the outline stays closed
+        int outer_inset = raster_corner_inset(radius, edge_dist - 1);
+        int reach = (outer_inset - 1 > inset) ? outer_inset - 1 : inset;
+        raster_fill_span(target, y + r, x + inset, x + reach, argb);
+        raster_fill_span(target, y + r, x + w - 1 - reach, x + w - 1 - inset, argb);
+    }
+}
+
+// =============================================================================
+// Arcs
+// =============================================================================
+
+#define SPAN_UNBOUNDED 0x7FFF
+
+typedef struct {
+    int lo;
+    int hi;
+} Span;
+
+static int32_t isqrt(int32_t n) {
+    int32_t root = 0;
+    int32_t bit = (int32_t)1 << 30;
+    while (bit > n) bit >>= 2;
+    while (bit) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+// Largest |dx| with dx * dx + dy * dy < r * r on row dy, or -1 if none
+static int chord_half_width(int r, int dy) {
+    int32_t room = (int32_t)r * r - (int32_t)dy * dy - 1;
+    return (room < 0) ? -1 : (int)isqrt(room);
+}
+
+static int32_t div_floor(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) q--;
+    return q;
+}
+
+// Row dy of the half-plane dx * end_y >= dy * end_x (points up to half a
+// turn counterclockwise of the end direction); false if the row misses it
+static bool end_half_plane(int dy, int32_t end_x, int32_t end_y, Span *span) {
+    int32_t rhs = (int32_t)dy * end_x;
+    span->lo = -SPAN_UNBOUNDED;
+    span->hi = SPAN_UNBOUNDED;
+    if (end_y > 0) {
+        span->lo = (int)-div_floor(-rhs, end_y);
+    } else if (end_y < 0) {
+        span->hi = (int)div_floor(rhs, end_y);
+    } else {
+        return rhs <= 0;
+    }
+    return true;
+}
+
+void raster_fill_annulus_sector(const RasterTarget *target, int cx, int cy, int inner_r, int outer_r,
+                                int32_t end_x, int32_t end_y, uint8_t argb) {
+    if (inner_r < 0) inner_r = 0;
+    if (outer_r <= inner_r) return;
+
+    // Up to half a turn the sector is the right half-plane and the end
+    // half-plane; beyond that it is their union
+    bool full = end_x == 0 && end_y <= 0;
+    bool within_half = end_x > 0 || (end_x == 0 && end_y > 0);
+    const Span right = { 0, SPAN_UNBOUNDED };
+
+    for (int dy = 1 - outer_r; dy < outer_r; dy++) {
+        int y = cy + dy;
+        if (y < 0 || y >= target->height) continue;
+
+        Span band[2];
+        int bands = 0;
+        int xo = chord_half_width(outer_r, dy);
+        int xi = chord_half_width(inner_r, dy);
+        if (xo < 0) continue;
+        if (xi < 0) {
+            band[bands++] = (Span){ -xo, xo };
+        } else if (xi < xo) {
+            band[bands++] = (Span){ -xo, -xi - 1 };
+            band[bands++] = (Span){ xi + 1, xo };
+        }
+
+        Span allowed[2];
+        int spans = 0;
+        Span end;
+        bool end_hit = !full && end_half_plane(dy, end_x, end_y, &end);
+        if (full) {
+            allowed[spans++] = (Span){ -SPAN_UNBOUNDED, SPAN_UNBOUNDED };
+        } else if (within_half) {
+            if (end_hit) {
+                allowed[spans++] = (Span){ (end.lo > 0) ? end.lo : 0, end.hi };
+            }
+        } else if (!end_hit) {
+            allowed[spans++] = right;
+        } else if (end.hi >= -1) {
+            allowed[spans++] = (Span){ (end.lo < 0) ? end.lo : 0, SPAN_UNBOUNDED };
+        } else {
+            allowed[spans++] = end;
+            allowed[spans++] = right;
+        }
+
+        for (int b = 0; b < bands; b++) {
+            for (int a = 0; a < spans; a++) {
+                int lo = (band[b].lo > allowed[a].lo) ? band[b].lo : allowed[a].lo;
+                int hi = (band[b].hi < allowed[a].hi) ? band[b].hi : allowed[a].hi;
+                if (lo <= hi) raster_fill_span(target, y, cx + lo, cx + hi, argb);
+            }
+        }
+    }
+}
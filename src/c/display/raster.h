@@ -0,0 +1,137 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// =============================================================================
+// Raster Kernels - Direct Framebuffer Writes (No SDK Dependencies)
+// =============================================================================
+// Rectangle-oriented fills that write framebuffer rows directly instead of
+// going through one graphics_* call per primitive. Rows are filled a 32-bit
+// word at a time: four packed pixels on 8-bit color framebuffers, 32 pixels
+// on 1-bit framebuffers. The SDK glue lives in raster_surface.c.
+//
+// Row kernels are specialized per framebuffer depth (raster_1bit.c and
+// raster_8bit.c). wscript defines RASTER_DEPTH as 1 or 8 for each platform
+// and links only the matching kernel, so format checks fold away at compile
+// time. Host builds leave RASTER_DEPTH unset and keep both kernels behind a
+// runtime format switch.
+
+#if !defined(RASTER_DEPTH)
+  #define RASTER_HAS_1BIT 1
+  #define RASTER_HAS_8BIT 1
+#elif RASTER_DEPTH == 1
+  #define RASTER_HAS_1BIT 1
+  #define RASTER_HAS_8BIT 0
+#elif RASTER_DEPTH == 8
+  #define RASTER_HAS_1BIT 0
+  #define RASTER_HAS_8BIT 1
+#else
+  #error "RASTER_DEPTH must be 1 or 8"
+#endif
+
+typedef enum {
+    RASTER_FORMAT_1BIT,  // aplite, diorite, flint: 1 bpp, LSB is the leftmost pixel
+    RASTER_FORMAT_8BIT   // basalt, chalk, emery: one GColor8 byte per pixel
+} RasterFormat;
+
+// One framebuffer row. data points at pixel x = 0 (bit 0 of byte 0 on 1-bit),
+// and only columns [min_x, max_x] are backed by memory.
+typedef struct {
+    uint8_t *data;
+    int16_t min_x;
+    int16_t max_x;
+} RasterRow;
+
+typedef RasterRow (*RasterRowFn)(void *context, int y);
+
+typedef struct RasterDither RasterDither;
+
+typedef struct {
+    uint8_t *data;
+    int stride;
+    int width;
+    int height;
+    RasterFormat format;
+    RasterRowFn row_fn;   // Optional: per-row lookup for non-linear (round) framebuffers
+    void *row_context;
+    const RasterDither *dither;   // Optional: 1-bit colors to fill as patterns (see Dither)
+} RasterTarget;
+
+// =============================================================================
+// Target Setup
+// =============================================================================
+
+// Describe a linear framebuffer (every row `stride` bytes apart, full width)
+void raster_target_init(RasterTarget *target, uint8_t *data, int stride, int width, int height,
+                        RasterFormat format);
+
+RasterRow raster_target_row(const RasterTarget *target, int y);
+
+// Whether this build carries a kernel for `format`
+bool raster_format_supported(RasterFormat format);
+
+// Convert a GColor8 ARGB byte into the target's pixel value
+uint8_t raster_pixel_for(const RasterTarget *target, uint8_t argb);
+
+// =============================================================================
+// Dither (1-bit)
+// =============================================================================
+// On 1-bit targets, colors can fill as a 4x4 ordered-dither pattern of their
+// luminance instead of the nearest of black and white. The patterns are a
+// const table in flash; a RasterDither holds tiles for the few colors of a
+// palette, rendered when the palette changes. The pattern repeats every 4
+// pixels, so a tile row is one word stored across the whole span and a
+// dithered fill costs what a solid one does. Other colors stay solid.
+
+#define RASTER_DITHER_LEVELS 17   // 0 (black) to 16 (white) lit pixels of 16
+#define RASTER_DITHER_COLORS 4
+
+typedef struct {
+    uint32_t rows[4];   // 1-bit words, the pattern's row repeated 8 times
+} RasterTile;
+
+struct RasterDither {
+    uint8_t argb[RASTER_DITHER_COLORS];
+    RasterTile tiles[RASTER_DITHER_COLORS];
+    int count;
+};
+
+// Lit pixels of 16 for a GColor8, from its luminance
+int raster_dither_level(uint8_t argb);
+
+// Render the tiles for up to RASTER_DITHER_COLORS colors
+void raster_dither_init(RasterDither *dither, const uint8_t *argb, int count);
+
+// The tile `argb` fills with, or NULL if it has none
+const RasterTile *raster_dither_tile(const RasterDither *dither, uint8_t argb);
+
+// Whether pixel (x, y) is lit in the pattern for `level` lit pixels of 16
+bool raster_dither_lit(int level, int x, int y);
+
+// =============================================================================
+// Fills (clipped to the target; color is a GColor8 ARGB byte)
+// =============================================================================
+
+void raster_fill_span(const RasterTarget *target, int y, int x0, int x1, uint8_t argb);
+void raster_fill_rect(const RasterTarget *target, int x, int y, int w, int h, uint8_t argb);
+void raster_fill_round_rect(const RasterTarget *target, int x, int y, int w, int h, int radius, uint8_t argb);
+
+// One pixel wide outline, matching graphics_draw_round_rect with stroke width 1
+void raster_draw_round_rect(const RasterTarget *target, int x, int y, int w, int h, int radius, uint8_t argb);
+
+// Horizontal inset of row `dy` (0 = top or bottom row) for a corner radius
+int raster_corner_inset(int radius, int dy);
+
+// =============================================================================
+// Arcs
+// =============================================================================
+
+// Annulus sector: every pixel whose center lies at a distance in
+// [inner_r, outer_r) from (cx, cy) and clockwise from 12 o'clock up to the
+// direction (end_x, end_y), given in screen axes at any scale (e.g. the sin
+// and -cos of the sweep). A direction straight up, or zero, fills the whole
+// annulus. Rows are filled as at most four spans, found from the circle
+// chords and the two half-planes bounding the sector.
+void raster_fill_annulus_sector(const RasterTarget *target, int cx, int cy, int inner_r, int outer_r,
+                                int32_t end_x, int32_t end_y, uint8_t argb);
@@ -0,0 +1,62 @@
+#include "raster_kernels.h"
+
+#if RASTER_HAS_1BIT
+
+// =============================================================================
+// 1-bit Row Kernel (aplite, diorite, flint)
+// =============================================================================
+
+static inline void apply_mask_word(RasterWord *w, uint32_t mask, uint32_t pattern) {
+    *w = (*w & ~mask) | (pattern & mask);
+}
+
+static inline void apply_mask_byte(uint8_t *b, uint8_t mask, uint8_t pattern) {
+    *b = (uint8_t)((*b & ~mask) | (pattern & mask));
+}
+
+// Rows that don't start on a word boundary are filled a byte (8 pixels) at a
+// time; a 4 pixel pattern is the same in every byte
+static void pattern_row_bytes(uint8_t *row, int x0, int x1, uint8_t pattern) {
+    int b0 = x0 >> 3;
+    int b1 = x1 >> 3;
+    uint8_t first_mask = (uint8_t)(0xFFu << (x0 & 7));
+    uint8_t last_mask = (uint8_t)(0xFFu >> (7 - (x1 & 7)));
+
+    if (b0 == b1) {
+        apply_mask_byte(&row[b0], first_mask & last_mask, pattern);
+        return;
+    }
+
+    apply_mask_byte(&row[b0], first_mask, pattern);
+    for (int b = b0 + 1; b < b1; b++) {
+        row[b] = pattern;
+    }
+    apply_mask_byte(&row[b1], last_mask, pattern);
+}
+
+void raster_row_pattern_1bit(uint8_t *row, int x0, int x1, uint32_t pattern) {
+    if ((uintptr_t)row & 3) {
+        pattern_row_bytes(row, x0, x1, (uint8_t)pattern);
+        return;
+    }
+
+    // 32 pixels per word; bit 0 is the leftmost pixel on little-endian ARM
+    RasterWord *words = (RasterWord *)row;
+    int w0 = x0 >> 5;
+    int w1 = x1 >> 5;
+    uint32_t first_mask = ~0u << (x0 & 31);
+    uint32_t last_mask = ~0u >> (31 - (x1 & 31));
+
+    if (w0 == w1) {
+        apply_mask_word(&words[w0], first_mask & last_mask, pattern);
+        return;
+    }
+
+    apply_mask_word(&words[w0], first_mask, pattern);
+    for (int w = w0 + 1; w < w1; w++) {
+        words[w] = pattern;
+    }
+    apply_mask_word(&words[w1], last_mask, pattern);
+}
+
+#endif
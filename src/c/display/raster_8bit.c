@@ -0,0 +1,48 @@
+#include "raster_kernels.h"
+
+#if RASTER_HAS_8BIT
+
+// =============================================================================
+// 8-bit Row Kernel (basalt, chalk, emery)
+// =============================================================================
+
+void raster_row_fill_8bit(uint8_t *row, int x0, int x1, uint8_t pixel) {
+    uint8_t *p = row + x0;
+    int n = x1 - x0 + 1;
+
+    // Short spans (grid cells, bar caps) aren't worth aligning
+    if (n < 8) {
+        while (n-- > 0) {
+            *p++ = pixel;
+        }
+        return;
+    }
+
+    while ((uintptr_t)p & 3) {
+        *p++ = pixel;
+        n--;
+    }
+
+    // Four packed pixels per store
+    RasterWord packed = (RasterWord)pixel * 0x01010101u;
+    RasterWord *w = (RasterWord *)p;
+    while (n >= 16) {
+        w[0] = packed;
+        w[1] = packed;
+        w[2] = packed;
+        w[3] = packed;
+        w += 4;
+        n -= 16;
+    }
+    while (n >= 4) {
+        *w++ = packed;
+        n -= 4;
+    }
+
+    p = (uint8_t *)w;
+    while (n-- > 0) {
+        *p++ = pixel;
+    }
+}
+
+#endif
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "raster.h"
+
+// =============================================================================
+// Depth-Specialized Row Kernels (internal to the raster backend)
+// =============================================================================
+// Each kernel lives in its own translation unit so wscript can link only the
+// variant that matches a platform's framebuffer depth.
+
+// Word-wide stores into byte-addressed framebuffer memory
+typedef uint32_t __attribute__((__may_alias__)) RasterWord;
+
+#if RASTER_HAS_1BIT
+// Store a pattern repeating every 4 pixels (or any divisor of 32) into
+// pixels [x0, x1] of a 1 bpp row: `pattern` is one word of it, pixel 0 at
+// bit 0. Solid fills are all ones or all zeros.
+void raster_row_pattern_1bit(uint8_t *row, int x0, int x1, uint32_t pattern);
+#endif
+
+#if RASTER_HAS_8BIT
+// Store `pixel` into columns [x0, x1] of a GColor8 row
+void raster_row_fill_8bit(uint8_t *row, int x0, int x1, uint8_t pixel);
+#endif
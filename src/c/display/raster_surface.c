@@ -0,0 +1,147 @@
+#include "raster_surface.h"
+
+// =============================================================================
+// Framebuffer Capture
+// =============================================================================
+
+static const RasterDither *s_dither;
+
+#if RASTER_HAS_8BIT
+// Round displays store a different span of columns on every row
+static RasterRow circular_row(void *context, int y) {
+    GBitmapDataRowInfo info = gbitmap_get_data_row_info((GBitmap *)context, y);
+    RasterRow row = {
+        .data = info.data,
+        .min_x = info.min_x,
+        .max_x = info.max_x
+    };
+    return row;
+}
+#endif
+
+// Only formats whose kernel was linked into this platform's binary are accepted
+static bool target_from_framebuffer(RasterTarget *target, GBitmap *fb) {
+    GRect bounds = gbitmap_get_bounds(fb);
+    uint8_t *data = gbitmap_get_data(fb);
+    int stride = gbitmap_get_bytes_per_row(fb);
+    
+    switch (gbitmap_get_format(fb)) {
+        #if RASTER_HAS_1BIT
+        case GBitmapFormat1Bit:
+            raster_target_init(target, data, stride, bounds.size.w, bounds.size.h, RASTER_FORMAT_1BIT);
+            return true;
+        #endif
+        #if RASTER_HAS_8BIT
+        case GBitmapFormat8Bit:
+            raster_target_init(target, data, stride, bounds.size.w, bounds.size.h, RASTER_FORMAT_8BIT);
+            return true;
+        case GBitmapFormat8BitCircular:
+            raster_target_init(target, data, stride, bounds.size.w, bounds.size.h, RASTER_FORMAT_8BIT);
+            target->row_fn = circular_row;
+            target->row_context = fb;
+            return true;
+        #endif
+        default:
+            return false;
+    }
+}
+
+void raster_surface_begin(RasterSurface *surface, GContext *ctx) {
+    surface->ctx = ctx;
+    surface->framebuffer = NULL;
+    surface->state = (DrawStateCache){ 0 };
+    
+    #if RASTER_BACKEND_ENABLED
+        GBitmap *fb = graphics_capture_frame_buffer(ctx);
+        if (!fb) {
+            return;
+        }
+        if (target_from_framebuffer(&surface->target, fb)) {
+            surface->target.dither = s_dither;
+            surface->framebuffer = fb;
+        } else {
+            graphics_release_frame_buffer(ctx, fb);
+        }
+    #endif
+}
+
+void raster_surface_end(RasterSurface *surface) {
+    if (surface->framebuffer) {
+        graphics_release_frame_buffer(surface->ctx, surface->framebuffer);
+        surface->framebuffer = NULL;
+    }
+}
+
+bool raster_surface_is_direct(const RasterSurface *surface) {
+    return surface->framebuffer != NULL;
+}
+
+void raster_surface_set_dither(const RasterDither *dither) {
+    s_dither = dither;
+}
+
+// =============================================================================
+// Primitives
+// =============================================================================
+
+void raster_surface_fill_rect(RasterSurface *surface, GRect rect, uint16_t radius, GColor color) {
+    if (surface->framebuffer) {
+        raster_fill_round_rect(&surface->target, rect.origin.x, rect.origin.y,
+                               rect.size.w, rect.size.h, radius, color.argb);
+        return;
+    }
+    if (draw_state_fill(&surface->state, color.argb)) {
+        graphics_context_set_fill_color(surface->ctx, color);
+    }
+    graphics_fill_rect(surface->ctx, rect, radius, radius ? GCornersAll : GCornerNone);
+}
+
+void raster_surface_draw_round_rect(RasterSurface *surface, GRect rect, uint16_t radius, GColor color) {
+    if (surface->framebuffer) {
+        raster_draw_round_rect(&surface->target, rect.origin.x, rect.origin.y,
+                               rect.size.w, rect.size.h, radius, color.argb);
+        return;
+    }
+    if (draw_state_stroke(&surface->state, color.argb)) {
+        graphics_context_set_stroke_color(surface->ctx, color);
+    }
+    if (draw_state_stroke_width(&surface->state, 1)) {
+        graphics_context_set_stroke_width(surface->ctx, 1);
+    }
+    graphics_draw_round_rect(surface->ctx, rect, radius);
+}
+
+void raster_surface_fill_arc(RasterSurface *surface, GPoint center, int inner_r, int outer_r,
+                             int32_t sweep, GColor color) {
+    if (sweep <= 0 || outer_r <= inner_r) {
+        return;
+    }
+    if (surface->framebuffer) {
+        // A zero direction is the full turn
+        bool full = sweep >= TRIG_MAX_ANGLE;
+        raster_fill_annulus_sector(&surface->target, center.x, center.y, inner_r, outer_r,
+                                   full ? 0 : sin_lookup(sweep), full ? 0 : -cos_lookup(sweep),
+                                   color.argb);
+        return;
+    }
+
+    if (draw_state_fill(&surface->state, color.argb)) {
+        graphics_context_set_fill_color(surface->ctx, color);
+    }
+    #if RASTER_NATIVE_RADIAL
+        GRect box = GRect(center.x - outer_r, center.y - outer_r, 2 * outer_r, 2 * outer_r);
+        graphics_fill_radial(surface->ctx, box, GOvalScaleModeFitCircle, (uint16_t)(outer_r - inner_r),
+                             0, sweep);
+    #else
+        // Overlapping dots every 3 degrees along the middle of the band
+        int dot_radius = (outer_r - inner_r) / 2;
+        int radius = outer_r - dot_radius;
+        for (int32_t angle = 0; angle < sweep; angle += TRIG_MAX_ANGLE / 120) {
+            int32_t a = angle - TRIG_MAX_ANGLE / 4;
+            graphics_fill_circle(surface->ctx,
+                                 GPoint(center.x + cos_lookup(a) * radius / TRIG_MAX_RATIO,
+                                        center.y + sin_lookup(a) * radius / TRIG_MAX_RATIO),
+                                 dot_radius);
+        }
+    #endif
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <pebble.h>
+#include "raster.h"
+#include "draw_batch.h"
+
+// =============================================================================
+// Raster Surface - Framebuffer Backend with SDK Fallback
+// =============================================================================
+// Rectangle-heavy modes opt in by drawing fills through a RasterSurface. When
+// the framebuffer can be captured, fills are written straight into its rows;
+// otherwise (or with RASTER_BACKEND_ENABLED set to 0) every call falls back
+// to the equivalent graphics_* primitive. The fallback sets colors through
+// the surface's DrawStateCache (draw_batch.h), so a run of one color sets it
+// once; callers that set the context themselves go through it too.
+//
+// graphics_* calls must not be made while a surface is active: end it before
+// drawing text, lines or circles. Coordinates are framebuffer coordinates,
+// which match the canvas layer because it covers the whole window.
+
+#ifndef RASTER_BACKEND_ENABLED
+  #define RASTER_BACKEND_ENABLED 1
+#endif
+
+// graphics_fill_radial is only used on color platforms. Aplite lacks it, and
+// on 1-bit screens the annulus rasterizer dithers like every other fill;
+// without a framebuffer they draw a ring of dots.
+#ifdef PBL_BW
+  #define RASTER_NATIVE_RADIAL 0
+#else
+  #define RASTER_NATIVE_RADIAL 1
+#endif
+
+typedef struct {
+    GContext *ctx;
+    GBitmap *framebuffer;  // NULL when drawing through the SDK
+    RasterTarget target;
+    DrawStateCache state;  // Context state the SDK calls have set; begin forgets it
+} RasterSurface;
+
+void raster_surface_begin(RasterSurface *surface, GContext *ctx);
+void raster_surface_end(RasterSurface *surface);
+
+// True when fills go straight to the framebuffer through surface->target
+bool raster_surface_is_direct(const RasterSurface *surface);
+
+// Tiles that surfaces begun from now on fill 1-bit framebuffers with (see
+// Dither in raster.h); NULL fills every color solid. Kept by pointer.
+void raster_surface_set_dither(const RasterDither *dither);
+
+void raster_surface_fill_rect(RasterSurface *surface, GRect rect, uint16_t radius, GColor color);
+void raster_surface_draw_round_rect(RasterSurface *surface, GRect rect, uint16_t radius, GColor color);
+
+// Annulus sector covering radii [inner_r, outer_r), clockwise from 12 o'clock
+// through `sweep` (TRIG_MAX_ANGLE is a full turn). Direct surfaces rasterize
+// it; otherwise it is one graphics_fill_radial call where the platform has
+// it, and dots along the band where it doesn't.
+void raster_surface_fill_arc(RasterSurface *surface, GPoint center, int inner_r, int outer_r,
+                             int32_t sweep, GColor color);
@@ -0,0 +1,96 @@
+#include <stddef.h>
+#include "reflow.h"
+
+#define REFLOW_TYPES (DL_IMAGE + 1)
+
+// =============================================================================
+// Interpolation
+// =============================================================================
+
+int reflow_lerp(int from, int to, int32_t progress) {
+    if (progress <= 0) return from;
+    if (progress >= REFLOW_PROGRESS_MAX) return to;
+    return from + (int)((int32_t)(to - from) * progress / REFLOW_PROGRESS_MAX);
+}
+
+DlRect reflow_rect(DlRect from, DlRect to, int32_t progress) {
+    DlRect r = {
+        (int16_t)reflow_lerp(from.x, to.x, progress),
+        (int16_t)reflow_lerp(from.y, to.y, progress),
+        (int16_t)reflow_lerp(from.w, to.w, progress),
+        (int16_t)reflow_lerp(from.h, to.h, progress)
+    };
+    return r;
+}
+
+// =============================================================================
+// Display Lists
+// =============================================================================
+
+static void prim_fields(DlPrim *prim, int16_t *fields[REFLOW_FIELDS]) {
+    fields[0] = &prim->rect.x;
+    fields[1] = &prim->rect.y;
+    fields[2] = &prim->rect.w;
+    fields[3] = &prim->rect.h;
+    fields[4] = &prim->a;
+    fields[5] = &prim->b;
+    fields[6] = &prim->c;
+    fields[7] = &prim->d;
+}
+
+void list_reflow_from(ListReflow *reflow, const DisplayList *from) {
+    reflow->count = from->count;
+    for (int i = 0; i < from->count; i++) {
+        DlPrim prim = from->prims[i];
+        int16_t *fields[REFLOW_FIELDS];
+        prim_fields(&prim, fields);
+        for (int f = 0; f < REFLOW_FIELDS; f++) {
+            reflow->delta[i][f] = *fields[f];
+        }
+        reflow->type[i] = prim.type;
+        reflow->font[i] = prim.font;
+        reflow->flags[i] = prim.flags;
+    }
+}
+
+void list_reflow_to(ListReflow *reflow, const DisplayList *to) {
+    if (to->count < reflow->count) {
+        reflow->count = to->count;
+    }
+    for (int i = 0; i < reflow->count; i++) {
+        DlPrim prim = to->prims[i];
+        int16_t *fields[REFLOW_FIELDS];
+        prim_fields(&prim, fields);
+
+        bool paired = reflow->type[i] == prim.type && reflow->font[i] == prim.font &&
+                      reflow->flags[i] == prim.flags;
+        for (int f = 0; f < REFLOW_FIELDS; f++) {
+            reflow->delta[i][f] = paired ? (int16_t)(reflow->delta[i][f] - *fields[f]) : 0;
+        }
+        reflow->type[i] = prim.type;
+    }
+}
+
+void list_reflow_apply(const ListReflow *reflow, DisplayList *list, int32_t progress) {
+    if (progress >= REFLOW_PROGRESS_MAX) return;
+    int32_t left = REFLOW_PROGRESS_MAX - (progress > 0 ? progress : 0);
+
+    const int16_t *last[REFLOW_TYPES] = { NULL };
+    for (int i = 0; i < list->count; i++) {
+        DlPrim *prim = &list->prims[i];
+        if (prim->type >= REFLOW_TYPES) continue;
+
+        const int16_t *delta = last[prim->type];
+        if (i < reflow->count && reflow->type[i] == prim->type) {
+            delta = reflow->delta[i];
+            last[prim->type] = delta;
+        }
+        if (!delta) continue;
+
+        int16_t *fields[REFLOW_FIELDS];
+        prim_fields(prim, fields);
+        for (int f = 0; f < REFLOW_FIELDS; f++) {
+            *fields[f] = (int16_t)(*fields[f] + (int32_t)delta[f] * left / REFLOW_PROGRESS_MAX);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "display_list.h"
+
+// =============================================================================
+// Layout Reflow - Sliding Between Two Layouts (No SDK Dependencies)
+// =============================================================================
+// When the unobstructed area changes (Timeline Quick View sliding in or
+// out), a layout is made once for the area the slide starts from and once
+// for where it ends. The steps in between are interpolated from the two
+// instead of laying the mode out again at every height.
+//
+// A list mode keeps emitting every frame, since what it shows moves on, but
+// for the end area only. list_reflow_apply then moves each primitive back by
+// the share of the slide still to go, using how it differed between the two
+// layouts. Only the fields that differ (positions, a radius that shrinks)
+// move; the SDK glue lives in display_modes.c.
+
+#define REFLOW_PROGRESS_MAX 65535   // ANIMATION_NORMALIZED_MAX
+
+// `progress` of the way from `from` to `to`
+int reflow_lerp(int from, int to, int32_t progress);
+DlRect reflow_rect(DlRect from, DlRect to, int32_t progress);
+
+// Geometry fields interpolated: rect x, y, w, h, then a, b, c, d
+#define REFLOW_FIELDS 8
+
+typedef struct {
+    int16_t delta[DISPLAY_LIST_MAX][REFLOW_FIELDS];   // Start layout minus end layout
+    uint8_t type[DISPLAY_LIST_MAX];
+    uint8_t font[DISPLAY_LIST_MAX];
+    uint8_t flags[DISPLAY_LIST_MAX];
+    int count;
+} ListReflow;
+
+// Record the list laid out for the start area, then how each primitive of
+// it differs from the one at the same place in the list for the end area.
+// Both must be emitted from the same state, so only layout differs; pairs
+// that aren't the same kind of primitive don't move. (Two steps, so the
+// caller needs only one list.)
+void list_reflow_from(ListReflow *reflow, const DisplayList *from);
+void list_reflow_to(ListReflow *reflow, const DisplayList *to);
+
+// Move `list`, laid out for the end area, back to `progress` of the way there
+// from the start. A primitive without a counterpart of its type (the sand
+// has grown a row since) moves with the last one of its type before it.
+void list_reflow_apply(const ListReflow *reflow, DisplayList *list, int32_t progress);
@@ -0,0 +1,122 @@
+#include <string.h>
+#include "thumbnail.h"
+
+// =============================================================================
+// Slots
+// =============================================================================
+
+void thumbnail_atlas_init(ThumbnailAtlas *atlas, uint8_t *data, int stride, RasterFormat format, int count) {
+    if (count > THUMBNAIL_MAX_SLOTS) count = THUMBNAIL_MAX_SLOTS;
+    if (count < 0) count = 0;
+    raster_target_init(&atlas->target, data, stride, THUMBNAIL_WIDTH, count * THUMBNAIL_HEIGHT, format);
+    atlas->count = count;
+    atlas->valid = 0;
+}
+
+int thumbnail_atlas_slot_y(int slot) {
+    return slot * THUMBNAIL_HEIGHT;
+}
+
+void thumbnail_atlas_invalidate(ThumbnailAtlas *atlas, int slot) {
+    if (slot < 0 || slot >= atlas->count) return;
+    atlas->valid &= ~(1u << slot);
+}
+
+bool thumbnail_atlas_is_valid(const ThumbnailAtlas *atlas, int slot) {
+    if (slot < 0 || slot >= atlas->count) return false;
+    return (atlas->valid >> slot) & 1;
+}
+
+int thumbnail_atlas_next_pending(const ThumbnailAtlas *atlas) {
+    for (int slot = 0; slot < atlas->count; slot++) {
+        if (!((atlas->valid >> slot) & 1)) return slot;
+    }
+    return -1;
+}
+
+// =============================================================================
+// Shrinking
+// =============================================================================
+
+// Sums over one box of source pixels: channels on 8-bit, lit pixels (in r)
+// on 1-bit
+typedef struct {
+    uint16_t r, g, b, count;
+} BoxSum;
+
+static void add_row(const RasterTarget *source, int sy, int x, int width, int dw, BoxSum *boxes) {
+    RasterRow row = raster_target_row(source, sy);
+    int first = x > row.min_x ? x : row.min_x;
+    int last = x + width - 1 < row.max_x ? x + width - 1 : row.max_x;
+    for (int sx = first; sx <= last; sx++) {
+        BoxSum *box = &boxes[(sx - x) * dw / width];
+        if (source->format == RASTER_FORMAT_1BIT) {
+            box->r += (row.data[sx >> 3] >> (sx & 7)) & 1;
+        } else {
+            uint8_t argb = row.data[sx];
+            box->r += (argb >> 4) & 3;
+            box->g += (argb >> 2) & 3;
+            box->b += argb & 3;
+        }
+        box->count++;
+    }
+}
+
+// Channel average, rounded
+static inline int average(int sum, int count) {
+    return (sum + count / 2) / count;
+}
+
+static void store_pixel(const ThumbnailAtlas *atlas, RasterRow row, int x, int y, const BoxSum *box) {
+    if (box->count == 0) return;
+    if (atlas->target.format == RASTER_FORMAT_1BIT) {
+        int level = average(box->r * (RASTER_DITHER_LEVELS - 1), box->count);
+        if (raster_dither_lit(level, x, y)) {
+            row.data[x >> 3] |= (uint8_t)(1 << (x & 7));
+        }
+    } else {
+        row.data[x] = (uint8_t)(0xC0 | average(box->r, box->count) << 4 |
+                                average(box->g, box->count) << 2 | average(box->b, box->count));
+    }
+}
+
+void thumbnail_atlas_store(ThumbnailAtlas *atlas, int slot, const RasterTarget *source,
+                           int x, int y, int width, int height) {
+    if (slot < 0 || slot >= atlas->count || width <= 0 || height <= 0) return;
+    if (source->format != atlas->target.format) return;
+
+    // The largest area of the source's shape that fits the slot
+    int dw = THUMBNAIL_WIDTH;
+    int dh = height * THUMBNAIL_WIDTH / width;
+    if (dh > THUMBNAIL_HEIGHT) {
+        dh = THUMBNAIL_HEIGHT;
+        dw = width * THUMBNAIL_HEIGHT / height;
+    }
+    if (dw < 1) dw = 1;
+    if (dh < 1) dh = 1;
+    int left = (THUMBNAIL_WIDTH - dw) / 2;
+    int top = thumbnail_atlas_slot_y(slot) + (THUMBNAIL_HEIGHT - dh) / 2;
+
+    int row_bytes = (atlas->target.format == RASTER_FORMAT_1BIT) ? THUMBNAIL_WIDTH / 8 : THUMBNAIL_WIDTH;
+    for (int row = 0; row < THUMBNAIL_HEIGHT; row++) {
+        memset(raster_target_row(&atlas->target, thumbnail_atlas_slot_y(slot) + row).data, 0, row_bytes);
+    }
+
+    for (int v = 0; v < dh; v++) {
+        BoxSum boxes[THUMBNAIL_WIDTH];
+        memset(boxes, 0, sizeof(boxes));
+        int y0 = y + v * height / dh;
+        int y1 = y + (v + 1) * height / dh;
+        for (int sy = y0; sy < y1; sy++) {
+            if (sy >= 0 && sy < source->height) {
+                add_row(source, sy, x, width, dw, boxes);
+            }
+        }
+
+        RasterRow out = raster_target_row(&atlas->target, top + v);
+        for (int u = 0; u < dw; u++) {
+            store_pixel(atlas, out, left + u, top + v, &boxes[u]);
+        }
+    }
+    atlas->valid |= 1u << slot;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "raster.h"
+
+// =============================================================================
+// Thumbnail Atlas - Shrunken Mode Pictures (No SDK Dependencies)
+// =============================================================================
+// The visualization menu shows each mode as a small picture in its palette.
+// All of them live in one bitmap, THUMBNAIL_WIDTH wide with the slots
+// stacked top to bottom. A slot is filled by drawing the mode at full size
+// into the framebuffer and shrinking that here, so it is drawn once and
+// again only after it is invalidated; the SDK glue lives in display_modes.c.
+//
+// Shrinking averages each box of source pixels. On 8-bit targets that is
+// per channel; on 1-bit ones the share of lit pixels picks a dither level
+// (raster.h), so thin strokes stay as a pattern instead of vanishing.
+
+#define THUMBNAIL_WIDTH 24
+#define THUMBNAIL_HEIGHT 28
+#define THUMBNAIL_MAX_SLOTS 32
+
+typedef struct {
+    RasterTarget target;   // The atlas bitmap
+    int count;             // Slots
+    uint32_t valid;        // Slots holding their current picture
+} ThumbnailAtlas;
+
+// Describe an atlas bitmap THUMBNAIL_WIDTH wide and count * THUMBNAIL_HEIGHT
+// high, rows `stride` bytes apart. Every slot starts out invalid.
+void thumbnail_atlas_init(ThumbnailAtlas *atlas, uint8_t *data, int stride, RasterFormat format, int count);
+
+// Top row of `slot` in the atlas
+int thumbnail_atlas_slot_y(int slot);
+
+void thumbnail_atlas_invalidate(ThumbnailAtlas *atlas, int slot);
+bool thumbnail_atlas_is_valid(const ThumbnailAtlas *atlas, int slot);
+
+// The first slot that needs drawing, or -1 if none does
+int thumbnail_atlas_next_pending(const ThumbnailAtlas *atlas);
+
+// Shrink the width x height area of `source` at (x, y) into `slot`, keeping
+// its shape and centering it, and mark the slot valid. On 8-bit atlases the
+// margin left over is transparent. Source pixels outside the rows' backed
+// columns (round screens) are left out of the averages.
+void thumbnail_atlas_store(ThumbnailAtlas *atlas, int slot, const RasterTarget *source,
+                           int x, int y, int width, int height);
@@ -0,0 +1,93 @@
+#include "mode_registry.h"
+
+#define HOURGLASS_FPS 20
+#define MATRIX_FPS 10
+#define WATER_FPS 20
+
+// =============================================================================
+// Animation Hooks
+// =============================================================================
+
+static void hourglass_mode_activate(AnimationState *anim, int remaining_seconds, int total_seconds) {
+    // Far behind its target the glass settles at once, so a mid-countdown
+    // switch shows the sand where it belongs
+    animation_init_hourglass(&anim->hourglass);
+    animation_sync_hourglass(&anim->hourglass, remaining_seconds, total_seconds);
+}
+
+static void hourglass_mode_update(AnimationState *anim, int remaining_seconds, int total_seconds) {
+    animation_sync_hourglass(&anim->hourglass, remaining_seconds, total_seconds);
+}
+
+static void hourglass_mode_step(AnimationState *anim) {
+    animation_step_hourglass(&anim->hourglass);
+}
+
+static int hourglass_mode_next_change(const AnimationState *anim, bool running) {
+    return (running && !sand_is_idle(&anim->hourglass.sand)) ? 1000 / HOURGLASS_FPS : 0;
+}
+
+static void matrix_mode_activate(AnimationState *anim, int remaining_seconds, int total_seconds) {
+    (void)total_seconds;
+    animation_init_matrix(&anim->matrix, remaining_seconds);
+}
+
+static void matrix_mode_step(AnimationState *anim) {
+    animation_step_matrix(&anim->matrix);
+}
+
+static int matrix_mode_next_change(const AnimationState *anim, bool running) {
+    (void)anim;
+    return running ? 1000 / MATRIX_FPS : 0;
+}
+
+static void water_mode_activate(AnimationState *anim, int remaining_seconds, int total_seconds) {
+    (void)remaining_seconds;
+    (void)total_seconds;
+    animation_init_water(&anim->water);
+}
+
+static void water_mode_step(AnimationState *anim) {
+    animation_step_water(&anim->water);
+}
+
+// Sloshes whether or not the countdown is running
+static int water_mode_next_change(const AnimationState *anim, bool running) {
+    (void)running;
+    return water_is_still(&anim->water.surface) ? 0 : 1000 / WATER_FPS;
+}
+
+// =============================================================================
+// Registry
+// =============================================================================
+
+static const ModeDescriptor s_modes[DISPLAY_MODE_COUNT] = {
+    [DISPLAY_MODE_TEXT]              = { .name = "Text" },
+    [DISPLAY_MODE_BLOCKS]            = { .name = "Blocks" },
+    [DISPLAY_MODE_VERTICAL_BLOCKS]   = { .name = "Vertical Blocks" },
+    [DISPLAY_MODE_CLOCK]             = { .name = "Clock" },
+    [DISPLAY_MODE_RING]              = { .name = "Ring" },
+    [DISPLAY_MODE_HOURGLASS]         = { .name = "Hourglass", .fps = HOURGLASS_FPS,
+                                         .activate = hourglass_mode_activate, .update = hourglass_mode_update,
+                                         .step = hourglass_mode_step, .next_change = hourglass_mode_next_change },
+    [DISPLAY_MODE_BINARY]            = { .name = "Binary" },
+    [DISPLAY_MODE_RADIAL]            = { .name = "Radial" },
+    [DISPLAY_MODE_HEX]               = { .name = "Hex" },
+    [DISPLAY_MODE_MATRIX]            = { .name = "Matrix", .fps = MATRIX_FPS,
+                                         .activate = matrix_mode_activate,
+                                         .step = matrix_mode_step, .next_change = matrix_mode_next_change },
+    [DISPLAY_MODE_WATER_LEVEL]       = { .name = "Water Level", .fps = WATER_FPS,
+                                         .activate = water_mode_activate,
+                                         .step = water_mode_step, .next_change = water_mode_next_change },
+    [DISPLAY_MODE_SPIRAL_OUT]        = { .name = "Spiral Out" },
+    [DISPLAY_MODE_SPIRAL_IN]         = { .name = "Spiral In" },
+    [DISPLAY_MODE_PERCENT]           = { .name = "% Elapsed" },
+    [DISPLAY_MODE_PERCENT_REMAINING] = { .name = "% Remaining" },
+};
+
+const ModeDescriptor *mode_descriptor(DisplayMode mode) {
+    if ((unsigned)mode >= DISPLAY_MODE_COUNT) {
+        mode = DISPLAY_MODE_TEXT;
+    }
+    return &s_modes[mode];
+}
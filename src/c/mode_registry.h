@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdbool.h>
+#include "timer_state.h"
+#include "animation.h"
+
+// =============================================================================
+// Display Mode Registry - Pure Descriptors (No SDK Dependencies)
+// =============================================================================
+// One const descriptor per DisplayMode: its name and how its animation, if
+// it has one, starts, follows the countdown and moves between ticks. Callers
+// look a mode up once and call through the descriptor instead of switching
+// on the mode. Hooks a mode doesn't need are NULL.
+//
+// The drawing side (palette, caches, draw) is the SDK-side table in
+// display/display_modes.c, indexed the same way.
+
+typedef struct {
+    const char *name;
+
+    // Animation frame rate, or 0 if nothing moves between ticks
+    int fps;
+
+    // Start the animation over for the countdown as it stands; called when
+    // the mode comes on screen and when the countdown restarts
+    void (*activate)(AnimationState *anim, int remaining_seconds, int total_seconds);
+
+    // The countdown ticked
+    void (*update)(AnimationState *anim, int remaining_seconds, int total_seconds);
+
+    // One fixed animation step (ANIM_STEP_MS)
+    void (*step)(AnimationState *anim);
+
+    // Milliseconds until the mode next changes on its own, or 0 if nothing
+    // changes before the next tick. `running` is whether the countdown is.
+    int (*next_change)(const AnimationState *anim, bool running);
+} ModeDescriptor;
+
+// The descriptor for a mode; out-of-range modes get Text's
+const ModeDescriptor *mode_descriptor(DisplayMode mode);
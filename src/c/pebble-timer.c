@@ -3,6 +3,9 @@
 #include "time_utils.h"
 #include "timer_state.h"
 #include "settings.h"
+#include "view_model.h"
+#include "mode_registry.h"
+#include "dashboard.h"
 #include "display/display_common.h"
 
 // =============================================================================
@@ -21,12 +24,57 @@ static TextLayer *s_title_layer;
 static TextLayer *s_time_layer;
 static TextLayer *s_hint_layer;
 static Layer *s_canvas_layer;
+static Layer *s_time_overlay_layer;
 
 static TimerContext s_timer_ctx;
 static TimerSettings s_settings;
 static AnimationState s_anim_state;
+static DisplayMode s_anim_mode = DISPLAY_MODE_COUNT;   // Whose animation s_anim_state holds
 static AppTimer *s_vibrate_timer = NULL;
 
+// Drives animated modes between ticks; NULL while nothing is moving
+static Animation *s_anim_driver = NULL;
+static uint32_t s_anim_last_ms = 0;
+static AppTimer *s_anim_idle_timer = NULL;
+static bool s_main_window_visible = false;
+
+// The main window's text layers as last written, and the next description
+// (static: two of these are too big for the stack)
+static ViewModel s_view_applied;
+static ViewModel s_view_next;
+
+// Canvas redraw bookkeeping. The framebuffer keeps the last frame between
+// renders, so a countdown tick only repaints what moved. Any other redraw
+// (mode or palette change, button press, or a system-initiated render after
+// a notification or menu) repaints the whole canvas, except that a
+// system-initiated one with nothing changed copies back the cached last
+// frame (display_frame_restore).
+static bool s_in_tick = false;
+static bool s_canvas_redraw_requested = false;
+static bool s_canvas_needs_full_redraw = true;
+static bool s_canvas_reveal_overlay = false;   // Restore what's under the time overlay
+static bool s_frame_drawn = false;            // Something drew this render; see frame_cache_update
+
+// The time overlay as last applied to its layer, and its own redraw flags
+static DisplayTimeOverlay s_time_overlay;
+static int s_time_overlay_seconds = -1;
+static bool s_overlay_redraw_requested = false;
+static bool s_overlay_needs_full_redraw = true;
+
+// The unobstructed area's slide, while one is under way (see Unobstructed Area)
+static bool s_reflowing = false;
+static GRect s_reflow_to;
+
+// The wipe between modes, while one is under way (see Mode Transitions)
+static Animation *s_transition_anim = NULL;
+static bool s_transition_drawn = false;   // This render showed the wipe
+
+// Timers parked by SELECT, and the window that shows them
+static Dashboard s_dashboard;
+static Window *s_dashboard_window = NULL;
+static Layer *s_dashboard_layer = NULL;
+static bool s_dashboard_redraw_requested = false;
+
 // Visualization settings UI
 static Window *s_visual_menu_window = NULL;
 static MenuLayer *s_visual_menu_layer = NULL;
@@ -34,14 +82,26 @@ static Window *s_visual_detail_window = NULL;
 static MenuLayer *s_visual_detail_menu = NULL;
 static DisplayMode s_selected_visual_mode = DISPLAY_MODE_TEXT;
 
+// Mode thumbnails for the visualization menu rows: one atlas bitmap with a
+// sub-bitmap per mode, and the layer under the menu that draws them
+static GBitmap *s_thumbnail_bitmap = NULL;
+static GBitmap *s_thumbnail_icons[DISPLAY_MODE_COUNT];
+static ThumbnailAtlas s_thumbnails;
+static Layer *s_thumbnail_layer = NULL;
+
 // =============================================================================
 // Forward Declarations
 // =============================================================================
 
 static void update_display(void);
 static void apply_effects(TimerEffects effects);
+static GRect canvas_layout_bounds(void);
+static void mode_transition_stop(void);
 static void tick_handler(struct tm *tick_time, TimeUnits units_changed);
 static void open_visual_settings_menu(void);
+static void dashboard_redraw(void);
+static void anim_driver_refresh(void);
+static void time_overlay_refresh(void);
 
 // =============================================================================
 // Settings Persistence
@@ -66,7 +126,7 @@ static void settings_save(void) {
 #ifdef PBL_COLOR
   #define COLOR_OPTION_COUNT 13
 #else
-  #define COLOR_OPTION_COUNT 2
+  #define COLOR_OPTION_COUNT 4   // Grays are dithered (raster.h)
 #endif
 
 static GColor s_color_options[COLOR_OPTION_COUNT];
@@ -76,7 +136,7 @@ static const char *s_color_names[COLOR_OPTION_COUNT] = {
         "Yellow", "Green", "Bright Green", "Cyan",
         "Cerulean", "Blue", "Violet", "Magenta"
     #else
-        "White", "Black"
+        "White", "Light Gray", "Dark Gray", "Black"
     #endif
 };
 
@@ -100,7 +160,9 @@ static void ensure_color_options(void) {
         s_color_options[12] = GColorMagenta;
     #else
         s_color_options[0] = GColorWhite;
-        s_color_options[1] = GColorBlack;
+        s_color_options[1] = GColorLightGray;
+        s_color_options[2] = GColorDarkGray;
+        s_color_options[3] = GColorBlack;
     #endif
 }
 
@@ -141,18 +203,14 @@ static void apply_visual_preferences(void) {
     settings_validate(&s_settings);
     for (int i = 0; i < DISPLAY_MODE_COUNT; i++) {
         s_timer_ctx.display_mode_enabled[i] = s_settings.visualization_enabled[i];
+        s_timer_ctx.grid_density[i] = s_settings.grid_density[i];
     }
     
     if (!s_timer_ctx.display_mode_enabled[s_timer_ctx.display_mode]) {
         s_timer_ctx.display_mode = s_settings.default_display_mode;
     }
     
-    if (s_main_window) {
-        window_set_background_color(
-            s_main_window,
-            s_settings.visualization_colors[s_timer_ctx.display_mode].background);
-    }
-    
+    // The window's background follows the canvas through the view sink
     update_display();
 }
 
@@ -171,8 +229,24 @@ static void set_visualization_default(DisplayMode mode) {
     refresh_visualization_menus();
 }
 
+// The mode's thumbnail no longer shows it as it is
+static void invalidate_thumbnail(DisplayMode mode) {
+    if (s_thumbnail_bitmap) {
+        thumbnail_atlas_invalidate(&s_thumbnails, mode);
+    }
+}
+
+static void cycle_grid_density(DisplayMode mode) {
+    s_settings.grid_density[mode] = (s_settings.grid_density[mode] + 1) % GRID_DENSITY_COUNT;
+    invalidate_thumbnail(mode);
+    apply_visual_preferences();
+    settings_persist_save(&s_settings);
+    refresh_visualization_menus();
+}
+
 static void cycle_visualization_color(DisplayMode mode, GColor *target) {
     *target = color_next(*target);
+    invalidate_thumbnail(mode);
     apply_visual_preferences();
     settings_persist_save(&s_settings);
     refresh_visualization_menus();
@@ -188,9 +262,17 @@ typedef enum {
     DETAIL_ROW_SECONDARY,
     DETAIL_ROW_ACCENT,
     DETAIL_ROW_SET_DEFAULT,
+    DETAIL_ROW_GRID_SIZE,  // Only shown for grid modes
     DETAIL_ROW_COUNT
 } VisualizationDetailRow;
 
+static bool display_mode_is_grid(DisplayMode mode) {
+    return mode == DISPLAY_MODE_BLOCKS || mode == DISPLAY_MODE_VERTICAL_BLOCKS ||
+           mode == DISPLAY_MODE_SPIRAL_OUT || mode == DISPLAY_MODE_SPIRAL_IN;
+}
+
+static const char *s_grid_density_names[] = { "Normal", "Dense", "Fine" };
+
 static uint16_t visual_menu_get_num_sections(MenuLayer *menu_layer, void *data) {
     return 1;
 }
@@ -207,7 +289,12 @@ static void visual_menu_draw_row(GContext *ctx, const Layer *cell_layer, MenuInd
     char subtitle[32];
     snprintf(subtitle, sizeof(subtitle), "%s | %s", enabled ? "On" : "Off", color_name_for(colors->primary));
     
-    menu_cell_basic_draw(ctx, cell_layer, timer_display_mode_name(mode), subtitle, NULL);
+    // The thumbnail layer has drawn any pending ones earlier in this render
+    GBitmap *icon = NULL;
+    if (s_thumbnail_bitmap && thumbnail_atlas_is_valid(&s_thumbnails, mode)) {
+        icon = s_thumbnail_icons[mode];
+    }
+    menu_cell_basic_draw(ctx, cell_layer, timer_display_mode_name(mode), subtitle, icon);
 }
 
 static void open_visual_detail_window(DisplayMode mode);
@@ -222,7 +309,7 @@ static uint16_t visual_detail_get_num_sections(MenuLayer *menu_layer, void *data
 }
 
 static uint16_t visual_detail_get_num_rows(MenuLayer *menu_layer, uint16_t section_index, void *data) {
-    return DETAIL_ROW_COUNT;
+    return display_mode_is_grid(s_selected_visual_mode) ? DETAIL_ROW_COUNT : DETAIL_ROW_GRID_SIZE;
 }
 
 static void visual_detail_draw_row(GContext *ctx, const Layer *cell_layer, MenuIndex *cell_index, void *data) {
@@ -251,6 +338,10 @@ static void visual_detail_draw_row(GContext *ctx, const Layer *cell_layer, MenuI
             title = "Set as default";
             subtitle = (s_settings.default_display_mode == s_selected_visual_mode) ? "Current default" : "Tap to set";
             break;
+        case DETAIL_ROW_GRID_SIZE:
+            title = "Grid size";
+            subtitle = s_grid_density_names[s_settings.grid_density[s_selected_visual_mode]];
+            break;
         default:
             break;
     }
@@ -277,6 +368,51 @@ static void visual_detail_select(struct MenuLayer *menu_layer, MenuIndex *cell_i
         case DETAIL_ROW_SET_DEFAULT:
             set_visualization_default(s_selected_visual_mode);
             break;
+        case DETAIL_ROW_GRID_SIZE:
+            cycle_grid_density(s_selected_visual_mode);
+            break;
+    }
+}
+
+static void thumbnails_release(void) {
+    for (int i = 0; i < DISPLAY_MODE_COUNT; i++) {
+        if (s_thumbnail_icons[i]) {
+            gbitmap_destroy(s_thumbnail_icons[i]);
+            s_thumbnail_icons[i] = NULL;
+        }
+    }
+    if (s_thumbnail_bitmap) {
+        gbitmap_destroy(s_thumbnail_bitmap);
+        s_thumbnail_bitmap = NULL;
+    }
+}
+
+// Without the memory, the rows are just text
+static void thumbnails_create(void) {
+    s_thumbnail_bitmap = gbitmap_create_blank(GSize(THUMBNAIL_WIDTH, DISPLAY_MODE_COUNT * THUMBNAIL_HEIGHT),
+                                              PBL_IF_COLOR_ELSE(GBitmapFormat8Bit, GBitmapFormat1Bit));
+    if (!s_thumbnail_bitmap) return;
+    
+    thumbnail_atlas_init(&s_thumbnails, gbitmap_get_data(s_thumbnail_bitmap),
+                         gbitmap_get_bytes_per_row(s_thumbnail_bitmap),
+                         PBL_IF_COLOR_ELSE(RASTER_FORMAT_8BIT, RASTER_FORMAT_1BIT), DISPLAY_MODE_COUNT);
+    for (int i = 0; i < DISPLAY_MODE_COUNT; i++) {
+        GRect slot = GRect(0, thumbnail_atlas_slot_y(i), THUMBNAIL_WIDTH, THUMBNAIL_HEIGHT);
+        s_thumbnail_icons[i] = gbitmap_create_as_sub_bitmap(s_thumbnail_bitmap, slot);
+        if (!s_thumbnail_icons[i]) {
+            thumbnails_release();
+            return;
+        }
+    }
+}
+
+// Under the menu, which covers whatever this draws. Once every slot is
+// drawn, this returns at once: scrolling doesn't draw thumbnails.
+static void thumbnail_layer_update(Layer *layer, GContext *ctx) {
+    if (!s_thumbnail_bitmap) return;
+    if (!display_render_thumbnails(ctx, layer_get_bounds(layer), &s_thumbnails, &s_timer_ctx,
+                                   s_settings.visualization_colors)) {
+        thumbnails_release();
     }
 }
 
@@ -284,6 +420,11 @@ static void visual_menu_window_load(Window *window) {
     Layer *window_layer = window_get_root_layer(window);
     GRect bounds = layer_get_bounds(window_layer);
     
+    thumbnails_create();
+    s_thumbnail_layer = layer_create(bounds);
+    layer_set_update_proc(s_thumbnail_layer, thumbnail_layer_update);
+    layer_add_child(window_layer, s_thumbnail_layer);
+    
     s_visual_menu_layer = menu_layer_create(bounds);
     menu_layer_set_callbacks(s_visual_menu_layer, NULL, (MenuLayerCallbacks) {
         .get_num_sections = visual_menu_get_num_sections,
@@ -300,6 +441,11 @@ static void visual_menu_window_unload(Window *window) {
         menu_layer_destroy(s_visual_menu_layer);
         s_visual_menu_layer = NULL;
     }
+    if (s_thumbnail_layer) {
+        layer_destroy(s_thumbnail_layer);
+        s_thumbnail_layer = NULL;
+    }
+    thumbnails_release();
 }
 
 static void visual_detail_window_load(Window *window) {
@@ -386,20 +532,26 @@ static void stop_vibration_loop(void) {
 // Effect Application - Translates Pure Logic Effects to SDK Calls
 // =============================================================================
 
-static void apply_effects(TimerEffects effects) {
-    if (effects.init_hourglass) {
-        animation_init_hourglass(&s_anim_state.hourglass);
+// Start the shown mode's animation from the countdown as it stands
+static void activate_mode_animation(void) {
+    const ModeDescriptor *desc = mode_descriptor(s_timer_ctx.display_mode);
+    if (desc->activate) {
+        desc->activate(&s_anim_state, s_timer_ctx.remaining_seconds, s_timer_ctx.total_seconds);
     }
-    
-    if (effects.init_matrix) {
-        animation_init_matrix(&s_anim_state.matrix, s_timer_ctx.remaining_seconds);
+    s_anim_mode = s_timer_ctx.display_mode;
+}
+
+static void apply_effects(TimerEffects effects) {
+    if (effects.activate_mode) {
+        activate_mode_animation();
     }
     
     if (effects.subscribe_tick_timer) {
         tick_timer_service_subscribe(SECOND_UNIT, tick_handler);
     }
     
-    if (effects.unsubscribe_tick_timer) {
+    // Parked timers still count down
+    if (effects.unsubscribe_tick_timer && !dashboard_is_running(&s_dashboard)) {
         tick_timer_service_unsubscribe();
     }
     
@@ -419,6 +571,10 @@ static void apply_effects(TimerEffects effects) {
         update_display();
     }
     
+    if (effects.update_time_overlay) {
+        time_overlay_refresh();
+    }
+    
     if (effects.pop_window) {
         window_stack_pop(true);
     }
@@ -429,115 +585,561 @@ static void apply_effects(TimerEffects effects) {
 // =============================================================================
 
 static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
-    TimerEffects effects = timer_tick(&s_timer_ctx);
-    apply_effects(effects);
+    bool finished;
+    if (dashboard_tick(&s_dashboard, &finished)) {
+        dashboard_redraw();
+    }
+    if (finished) {
+        vibes_double_pulse();
+    }
+
+    // With no timer on the main screen, the ticks were for the dashboard
+    if (s_timer_ctx.state != STATE_SELECT_PRESET && s_timer_ctx.state != STATE_SET_CUSTOM_HOURS &&
+        s_timer_ctx.state != STATE_SET_CUSTOM_MINUTES) {
+        TimerEffects effects = timer_tick(&s_timer_ctx);
+        const ModeDescriptor *desc = mode_descriptor(s_anim_mode);
+        if (desc->update) {
+            desc->update(&s_anim_state, s_timer_ctx.remaining_seconds, s_timer_ctx.total_seconds);
+        }
+        s_in_tick = true;
+        apply_effects(effects);
+        s_in_tick = false;
+    }
+
+    // Whichever timer was counting down last has finished or paused
+    apply_effects(dashboard_tick_effects(&s_dashboard, &s_timer_ctx));
+}
+
+// =============================================================================
+// Animation Driver
+// =============================================================================
+// An SDK Animation with infinite duration feeds wall-clock time into the
+// fixed-step simulations (animation.c). The canvas is only marked dirty when
+// a frame is due at the mode's rate, and the driver is torn down whenever
+// nothing is moving, so idle modes cost no frames at all.
+
+static uint32_t anim_now_ms(void) {
+    time_t seconds;
+    uint16_t millis;
+    time_ms(&seconds, &millis);
+    return (uint32_t)seconds * 1000 + millis;
+}
+
+static void anim_driver_idle_callback(void *data) {
+    s_anim_idle_timer = NULL;
+    anim_driver_refresh();
+}
+
+static void anim_driver_update(Animation *animation, const AnimationProgress progress) {
+    uint32_t now = anim_now_ms();
+    uint32_t elapsed = now - s_anim_last_ms;
+    s_anim_last_ms = now;
+
+    bool frame_due = animation_advance(&s_anim_state, s_anim_mode, elapsed);
+    bool active = animation_is_active(&s_anim_state, s_anim_mode,
+                                      s_timer_ctx.state == STATE_RUNNING);
+    if (frame_due || !active) {
+        s_canvas_redraw_requested = true;
+        layer_mark_dirty(s_canvas_layer);
+    }
+
+    // Settled between ticks (e.g. the sand came to rest): draw the final
+    // frame and stop the driver outside of its own update
+    if (!active && !s_anim_idle_timer) {
+        s_anim_idle_timer = app_timer_register(0, anim_driver_idle_callback, NULL);
+    }
+}
+
+static const AnimationImplementation s_anim_driver_impl = {
+    .update = anim_driver_update
+};
+
+static void anim_driver_refresh(void) {
+    bool wanted = s_main_window_visible && timer_should_show_canvas(&s_timer_ctx) &&
+                  animation_is_active(&s_anim_state, s_anim_mode,
+                                      s_timer_ctx.state == STATE_RUNNING);
+
+    if (wanted && !s_anim_driver) {
+        s_anim_driver = animation_create();
+        animation_set_duration(s_anim_driver, ANIMATION_DURATION_INFINITE);
+        animation_set_implementation(s_anim_driver, &s_anim_driver_impl);
+        animation_reset_clock(&s_anim_state);
+        s_anim_last_ms = anim_now_ms();
+        animation_schedule(s_anim_driver);
+    } else if (!wanted && s_anim_driver) {
+        // SDK 3 destroys an animation once it is unscheduled
+        animation_unschedule(s_anim_driver);
+        s_anim_driver = NULL;
+    }
+}
+
+// =============================================================================
+// Tilt Sensing
+// =============================================================================
+// Water Level reads the accelerometer in large batches at a low rate and
+// feeds each batch's mean x into the surface. The sensor only runs while the
+// mode is on screen and the battery isn't low; otherwise it is switched off
+// and the surface levels out and goes to sleep.
+
+#define TILT_SAMPLING_RATE ACCEL_SAMPLING_10HZ
+#define TILT_BATCH_SIZE 10             // One wakeup per second
+#define TILT_LOW_BATTERY_PERCENT 20
+
+static bool s_tilt_subscribed = false;
+
+static void tilt_data_handler(AccelData *data, uint32_t num_samples) {
+    int32_t sum = 0;
+    int32_t used = 0;
+    for (uint32_t i = 0; i < num_samples; i++) {
+        // Our own vibrations aren't tilt
+        if (data[i].did_vibrate) continue;
+        sum += data[i].x;
+        used++;
+    }
+    if (used == 0 || s_anim_mode != DISPLAY_MODE_WATER_LEVEL) {
+        return;
+    }
+
+    water_set_tilt(&s_anim_state.water.surface, sum / used);
+    anim_driver_refresh();
+}
+
+static bool battery_is_low(void) {
+    BatteryChargeState charge = battery_state_service_peek();
+    return !charge.is_charging && charge.charge_percent <= TILT_LOW_BATTERY_PERCENT;
+}
+
+static void tilt_sensing_refresh(void) {
+    bool wanted = s_main_window_visible && timer_should_show_canvas(&s_timer_ctx) &&
+                  s_timer_ctx.display_mode == DISPLAY_MODE_WATER_LEVEL && !battery_is_low();
+
+    if (wanted && !s_tilt_subscribed) {
+        accel_data_service_subscribe(TILT_BATCH_SIZE, tilt_data_handler);
+        accel_service_set_sampling_rate(TILT_SAMPLING_RATE);
+        s_tilt_subscribed = true;
+    } else if (!wanted && s_tilt_subscribed) {
+        accel_data_service_unsubscribe();
+        s_tilt_subscribed = false;
+        if (s_anim_mode == DISPLAY_MODE_WATER_LEVEL) {
+            water_set_tilt(&s_anim_state.water.surface, 0);
+        }
+    }
+}
+
+static void battery_handler(BatteryChargeState charge) {
+    tilt_sensing_refresh();
+    anim_driver_refresh();
 }
 
 // =============================================================================
 // Canvas Update Procedure
 // =============================================================================
 
+// Key for the frame the canvas and time overlay would compose now
+static FrameKey current_frame_key(void) {
+    FrameKey key = display_frame_key(canvas_layout_bounds(), &s_timer_ctx, &s_anim_state,
+                                     s_settings.visualization_colors);
+    if (s_time_overlay.shown) {
+        GRect f = s_time_overlay.frame;
+        key = frame_key_add(key, (uint32_t)s_time_overlay_seconds);
+        key = frame_key_add(key, (uint32_t)(uint16_t)f.origin.x << 16 | (uint16_t)f.origin.y);
+        key = frame_key_add(key, (uint32_t)(uint16_t)f.size.w << 16 | (uint16_t)f.size.h);
+        key = frame_key_add(key, (uint32_t)s_time_overlay.size | (uint32_t)s_time_overlay.plate << 8 |
+                                 (uint32_t)s_time_overlay.color.argb << 16 |
+                                 (uint32_t)s_time_overlay.background.argb << 24);
+    }
+    return key;
+}
+
+// Called by the last layer to draw in a render (the overlay when it is
+// shown, else the canvas): keep the composed frame if anything drew in it
+static void frame_cache_update(GContext *ctx) {
+    if (s_frame_drawn) {
+        display_frame_store(ctx, current_frame_key());
+        s_frame_drawn = false;
+        // The incoming mode's first frame is the wipe's end; show its start
+        if (s_transition_anim && !display_transition_draw(ctx)) {
+            mode_transition_stop();
+        }
+    }
+}
+
 static void canvas_update_proc(Layer *layer, GContext *ctx) {
-    GRect bounds = layer_get_bounds(layer);
+    GRect bounds = canvas_layout_bounds();
     
     if (!timer_should_show_canvas(&s_timer_ctx)) {
         return;
     }
     
-    display_draw(ctx, bounds, &s_timer_ctx, &s_anim_state, s_settings.visualization_colors);
+    // Mid-transition, renders come from the two snapshots; what else was
+    // asked for waits for the full frame that ends it
+    s_transition_drawn = s_transition_anim && display_transition_draw(ctx);
+    if (s_transition_drawn) {
+        return;
+    }
+    
+    // A render we did not ask for means the system drew over our last frame.
+    // One the time overlay asked for on its own leaves our frame intact.
+    bool system_render = !(s_canvas_redraw_requested || s_overlay_redraw_requested);
+    bool full_redraw = s_canvas_needs_full_redraw || system_render;
+    bool redraw = full_redraw || s_canvas_redraw_requested;
+    bool restorable = system_render && !s_canvas_needs_full_redraw;
+    s_canvas_needs_full_redraw = false;
+    s_canvas_redraw_requested = false;
+    if (!redraw) {
+        return;
+    }
+    
+    // If nothing changed since the last frame, putting it back is enough
+    if (restorable && display_frame_restore(ctx, current_frame_key())) {
+        return;
+    }
+    
+    if (display_draw(ctx, bounds, &s_timer_ctx, &s_anim_state, s_settings.visualization_colors, full_redraw,
+                     s_canvas_reveal_overlay)) {
+        s_overlay_needs_full_redraw = true;
+    }
+    s_canvas_reveal_overlay = false;
+    s_frame_drawn = true;
+    if (layer_get_hidden(s_time_overlay_layer)) {
+        frame_cache_update(ctx);
+    }
 }
 
 // =============================================================================
-// Display Update
+// Time Overlay Layer
 // =============================================================================
+// The m:ss text over the visualizations is a child layer of the canvas,
+// placed from the mode's layout and marked dirty only when its text, layout
+// or visibility changes. It is drawn after the canvas in every render, but
+// only repaints when asked to or when the canvas painted over it.
 
-static void update_display(void) {
-    static char title_buf[32];
-    static char time_buf[16];
-    static char hint_buf[64];
-    
-    bool show_canvas = timer_should_show_canvas(&s_timer_ctx);
-    
-    // Use visualization background only when canvas is showing;
-    // otherwise use black so white text remains visible
-    if (show_canvas) {
-        VisualizationColors current_colors = s_settings.visualization_colors[s_timer_ctx.display_mode];
-        window_set_background_color(s_main_window, current_colors.background);
-    } else {
-        window_set_background_color(s_main_window, GColorBlack);
+static void time_overlay_update_proc(Layer *layer, GContext *ctx) {
+    if (s_transition_drawn) {
+        return;
+    }
+    if (s_overlay_redraw_requested || s_overlay_needs_full_redraw) {
+        display_draw_time_overlay(ctx, &s_time_overlay, s_timer_ctx.remaining_seconds,
+                                  s_overlay_needs_full_redraw);
+        s_overlay_redraw_requested = false;
+        s_overlay_needs_full_redraw = false;
+        s_frame_drawn = true;
     }
+    frame_cache_update(ctx);
+}
+
+static void request_canvas_redraw(void) {
+    s_canvas_redraw_requested = true;
+    layer_mark_dirty(s_canvas_layer);
+}
+
+static void time_overlay_refresh(void) {
+    bool show_canvas = timer_should_show_canvas(&s_timer_ctx);
+    DisplayTimeOverlay next = display_time_overlay(canvas_layout_bounds(), &s_timer_ctx,
+                                                   s_settings.visualization_colors);
+    next.shown = next.shown && show_canvas;
     
-    layer_set_hidden(s_canvas_layer, !show_canvas);
-    layer_set_hidden(text_layer_get_layer(s_time_layer), show_canvas);
-    layer_set_hidden(text_layer_get_layer(s_title_layer), 
-                     show_canvas && s_timer_ctx.state == STATE_RUNNING);
-    layer_set_hidden(text_layer_get_layer(s_hint_layer), 
-                     show_canvas && s_timer_ctx.state == STATE_RUNNING);
+    bool was_shown = s_time_overlay.shown;
+    bool moved = !grect_equal(&next.frame, &s_time_overlay.frame) || next.size != s_time_overlay.size ||
+                 !gcolor_equal(next.color, s_time_overlay.color) ||
+                 !gcolor_equal(next.background, s_time_overlay.background) || next.plate != s_time_overlay.plate;
+    bool changed = s_timer_ctx.remaining_seconds != s_time_overlay_seconds;
+    s_time_overlay = next;
+    s_time_overlay_seconds = s_timer_ctx.remaining_seconds;
     
-    if (show_canvas) {
-        layer_mark_dirty(s_canvas_layer);
+    if (!next.shown) {
+        // Going away: the canvas restores what was under the text
+        if (was_shown && show_canvas) {
+            s_canvas_reveal_overlay = true;
+            request_canvas_redraw();
+        }
+        s_overlay_redraw_requested = false;
+        layer_set_hidden(s_time_overlay_layer, true);
+        return;
     }
     
-    switch (s_timer_ctx.state) {
-        case STATE_SELECT_PRESET:
-            snprintf(title_buf, sizeof(title_buf), "Select Time");
-            time_format_preset(s_timer_ctx.selected_preset, time_buf, sizeof(time_buf));
-            snprintf(hint_buf, sizeof(hint_buf), "UP/DOWN: Change\nSELECT: Start\nHold: %s", 
-                     timer_display_mode_name(s_timer_ctx.display_mode));
-            text_layer_set_text_color(s_time_layer, COLOR_TEXT_NORMAL);
-            break;
-            
-        case STATE_SET_CUSTOM_HOURS:
-            snprintf(title_buf, sizeof(title_buf), "Set Hours");
-            snprintf(time_buf, sizeof(time_buf), "%d hr", s_timer_ctx.custom_hours);
-            snprintf(hint_buf, sizeof(hint_buf), "UP/DOWN: Adjust\nSELECT: Next");
-            text_layer_set_text_color(s_time_layer, COLOR_TEXT_NORMAL);
-            break;
-            
-        case STATE_SET_CUSTOM_MINUTES:
-            snprintf(title_buf, sizeof(title_buf), "Set Minutes");
-            snprintf(time_buf, sizeof(time_buf), "%d min", s_timer_ctx.custom_minutes);
-            snprintf(hint_buf, sizeof(hint_buf), "UP/DOWN: Adjust\nSELECT: Start");
-            text_layer_set_text_color(s_time_layer, COLOR_TEXT_NORMAL);
-            break;
-            
-        case STATE_RUNNING:
-            title_buf[0] = '\0';
-            time_format_adaptive(s_timer_ctx.remaining_seconds, time_buf, sizeof(time_buf));
-            hint_buf[0] = '\0';
-            
-            if (s_timer_ctx.remaining_seconds <= 10) {
-                text_layer_set_text_color(s_time_layer, COLOR_TEXT_LOW);
+    if (moved || !was_shown) {
+        // A new layout comes with a new canvas frame; the old text is left
+        // to it. Mid-slide, a list mode just restores what was under it.
+        if (moved && was_shown) {
+            if (s_reflowing && display_emit_supports(s_timer_ctx.display_mode)) {
+                s_canvas_reveal_overlay = true;
             } else {
-                text_layer_set_text_color(s_time_layer, COLOR_TEXT_RUNNING);
+                s_canvas_needs_full_redraw = true;
             }
-            break;
-            
-        case STATE_PAUSED:
-            snprintf(title_buf, sizeof(title_buf), "Paused");
-            time_format_adaptive(s_timer_ctx.remaining_seconds, time_buf, sizeof(time_buf));
-            snprintf(hint_buf, sizeof(hint_buf), "SELECT: Resume\nUP: Restart\nDOWN: Cancel");
-            text_layer_set_text_color(s_time_layer, COLOR_TEXT_PAUSED);
-            break;
-            
-        case STATE_COMPLETED:
-            snprintf(title_buf, sizeof(title_buf), "Complete!");
-            snprintf(time_buf, sizeof(time_buf), "0:00");
-            snprintf(hint_buf, sizeof(hint_buf), "SELECT/UP: Restart\nDOWN: Dismiss");
-            text_layer_set_text_color(s_time_layer, COLOR_TEXT_COMPLETED);
-            break;
-            
-        case STATE_CONFIRM_EXIT:
-            snprintf(title_buf, sizeof(title_buf), "Timer Active!");
-            snprintf(time_buf, sizeof(time_buf), "Exit?");
-            snprintf(hint_buf, sizeof(hint_buf), "UP: Yes, exit\nDOWN: No, stay");
-            text_layer_set_text_color(s_time_layer, COLOR_TEXT_PAUSED);
-            break;
+            request_canvas_redraw();
+        }
+        layer_set_frame(s_time_overlay_layer, next.frame);
+        layer_set_hidden(s_time_overlay_layer, false);
+        s_overlay_needs_full_redraw = true;
+    } else if (!changed) {
+        return;
+    } else if (display_time_overlay_needs_canvas()) {
+        s_canvas_reveal_overlay = true;
+        request_canvas_redraw();
+    }
+    s_overlay_redraw_requested = true;
+    layer_mark_dirty(s_time_overlay_layer);
+}
+
+// =============================================================================
+// Unobstructed Area
+// =============================================================================
+// Timeline Quick View covers the bottom of the screen, so the canvas is laid
+// out for the area it leaves. While that slides, frames are laid out for
+// where it ends and display_reflow moves them from where it started.
+
+static GRect canvas_layout_bounds(void) {
+    #if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+        return s_reflowing ? s_reflow_to : layer_get_unobstructed_bounds(s_canvas_layer);
+    #else
+        return layer_get_bounds(s_canvas_layer);
+    #endif
+}
+
+#if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+static void unobstructed_will_change(GRect final_area, void *context) {
+    mode_transition_stop();
+    // The canvas fills the window, which fills the screen
+    GRect from = layer_get_unobstructed_bounds(s_canvas_layer);
+    display_reflow_begin(from, final_area, &s_timer_ctx, &s_anim_state, s_settings.visualization_colors);
+    s_reflow_to = final_area;
+    s_reflowing = true;
+
+    // What the area uncovers or hands over is stale; start from a full frame
+    if (timer_should_show_canvas(&s_timer_ctx)) {
+        s_canvas_needs_full_redraw = true;
+        request_canvas_redraw();
+    }
+}
+
+static void unobstructed_change(AnimationProgress progress, void *context) {
+    display_reflow_set_progress((int32_t)progress);
+    if (timer_should_show_canvas(&s_timer_ctx)) {
+        request_canvas_redraw();
+        time_overlay_refresh();
+    }
+}
+
+static void unobstructed_did_change(void *context) {
+    s_reflowing = false;
+    display_reflow_end();
+    if (timer_should_show_canvas(&s_timer_ctx)) {
+        request_canvas_redraw();
+        time_overlay_refresh();
+    }
+}
+#endif
+
+// =============================================================================
+// Mode Transitions
+// =============================================================================
+// Cycling modes wipes the incoming mode in over the outgoing one, from two
+// snapshots (display_transition_begin). The next cycle cuts a wipe short
+// and starts its own from the frame it was heading to.
+
+#define MODE_TRANSITION_MS 250
+
+static void mode_transition_update(Animation *animation, const AnimationProgress progress) {
+    display_transition_set_progress((int32_t)progress);
+    request_canvas_redraw();
+}
+
+static const AnimationImplementation s_transition_impl = {
+    .update = mode_transition_update
+};
+
+static void mode_transition_stopped(Animation *animation, bool finished, void *context) {
+    // One stopped by mode_transition_stop was already ended there
+    if (animation != s_transition_anim) {
+        return;
+    }
+    s_transition_anim = NULL;
+    display_transition_end();
+    if (timer_should_show_canvas(&s_timer_ctx)) {
+        s_canvas_needs_full_redraw = true;
+        request_canvas_redraw();
+    }
+}
+
+static void mode_transition_stop(void) {
+    if (s_transition_anim) {
+        // SDK 3 destroys an animation once it is unscheduled
+        Animation *animation = s_transition_anim;
+        s_transition_anim = NULL;
+        animation_unschedule(animation);
+    }
+    display_transition_end();
+}
+
+static void mode_transition_start(void) {
+    mode_transition_stop();
+    if (!s_main_window_visible || !timer_should_show_canvas(&s_timer_ctx) || !display_transition_begin()) {
+        return;
+    }
+    s_transition_anim = animation_create();
+    animation_set_duration(s_transition_anim, MODE_TRANSITION_MS);
+    animation_set_curve(s_transition_anim, AnimationCurveEaseInOut);
+    animation_set_implementation(s_transition_anim, &s_transition_impl);
+    animation_set_handlers(s_transition_anim, (AnimationHandlers) {
+        .stopped = mode_transition_stopped
+    }, NULL);
+    animation_schedule(s_transition_anim);
+}
+
+// =============================================================================
+// Display Update
+// =============================================================================
+
+static TextLayer *view_text_layer(ViewText which) {
+    switch (which) {
+        case VIEW_TEXT_TITLE: return s_title_layer;
+        case VIEW_TEXT_TIME:  return s_time_layer;
+        default:              return s_hint_layer;
+    }
+}
+
+static void view_set_canvas_shown(bool shown, void *context) {
+    // The canvas paints its own background so the window must not clear the
+    // previous frame; otherwise use black so white text remains visible
+    window_set_background_color(s_main_window, shown ? GColorClear : GColorBlack);
+    layer_set_hidden(s_canvas_layer, !shown);
+    if (!shown) {
+        // Nothing on screen needs the last mode's caches
+        display_release();
+    }
+}
+
+static void view_set_text_shown(ViewText which, bool shown, void *context) {
+    layer_set_hidden(text_layer_get_layer(view_text_layer(which)), !shown);
+}
+
+static void view_set_text(ViewText which, const char *text, void *context) {
+    text_layer_set_text(view_text_layer(which), text);
+}
+
+static void view_set_time_tone(ViewTone tone, void *context) {
+    GColor color;
+    switch (tone) {
+        case VIEW_TONE_RUNNING:   color = COLOR_TEXT_RUNNING; break;
+        case VIEW_TONE_PAUSED:    color = COLOR_TEXT_PAUSED; break;
+        case VIEW_TONE_LOW:       color = COLOR_TEXT_LOW; break;
+        case VIEW_TONE_COMPLETED: color = COLOR_TEXT_COMPLETED; break;
+        default:                  color = COLOR_TEXT_NORMAL; break;
+    }
+    text_layer_set_text_color(s_time_layer, color);
+}
+
+static const ViewSink s_view_sink = {
+    .set_canvas_shown = view_set_canvas_shown,
+    .set_text_shown = view_set_text_shown,
+    .set_text = view_set_text,
+    .set_time_tone = view_set_time_tone,
+};
+
+static void update_display(void) {
+    // Whichever way a mode came on screen, its animation starts fresh
+    if (s_timer_ctx.display_mode != s_anim_mode) {
+        activate_mode_animation();
+    }
+    
+    // Only what differs from the last update reaches the layers
+    view_model_build(&s_timer_ctx, &s_view_next);
+    view_model_apply(&s_view_applied, &s_view_next, &s_view_sink);
+    
+    if (s_view_next.canvas_shown) {
+        if (!s_in_tick) {
+            s_canvas_needs_full_redraw = true;
+        }
+        s_canvas_redraw_requested = true;
+        layer_mark_dirty(s_canvas_layer);
     }
     
-    text_layer_set_text(s_title_layer, title_buf);
-    text_layer_set_text(s_time_layer, time_buf);
-    text_layer_set_text(s_hint_layer, hint_buf);
+    time_overlay_refresh();
+    tilt_sensing_refresh();
+    anim_driver_refresh();
+}
+
+// =============================================================================
+// Dashboard
+// =============================================================================
+// SELECT parks the running timer (dashboard.h); holding UP at preset
+// selection shows the parked ones in tiles. The window's background is clear
+// so the framebuffer keeps the last frame, and the layer repaints only the
+// tiles that changed unless the system drew over it.
+
+static void dashboard_update_proc(Layer *layer, GContext *ctx) {
+    // A render we did not ask for means the system drew over our last frame
+    bool full_redraw = !s_dashboard_redraw_requested;
+    s_dashboard_redraw_requested = false;
+    display_draw_dashboard(ctx, layer_get_bounds(layer), &s_dashboard, &s_timer_ctx,
+                           s_settings.visualization_colors, full_redraw);
+}
+
+static void dashboard_redraw(void) {
+    if (s_dashboard_layer) {
+        s_dashboard_redraw_requested = true;
+        layer_mark_dirty(s_dashboard_layer);
+    }
+}
+
+static void dashboard_up_handler(ClickRecognizerRef recognizer, void *context) {
+    dashboard_select_previous(&s_dashboard);
+    dashboard_redraw();
+}
+
+static void dashboard_down_handler(ClickRecognizerRef recognizer, void *context) {
+    dashboard_select_next(&s_dashboard);
+    dashboard_redraw();
+}
+
+static void dashboard_select_handler(ClickRecognizerRef recognizer, void *context) {
+    TimerEffects effects = dashboard_take(&s_dashboard, &s_timer_ctx);
+    apply_effects(effects);
+}
+
+static void dashboard_select_long_handler(ClickRecognizerRef recognizer, void *context) {
+    dashboard_remove(&s_dashboard);
+    vibes_short_pulse();
+    if (s_dashboard.count == 0) {
+        window_stack_pop(true);
+    } else {
+        dashboard_redraw();
+    }
+}
+
+static void dashboard_click_config_provider(void *context) {
+    window_single_click_subscribe(BUTTON_ID_UP, dashboard_up_handler);
+    window_single_click_subscribe(BUTTON_ID_DOWN, dashboard_down_handler);
+    window_single_click_subscribe(BUTTON_ID_SELECT, dashboard_select_handler);
+    window_long_click_subscribe(BUTTON_ID_SELECT, 500, dashboard_select_long_handler, NULL);
+}
+
+static void dashboard_window_load(Window *window) {
+    Layer *window_layer = window_get_root_layer(window);
+    s_dashboard_layer = layer_create(layer_get_bounds(window_layer));
+    layer_set_update_proc(s_dashboard_layer, dashboard_update_proc);
+    layer_add_child(window_layer, s_dashboard_layer);
+}
+
+static void dashboard_window_unload(Window *window) {
+    layer_destroy(s_dashboard_layer);
+    s_dashboard_layer = NULL;
+    display_dashboard_release();
+}
+
+static void open_dashboard(void) {
+    if (!s_dashboard_window) {
+        s_dashboard_window = window_create();
+        // The tiles paint their own backgrounds over the last frame
+        window_set_background_color(s_dashboard_window, GColorClear);
+        window_set_click_config_provider(s_dashboard_window, dashboard_click_config_provider);
+        window_set_window_handlers(s_dashboard_window, (WindowHandlers) {
+            .load = dashboard_window_load,
+            .unload = dashboard_window_unload
+        });
+    }
+    window_stack_push(s_dashboard_window, true);
 }
 
 // =============================================================================
@@ -545,16 +1147,25 @@ static void update_display(void) {
 // =============================================================================
 
 static void select_click_handler(ClickRecognizerRef recognizer, void *context) {
-    TimerEffects effects = timer_handle_select(&s_timer_ctx);
+    TimerEffects effects = (s_timer_ctx.state == STATE_RUNNING) ? dashboard_park(&s_dashboard, &s_timer_ctx)
+                                                                : timer_handle_select(&s_timer_ctx);
     apply_effects(effects);
 }
 
 static void select_long_click_handler(ClickRecognizerRef recognizer, void *context) {
+    DisplayMode mode = s_timer_ctx.display_mode;
     TimerEffects effects = timer_handle_select_long(&s_timer_ctx);
+    if (s_timer_ctx.display_mode != mode) {
+        mode_transition_start();
+    }
     apply_effects(effects);
 }
 
 static void up_long_click_handler(ClickRecognizerRef recognizer, void *context) {
+    if (s_timer_ctx.state == STATE_SELECT_PRESET && s_dashboard.count > 0) {
+        open_dashboard();
+        return;
+    }
     TimerEffects effects = timer_handle_up_long(&s_timer_ctx);
     apply_effects(effects);
 }
@@ -599,6 +1210,8 @@ static void window_load(Window *window) {
     Layer *window_layer = window_get_root_layer(window);
     GRect bounds = layer_get_bounds(window_layer);
     
+    display_fonts_load();
+    
     #ifdef PBL_ROUND
         int title_y = 30;
         int time_y = 55;
@@ -617,6 +1230,14 @@ static void window_load(Window *window) {
     layer_set_hidden(s_canvas_layer, true);
     layer_add_child(window_layer, s_canvas_layer);
     
+    // Time overlay, placed by time_overlay_refresh
+    s_time_overlay_layer = layer_create(GRect(0, 0, 0, 0));
+    layer_set_update_proc(s_time_overlay_layer, time_overlay_update_proc);
+    layer_set_hidden(s_time_overlay_layer, true);
+    layer_add_child(s_canvas_layer, s_time_overlay_layer);
+    s_time_overlay = (DisplayTimeOverlay){ .shown = false };
+    s_time_overlay_seconds = -1;
+    
     // Title layer
     s_title_layer = text_layer_create(GRect(inset, title_y, bounds.size.w - (inset * 2), 30));
     text_layer_set_background_color(s_title_layer, GColorClear);
@@ -641,14 +1262,44 @@ static void window_load(Window *window) {
     text_layer_set_text_alignment(s_hint_layer, GTextAlignmentCenter);
     layer_add_child(window_layer, text_layer_get_layer(s_hint_layer));
     
+    s_reflowing = false;
+    #if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+        unobstructed_area_service_subscribe((UnobstructedAreaHandlers) {
+            .will_change = unobstructed_will_change,
+            .change = unobstructed_change,
+            .did_change = unobstructed_did_change
+        }, NULL);
+    #endif
+    
+    view_model_invalidate(&s_view_applied);
     update_display();
 }
 
+static void window_appear(Window *window) {
+    s_main_window_visible = true;
+    tilt_sensing_refresh();
+    anim_driver_refresh();
+}
+
+static void window_disappear(Window *window) {
+    s_main_window_visible = false;
+    tilt_sensing_refresh();
+    anim_driver_refresh();
+}
+
 static void window_unload(Window *window) {
+    mode_transition_stop();
+    #if PBL_API_EXISTS(unobstructed_area_service_subscribe)
+        unobstructed_area_service_unsubscribe();
+    #endif
+    s_reflowing = false;
     text_layer_destroy(s_title_layer);
     text_layer_destroy(s_time_layer);
     text_layer_destroy(s_hint_layer);
+    layer_destroy(s_time_overlay_layer);
     layer_destroy(s_canvas_layer);
+    display_release();
+    display_fonts_unload();
 }
 
 // =============================================================================
@@ -664,10 +1315,10 @@ static void init(void) {
     
     // Apply saved settings to context
     settings_apply_to_context(&s_settings, &s_timer_ctx);
+    dashboard_init(&s_dashboard);
     
-    // Initialize animation state
-    animation_init_hourglass(&s_anim_state.hourglass);
-    animation_init_matrix(&s_anim_state.matrix, 0);
+    // Tilt sensing stops when the battery runs low
+    battery_state_service_subscribe(battery_handler);
     
     // Create main window
     s_main_window = window_create();
@@ -675,6 +1326,8 @@ static void init(void) {
     window_set_click_config_provider(s_main_window, click_config_provider);
     window_set_window_handlers(s_main_window, (WindowHandlers) {
         .load = window_load,
+        .appear = window_appear,
+        .disappear = window_disappear,
         .unload = window_unload,
     });
     
@@ -688,6 +1341,10 @@ static void deinit(void) {
     
     stop_vibration_loop();
     tick_timer_service_unsubscribe();
+    battery_state_service_unsubscribe();
+    if (s_tilt_subscribed) {
+        accel_data_service_unsubscribe();
+    }
     window_destroy(s_main_window);
     
     if (s_visual_detail_window) {
@@ -696,6 +1353,9 @@ static void deinit(void) {
     if (s_visual_menu_window) {
         window_destroy(s_visual_menu_window);
     }
+    if (s_dashboard_window) {
+        window_destroy(s_dashboard_window);
+    }
 }
 
 int main(void) {
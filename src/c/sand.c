@@ -0,0 +1,150 @@
+#include "sand.h"
+#include <string.h>
+
+// =============================================================================
+// Wall Masks
+// =============================================================================
+// Open cells per row for the emitter's 60x100 glass with its 8px neck: the
+// cells that stay clear of the 2px walls, antialiasing included, so that
+// redrawing sand never overlaps the glass. The neck is one cell wide.
+
+#define SAND_SPAN(n) ((SandRow)(((1u << (n)) - 1) << (SAND_COLS / 2 - (n) / 2)))
+
+static const SandRow s_masks[SAND_ROWS] = {
+    // Top chamber, wide end first (the first row is against the rim)
+    0,             SAND_SPAN(15), SAND_SPAN(13), SAND_SPAN(13),
+    SAND_SPAN(11), SAND_SPAN(11), SAND_SPAN(9),  SAND_SPAN(9),
+    SAND_SPAN(7),  SAND_SPAN(7),  SAND_SPAN(5),  SAND_SPAN(5),
+    SAND_SPAN(3),  SAND_SPAN(3),  SAND_SPAN(1),  SAND_SPAN(1),
+    // Bottom chamber, neck first
+    SAND_SPAN(1),  SAND_SPAN(1),  SAND_SPAN(3),  SAND_SPAN(3),
+    SAND_SPAN(5),  SAND_SPAN(5),  SAND_SPAN(7),  SAND_SPAN(7),
+    SAND_SPAN(9),  SAND_SPAN(9),  SAND_SPAN(11), SAND_SPAN(11),
+    SAND_SPAN(13), SAND_SPAN(13), SAND_SPAN(15), SAND_SPAN(15),
+};
+
+SandRow sand_row_mask(int row) {
+    return (row >= 0 && row < SAND_ROWS) ? s_masks[row] : 0;
+}
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+// Pour `count` grains into a settled pile starting at `row`, filling each
+// row from the middle out before moving up
+static void fill_settled(SandRow *rows, int row, int count) {
+    for (; count > 0 && row >= 0; row--) {
+        for (int k = 0; k < SAND_COLS && count > 0; k++) {
+            int col = (k & 1) ? SAND_COLS / 2 - (k + 1) / 2 : SAND_COLS / 2 + k / 2;
+            SandRow bit = (SandRow)(1u << col);
+            if (s_masks[row] & bit) {
+                rows[row] |= bit;
+                count--;
+            }
+        }
+    }
+}
+
+void sand_init(SandGrid *grid, int released) {
+    if (released < 0) released = 0;
+    if (released > SAND_GRAINS) released = SAND_GRAINS;
+
+    memset(grid, 0, sizeof(*grid));
+    fill_settled(grid->rows, SAND_CHAMBER_ROWS - 1, SAND_GRAINS - released);
+    fill_settled(grid->rows, SAND_ROWS - 1, released);
+    grid->released = (uint16_t)released;
+    grid->target = (uint16_t)released;
+    grid->settled = true;
+}
+
+void sand_set_target(SandGrid *grid, int target) {
+    if (target > SAND_GRAINS) target = SAND_GRAINS;
+    if (target <= grid->target) return;
+
+    if (target - grid->released > SAND_MAX_BACKLOG) {
+        sand_init(grid, target);
+    } else {
+        grid->target = (uint16_t)target;
+    }
+}
+
+// =============================================================================
+// Stepping
+// =============================================================================
+
+// Move one grain from the bottom of the top chamber into the neck of the
+// bottom one
+static bool release_grain(SandGrid *grid) {
+    if (grid->released >= grid->target) return false;
+
+    SandRow *above = &grid->rows[SAND_CHAMBER_ROWS - 1];
+    SandRow *below = &grid->rows[SAND_CHAMBER_ROWS];
+    SandRow through = *above & s_masks[SAND_CHAMBER_ROWS] & (SandRow)~*below;
+    if (!through) return false;
+
+    SandRow grain = (SandRow)(through & -through);
+    *above &= (SandRow)~grain;
+    *below |= grain;
+    grid->released++;
+    return true;
+}
+
+// Let the grains of `row` fall into the row below: straight down where the
+// cell is open, otherwise down-left or down-right, trying `left_first` side
+// first so neither side is favoured over time. Returns true if any moved.
+static bool fall_row(SandRow *rows, int row, bool left_first) {
+    SandRow open = s_masks[row + 1] & (SandRow)~rows[row + 1];
+    SandRow grains = rows[row];
+
+    SandRow down = grains & open;
+    grains &= (SandRow)~down;
+    open &= (SandRow)~down;
+
+    // Bit `col` moving to col - 1 is a right shift
+    SandRow left, right;
+    if (left_first) {
+        left = (SandRow)(grains >> 1) & open;
+        grains &= (SandRow)~(left << 1);
+        open &= (SandRow)~left;
+        right = (SandRow)(grains << 1) & open;
+        grains &= (SandRow)~(right >> 1);
+    } else {
+        right = (SandRow)(grains << 1) & open;
+        grains &= (SandRow)~(right >> 1);
+        open &= (SandRow)~right;
+        left = (SandRow)(grains >> 1) & open;
+        grains &= (SandRow)~(left << 1);
+    }
+
+    SandRow moved = down | left | right;
+    rows[row + 1] |= moved;
+    rows[row] = grains;
+    return moved != 0;
+}
+
+void sand_step(SandGrid *grid) {
+    bool moved = release_grain(grid);
+
+    // Bottom-up, so a grain falls at most one row per step. The last row of
+    // each chamber is a floor (the neck only opens through release_grain).
+    for (int row = SAND_ROWS - 2; row >= 0; row--) {
+        if (row == SAND_CHAMBER_ROWS - 1) continue;
+        moved |= fall_row(grid->rows, row, ((grid->steps + row) & 1) != 0);
+    }
+
+    grid->steps++;
+    grid->settled = !moved;
+}
+
+bool sand_is_idle(const SandGrid *grid) {
+    return grid->settled && grid->released >= grid->target;
+}
+
+int sand_count(const SandGrid *grid, int first_row, int num_rows) {
+    int count = 0;
+    for (int row = first_row; row < first_row + num_rows && row < SAND_ROWS; row++) {
+        count += __builtin_popcount(grid->rows[row]);
+    }
+    return count;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// =============================================================================
+// Falling Sand - Bitboard Cellular Automaton (No SDK Dependencies)
+// =============================================================================
+// The hourglass is a SAND_COLS x SAND_ROWS grid with one bit per cell, bit
+// `col` of rows[row]. Rows 0 .. SAND_CHAMBER_ROWS - 1 are the top chamber and
+// the rest the bottom one; each row has a fixed wall mask tracing the glass.
+// A step moves every grain that can fall one row, straight down or else
+// diagonally, using a handful of shift/mask operations per row, so its cost
+// is fixed by the grid size rather than by the number of grains.
+//
+// The neck is closed to the automaton. Grains cross it only when released,
+// one per step, until the released count reaches the target the countdown
+// sets.
+
+#define SAND_COLS 15
+#define SAND_CHAMBER_ROWS 16
+#define SAND_ROWS (2 * SAND_CHAMBER_ROWS)
+#define SAND_GRAINS 64
+
+// A target this far ahead of the released count (e.g. after the app was
+// closed mid-countdown) is reached by settling at once instead of pouring
+#define SAND_MAX_BACKLOG 16
+
+typedef uint16_t SandRow;
+
+typedef struct {
+    SandRow rows[SAND_ROWS];
+    uint16_t released;  // Grains through the neck so far
+    uint16_t target;    // Released count the countdown calls for
+    uint16_t steps;     // Alternates which diagonal is tried first
+    bool settled;       // Nothing moved in the last step
+} SandGrid;
+
+// Cells inside the glass for a row
+SandRow sand_row_mask(int row);
+
+// Settled grid with `released` grains already in the bottom chamber
+void sand_init(SandGrid *grid, int released);
+
+// Raise the release target (it never goes back down)
+void sand_set_target(SandGrid *grid, int target);
+
+// Advance one step: release a grain at the neck if due, then let every
+// grain fall
+void sand_step(SandGrid *grid);
+
+// True when stepping would change nothing
+bool sand_is_idle(const SandGrid *grid);
+
+// Grains currently in rows [first_row, first_row + num_rows)
+int sand_count(const SandGrid *grid, int first_row, int num_rows);
@@ -1,5 +1,6 @@
 #include "settings.h"
 #include "time_utils.h"
+#include "display/grid.h"
 
 // =============================================================================
 // Settings Initialization
@@ -13,6 +14,7 @@ void settings_init_defaults(TimerSettings *settings) {
     
     for (int i = 0; i < DISPLAY_MODE_COUNT; i++) {
         settings->visualization_enabled[i] = true;
+        settings->grid_density[i] = GRID_DENSITY_NORMAL;
     }
     colors_load_default_palettes(settings->visualization_colors);
 }
@@ -64,6 +66,13 @@ void settings_validate(TimerSettings *settings) {
         }
     }
     
+    // Validate grid density (saved on emery, loaded elsewhere, or corrupt)
+    for (int i = 0; i < DISPLAY_MODE_COUNT; i++) {
+        if (settings->grid_density[i] < 0 || settings->grid_density[i] >= GRID_DENSITY_COUNT) {
+            settings->grid_density[i] = GRID_DENSITY_NORMAL;
+        }
+    }
+    
     // Validate preset index (0-3 for presets, 4 for custom)
     if (settings->default_preset_index > TIMER_CUSTOM_OPTION) {
         settings->default_preset_index = 0;
@@ -86,6 +95,7 @@ void settings_apply_to_context(const TimerSettings *settings, TimerContext *ctx)
     ctx->display_mode = settings->default_display_mode;
     for (int i = 0; i < DISPLAY_MODE_COUNT; i++) {
         ctx->display_mode_enabled[i] = settings->visualization_enabled[i];
+        ctx->grid_density[i] = settings->grid_density[i];
     }
     ctx->selected_preset = settings->default_preset_index;
     ctx->hide_time_text = settings->hide_time_text;
@@ -107,13 +117,13 @@ void settings_update_from_context(TimerSettings *settings, const TimerContext *c
 // Settings Persistence Helpers
 // =============================================================================
 
-static bool settings_load_blob(TimerSettings *settings) {
+static bool settings_load_blob(TimerSettings *settings, size_t size) {
     if (!persist_exists(SETTINGS_KEY_DATA)) {
         return false;
     }
     
-    int bytes_read = persist_read_data(SETTINGS_KEY_DATA, settings, sizeof(TimerSettings));
-    return bytes_read == (int)sizeof(TimerSettings);
+    int bytes_read = persist_read_data(SETTINGS_KEY_DATA, settings, size);
+    return bytes_read == (int)size;
 }
 
 static void settings_load_legacy_v1(TimerSettings *settings) {
@@ -139,7 +149,12 @@ void settings_persist_load(TimerSettings *settings) {
         int version = persist_read_int(SETTINGS_KEY_VERSION);
         
         if (version == SETTINGS_VERSION) {
-            if (!settings_load_blob(settings)) {
+            if (!settings_load_blob(settings, sizeof(TimerSettings))) {
+                settings_init_defaults(settings);
+            }
+        } else if (version == 4) {
+            // v4 lacks the trailing grid density; keep defaults for it
+            if (!settings_load_blob(settings, offsetof(TimerSettings, grid_density))) {
                 settings_init_defaults(settings);
             }
         } else if (version == 1) {
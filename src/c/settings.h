@@ -23,7 +23,7 @@
 #define SETTINGS_KEY_HIDE_TIME     0x1004  // Legacy v1
 
 // Current settings version (increment when structure changes)
-#define SETTINGS_VERSION 4
+#define SETTINGS_VERSION 5
 
 // =============================================================================
 // Settings Structure
@@ -39,6 +39,9 @@ typedef struct {
     // Timer defaults
     int default_preset_index;          // Default preset to select (0-3 for presets, 4 for custom)
     int default_custom_minutes;        // Default custom time in minutes (when preset is custom)
+    
+    // Added in v5 (kept last so a v4 blob is a prefix of this structure)
+    int grid_density[DISPLAY_MODE_COUNT];  // GRID_DENSITY_* level for grid modes
 } TimerSettings;
 
 // =============================================================================
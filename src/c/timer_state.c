@@ -1,4 +1,5 @@
 #include "timer_state.h"
+#include "mode_registry.h"
 
 // =============================================================================
 // Context Initialization
@@ -10,6 +11,7 @@ void timer_context_init(TimerContext *ctx) {
     
     for (int i = 0; i < DISPLAY_MODE_COUNT; i++) {
         ctx->display_mode_enabled[i] = true;
+        ctx->grid_density[i] = 0;
     }
     
     ctx->remaining_seconds = 0;
@@ -23,12 +25,12 @@ void timer_context_init(TimerContext *ctx) {
 TimerEffects timer_effects_none(void) {
     TimerEffects effects = {
         .update_display = false,
+        .update_time_overlay = false,
         .subscribe_tick_timer = false,
         .unsubscribe_tick_timer = false,
         .start_vibration = false,
         .stop_vibration = false,
-        .init_hourglass = false,
-        .init_matrix = false,
+        .activate_mode = false,
         .vibrate_short = false,
         .pop_window = false
     };
@@ -40,24 +42,7 @@ TimerEffects timer_effects_none(void) {
 // =============================================================================
 
 const char* timer_display_mode_name(DisplayMode mode) {
-    switch (mode) {
-        case DISPLAY_MODE_TEXT:            return "Text";
-        case DISPLAY_MODE_BLOCKS:          return "Blocks";
-        case DISPLAY_MODE_VERTICAL_BLOCKS: return "Vertical Blocks";
-        case DISPLAY_MODE_CLOCK:           return "Clock";
-        case DISPLAY_MODE_RING:            return "Ring";
-        case DISPLAY_MODE_HOURGLASS:       return "Hourglass";
-        case DISPLAY_MODE_BINARY:          return "Binary";
-        case DISPLAY_MODE_RADIAL:          return "Radial";
-        case DISPLAY_MODE_HEX:             return "Hex";
-        case DISPLAY_MODE_MATRIX:          return "Matrix";
-        case DISPLAY_MODE_WATER_LEVEL:     return "Water Level";
-        case DISPLAY_MODE_SPIRAL_OUT:      return "Spiral Out";
-        case DISPLAY_MODE_SPIRAL_IN:       return "Spiral In";
-        case DISPLAY_MODE_PERCENT:         return "% Elapsed";
-        case DISPLAY_MODE_PERCENT_REMAINING: return "% Remaining";
-        default:                           return "Text";
-    }
+    return mode_descriptor(mode)->name;
 }
 
 bool timer_is_active(const TimerContext *ctx) {
@@ -86,8 +71,7 @@ TimerEffects timer_start(TimerContext *ctx, int minutes) {
     
     effects.subscribe_tick_timer = true;
     effects.update_display = true;
-    effects.init_hourglass = true;
-    effects.init_matrix = true;
+    effects.activate_mode = true;
     
     return effects;
 }
@@ -127,6 +111,7 @@ TimerEffects timer_resume(TimerContext *ctx) {
     
     if (ctx->state == STATE_PAUSED) {
         ctx->state = STATE_RUNNING;
+        effects.subscribe_tick_timer = true;
         effects.update_display = true;
     }
     
@@ -156,9 +141,9 @@ TimerEffects timer_restart(TimerContext *ctx) {
     ctx->remaining_seconds = ctx->total_seconds;
     ctx->state = STATE_RUNNING;
     
+    effects.subscribe_tick_timer = true;
     effects.update_display = true;
-    effects.init_hourglass = true;
-    effects.init_matrix = true;
+    effects.activate_mode = true;
     
     return effects;
 }
@@ -215,7 +200,7 @@ TimerEffects timer_toggle_hide_time_text(TimerContext *ctx) {
     ctx->hide_time_text = !ctx->hide_time_text;
     
     effects.vibrate_short = true;
-    effects.update_display = true;
+    effects.update_time_overlay = true;
     
     return effects;
 }
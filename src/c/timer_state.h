@@ -70,6 +70,7 @@ typedef struct {
     
     // Display options
     bool hide_time_text;  // Hide m:ss overlay on visualizations
+    int grid_density[DISPLAY_MODE_COUNT];  // Grid size level for grid modes
 } TimerContext;
 
 // =============================================================================
@@ -80,12 +81,12 @@ typedef struct {
 
 typedef struct {
     bool update_display;
+    bool update_time_overlay;   // Only the m:ss overlay changed
     bool subscribe_tick_timer;
     bool unsubscribe_tick_timer;
     bool start_vibration;
     bool stop_vibration;
-    bool init_hourglass;
-    bool init_matrix;
+    bool activate_mode;         // Restart the shown mode's animation
     bool vibrate_short;
     bool pop_window;
 } TimerEffects;
@@ -0,0 +1,117 @@
+#include "view_model.h"
+#include <stdio.h>
+#include <string.h>
+
+// =============================================================================
+// Building
+// =============================================================================
+
+void view_model_build(const TimerContext *ctx, ViewModel *model) {
+    char *title = model->text[VIEW_TEXT_TITLE];
+    char *time = model->text[VIEW_TEXT_TIME];
+    char *hint = model->text[VIEW_TEXT_HINT];
+
+    bool show_canvas = timer_should_show_canvas(ctx);
+    bool running_canvas = show_canvas && ctx->state == STATE_RUNNING;
+
+    model->canvas_shown = show_canvas;
+    model->text_shown[VIEW_TEXT_TITLE] = !running_canvas;
+    model->text_shown[VIEW_TEXT_TIME] = !show_canvas;
+    model->text_shown[VIEW_TEXT_HINT] = !running_canvas;
+    model->valid = true;
+
+    switch (ctx->state) {
+        case STATE_SELECT_PRESET:
+            snprintf(title, VIEW_TEXT_MAX, "Select Time");
+            time_format_preset(ctx->selected_preset, time, VIEW_TEXT_MAX);
+            snprintf(hint, VIEW_TEXT_MAX, "UP/DOWN: Change\nSELECT: Start\nHold: %s",
+                     timer_display_mode_name(ctx->display_mode));
+            model->time_tone = VIEW_TONE_NORMAL;
+            break;
+
+        case STATE_SET_CUSTOM_HOURS:
+            snprintf(title, VIEW_TEXT_MAX, "Set Hours");
+            snprintf(time, VIEW_TEXT_MAX, "%d hr", ctx->custom_hours);
+            snprintf(hint, VIEW_TEXT_MAX, "UP/DOWN: Adjust\nSELECT: Next");
+            model->time_tone = VIEW_TONE_NORMAL;
+            break;
+
+        case STATE_SET_CUSTOM_MINUTES:
+            snprintf(title, VIEW_TEXT_MAX, "Set Minutes");
+            snprintf(time, VIEW_TEXT_MAX, "%d min", ctx->custom_minutes);
+            snprintf(hint, VIEW_TEXT_MAX, "UP/DOWN: Adjust\nSELECT: Start");
+            model->time_tone = VIEW_TONE_NORMAL;
+            break;
+
+        case STATE_RUNNING:
+            title[0] = '\0';
+            time_format_adaptive(ctx->remaining_seconds, time, VIEW_TEXT_MAX);
+            hint[0] = '\0';
+            model->time_tone = (ctx->remaining_seconds <= 10) ? VIEW_TONE_LOW : VIEW_TONE_RUNNING;
+            break;
+
+        case STATE_PAUSED:
+            snprintf(title, VIEW_TEXT_MAX, "Paused");
+            time_format_adaptive(ctx->remaining_seconds, time, VIEW_TEXT_MAX);
+            snprintf(hint, VIEW_TEXT_MAX, "SELECT: Resume\nUP: Restart\nDOWN: Cancel");
+            model->time_tone = VIEW_TONE_PAUSED;
+            break;
+
+        case STATE_COMPLETED:
+            snprintf(title, VIEW_TEXT_MAX, "Complete!");
+            snprintf(time, VIEW_TEXT_MAX, "0:00");
+            snprintf(hint, VIEW_TEXT_MAX, "SELECT/UP: Restart\nDOWN: Dismiss");
+            model->time_tone = VIEW_TONE_COMPLETED;
+            break;
+
+        case STATE_CONFIRM_EXIT:
+            snprintf(title, VIEW_TEXT_MAX, "Timer Active!");
+            snprintf(time, VIEW_TEXT_MAX, "Exit?");
+            snprintf(hint, VIEW_TEXT_MAX, "UP: Yes, exit\nDOWN: No, stay");
+            model->time_tone = VIEW_TONE_PAUSED;
+            break;
+    }
+}
+
+// =============================================================================
+// Applying
+// =============================================================================
+
+void view_model_invalidate(ViewModel *applied) {
+    applied->valid = false;
+}
+
+void view_model_apply(ViewModel *applied, const ViewModel *next, const ViewSink *sink) {
+    bool all = !applied->valid;
+
+    if (all || applied->canvas_shown != next->canvas_shown) {
+        sink->set_canvas_shown(next->canvas_shown, sink->context);
+        applied->canvas_shown = next->canvas_shown;
+    }
+
+    if (all || applied->time_tone != next->time_tone) {
+        sink->set_time_tone(next->time_tone, sink->context);
+        applied->time_tone = next->time_tone;
+    }
+
+    // Text before visibility, so a layer never shows stale text
+    for (int i = 0; i < VIEW_TEXT_COUNT; i++) {
+        ViewText which = (ViewText)i;
+        if (next->text_shown[i] && (all || strcmp(applied->text[i], next->text[i]) != 0)) {
+            strcpy(applied->text[i], next->text[i]);
+            sink->set_text(which, applied->text[i], sink->context);
+        } else if (all) {
+            // Hidden from the start: give the layer a valid, empty string
+            // and leave the shown branch to catch it up later
+            applied->text[i][0] = '\0';
+            sink->set_text(which, applied->text[i], sink->context);
+        }
+
+        if (all || applied->text_shown[i] != next->text_shown[i]) {
+            sink->set_text_shown(which, next->text_shown[i], sink->context);
+            applied->text_shown[i] = next->text_shown[i];
+        }
+    }
+
+    applied->valid = true;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdbool.h>
+#include "timer_state.h"
+
+// =============================================================================
+// Main Window View Model - Pure Logic (No SDK Dependencies)
+// =============================================================================
+// Everything the main window's text layers show, derived from the timer
+// context: which layers are visible, their text and the time's color tone.
+// view_model_apply compares a new view model with the one last applied and
+// hands only the differences to a sink, which the SDK layer backs with the
+// real layer setters. A tick in Text mode touches just the time layer; a
+// tick behind a visualization touches nothing.
+//
+// Text for a hidden layer is not written; it catches up when the layer is
+// shown again.
+
+typedef enum {
+    VIEW_TEXT_TITLE,
+    VIEW_TEXT_TIME,
+    VIEW_TEXT_HINT,
+    VIEW_TEXT_COUNT
+} ViewText;
+
+// The time layer's color, mapped to a GColor by the SDK layer
+typedef enum {
+    VIEW_TONE_NORMAL,
+    VIEW_TONE_RUNNING,
+    VIEW_TONE_PAUSED,
+    VIEW_TONE_LOW,
+    VIEW_TONE_COMPLETED
+} ViewTone;
+
+#define VIEW_TEXT_MAX 64
+
+typedef struct {
+    bool canvas_shown;                      // Visualization instead of the black window
+    bool text_shown[VIEW_TEXT_COUNT];
+    ViewTone time_tone;
+    char text[VIEW_TEXT_COUNT][VIEW_TEXT_MAX];
+    bool valid;                             // False until first applied
+} ViewModel;
+
+// Property setters the applied differences are handed to
+typedef struct {
+    void (*set_canvas_shown)(bool shown, void *context);
+    void (*set_text_shown)(ViewText which, bool shown, void *context);
+    void (*set_text)(ViewText which, const char *text, void *context);
+    void (*set_time_tone)(ViewTone tone, void *context);
+    void *context;
+} ViewSink;
+
+// Describe the main window for the timer's current state
+void view_model_build(const TimerContext *ctx, ViewModel *model);
+
+// Forget what was applied, so the next apply writes everything
+void view_model_invalidate(ViewModel *applied);
+
+// Write what differs between applied and next to the sink and record it in
+// applied. Text is passed from applied's own buffers, which stay put for
+// layers that keep a pointer to it.
+void view_model_apply(ViewModel *applied, const ViewModel *next, const ViewSink *sink);
@@ -0,0 +1,105 @@
+#include "water.h"
+#include <string.h>
+
+// Wave speed: acceleration is (left + right - 2 * self) * WAVE_K / 16, which
+// stays stable up to 8
+#define WAVE_K 6
+
+// Pull toward the target: 1 / 2^SPRING_SHIFT of the gap per step
+#define SPRING_SHIFT 5
+
+// Velocity kept per step, out of 16
+#define DAMPING 15
+
+// Close enough to the target to snap onto it
+#define REST_HEIGHT (WATER_ONE / 4)
+#define REST_VELOCITY 2
+
+#define MAX_HEIGHT (WATER_MAX_OFFSET * WATER_ONE)
+
+static int32_t clamp(int32_t v, int32_t lo, int32_t hi) {
+    return (v < lo) ? lo : (v > hi) ? hi : v;
+}
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+void water_init(WaterSurface *surface) {
+    memset(surface, 0, sizeof(*surface));
+    surface->still = true;
+}
+
+void water_set_tilt(WaterSurface *surface, int accel_x) {
+    accel_x = clamp(accel_x, -1000, 1000);
+    int delta = accel_x - surface->tilt;
+    if (delta > -WATER_TILT_DEADBAND && delta < WATER_TILT_DEADBAND) return;
+    surface->tilt = (int16_t)accel_x;
+
+    // A level surface seen from the tilted screen: tan(tilt) ~ x / 1000
+    // pixels per pixel, measured from the middle of the container
+    bool changed = false;
+    for (int col = 0; col < WATER_COLUMNS; col++) {
+        int32_t twice_dx = (2 * col - (WATER_COLUMNS - 1)) * WATER_COLUMN_WIDTH;
+        int32_t target = clamp(-accel_x * twice_dx * WATER_ONE / 2000, -MAX_HEIGHT, MAX_HEIGHT);
+        if (surface->target[col] != target) {
+            surface->target[col] = (int16_t)target;
+            changed = true;
+        }
+    }
+    if (changed) {
+        surface->still = false;
+    }
+}
+
+// =============================================================================
+// Stepping
+// =============================================================================
+
+void water_step(WaterSurface *surface) {
+    if (surface->still) return;
+
+    // Waves travel on the displacement from the rest shape, so a tilted
+    // surface at rest feels no pull from the walls
+    int32_t d[WATER_COLUMNS];
+    for (int col = 0; col < WATER_COLUMNS; col++) {
+        d[col] = surface->height[col] - surface->target[col];
+    }
+
+    // Accelerations from this step's heights, before any column moves
+    bool resting = true;
+    for (int col = 0; col < WATER_COLUMNS; col++) {
+        int32_t left = d[col > 0 ? col - 1 : col];
+        int32_t right = d[col < WATER_COLUMNS - 1 ? col + 1 : col];
+
+        int32_t accel = (left + right - 2 * d[col]) * WAVE_K / 16 - d[col] / (1 << SPRING_SHIFT);
+        int32_t v = (surface->velocity[col] + accel) * DAMPING / 16;
+        surface->velocity[col] = (int16_t)clamp(v, -MAX_HEIGHT, MAX_HEIGHT);
+
+        if (d[col] < -REST_HEIGHT || d[col] > REST_HEIGHT || v < -REST_VELOCITY || v > REST_VELOCITY) {
+            resting = false;
+        }
+    }
+
+    for (int col = 0; col < WATER_COLUMNS; col++) {
+        int32_t h = surface->height[col] + surface->velocity[col];
+        surface->height[col] = (int16_t)clamp(h, -MAX_HEIGHT, MAX_HEIGHT);
+    }
+
+    if (resting) {
+        memcpy(surface->height, surface->target, sizeof(surface->height));
+        memset(surface->velocity, 0, sizeof(surface->velocity));
+        surface->still = true;
+    }
+}
+
+bool water_is_still(const WaterSurface *surface) {
+    return surface->still;
+}
+
+int water_column_offset(const WaterSurface *surface, int col) {
+    if (col < 0 || col >= WATER_COLUMNS) return 0;
+    int32_t h = surface->height[col];
+    // Round to the nearest pixel, symmetrically about zero
+    return (int)((h >= 0) ? (h + WATER_ONE / 2) / WATER_ONE : -((-h + WATER_ONE / 2) / WATER_ONE));
+}
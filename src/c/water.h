@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// =============================================================================
+// Water Surface - Fixed-Point 1-D Wave Simulation (No SDK Dependencies)
+// =============================================================================
+// The Water Level surface is WATER_COLUMNS column heights, in 1/WATER_ONE
+// pixels relative to the level the countdown sets. Each step couples every
+// column to its neighbours (the discrete wave equation), pulls it toward the
+// slope the wrist's tilt calls for and damps it, all in integer math. The
+// container walls reflect waves.
+//
+// Once every column has come to rest on its target the surface snaps to it
+// and reports itself still; stepping a still surface changes nothing, so the
+// animation driver stops until the tilt changes again.
+
+#define WATER_COLUMNS 15
+#define WATER_COLUMN_WIDTH 3   // Pixels per column for the tilt's slope (drawn one unit wide)
+#define WATER_ONE 256          // Fixed-point pixel
+
+// The surface never rises or falls more than this many pixels from the level
+#define WATER_MAX_OFFSET 12
+
+// Readings within this many milli-g of the applied tilt are sensor noise and
+// leave the surface asleep
+#define WATER_TILT_DEADBAND 40
+
+typedef struct {
+    int16_t height[WATER_COLUMNS];    // Above the level, 1/WATER_ONE px (up is positive)
+    int16_t velocity[WATER_COLUMNS];  // Per step, same units
+    int16_t target[WATER_COLUMNS];    // Rest shape for the applied tilt
+    int16_t tilt;                     // Applied accelerometer x, milli-g
+    bool still;                       // At rest on the target
+} WaterSurface;
+
+// Flat and still
+void water_init(WaterSurface *surface);
+
+// Tilt the rest shape from an accelerometer reading along the screen's x
+// axis, in milli-g as the SDK reports it (gravity reads as "up", so a
+// negative x means the right side is low and the water piles up there)
+void water_set_tilt(WaterSurface *surface, int accel_x);
+
+// Advance one step
+void water_step(WaterSurface *surface);
+
+bool water_is_still(const WaterSurface *surface);
+
+// Whole pixels a column stands above the level
+int water_column_offset(const WaterSurface *surface, int col);
@@ -0,0 +1,408 @@
+// =============================================================================
+// Display List Benchmark
+// =============================================================================
+// Runs a 15 minute countdown through every mode with an emitter on a 144x168
+// screen and reports, per incremental frame: primitives emitted, primitives
+// the plan issues and how many of those are repainted in place, damaged share
+// of the screen, overdraw (issued bounds over damaged area, so repaints push
+// it up) and the host cost of emitting plus planning.
+//
+// Time text boxes are planned at their full emitted size here; on the watch
+// the executor first shrinks numeral text to its glyph cells. The hourglass
+// sand is stepped a second's worth at a time between frames. Static outlines
+// are drawn from vector art, as on every platform but aplite.
+//
+// A second table follows each mode through Timeline Quick View sliding in
+// (168 to 117 px tall in SLIDE_STEPS frames), laid out again at every
+// step's height ("layout") or interpolated from layouts made at either end
+// ("reflow", reflow.h): draw calls, damage and host cost per step, the
+// reflow's two layouts included.
+//
+// The last table compares a second of the dashboard, four timers of the mode
+// in quarter tiles (display_emit_tile), with a second of the mode on the
+// whole screen: draw calls, damage and host cost summed over the tiles.
+//
+// The last table counts graphics_context_set_* calls per frame for every mode
+// that draws through the SDK, before and after batching (draw_batch.h): list
+// primitives in list order each setting all they need, against batched
+// through one state cache; grid cells and Matrix characters one at a time,
+// against one pass per color. Grid and Matrix counts are for the SDK
+// fallback, as their framebuffer paths set nothing. Full frames are halfway
+// through the countdown; incremental ones average over it (Matrix redraws
+// everything each animation step). Text draws only its time overlay.
+//
+// Usage: make bench
+
+#include <stdio.h>
+#include <time.h>
+#include "../src/c/display/display_emit.h"
+#include "../src/c/display/reflow.h"
+#include "../src/c/display/draw_batch.h"
+#include "../src/c/display/grid.h"
+#include "../src/c/animation.h"
+
+#define BENCH_WIDTH 144
+#define BENCH_HEIGHT 168
+#define BENCH_TOTAL_SECONDS 900
+#define PEEK_HEIGHT 117
+#define SLIDE_STEPS 8
+#define SLIDE_REPEATS 200
+
+static DisplayList s_list;
+static DisplayListHistory s_history;
+static DisplayListPlan s_plan;
+static SandGrid s_sand;
+static ListReflow s_reflow;
+static DisplayListHistory s_tile_history[DISPLAY_TILE_MAX];
+
+static const struct {
+    DisplayMode mode;
+    const char *name;
+} s_modes[] = {
+    { DISPLAY_MODE_CLOCK, "clock" },
+    { DISPLAY_MODE_RING, "ring" },
+    { DISPLAY_MODE_HOURGLASS, "hourglass" },
+    { DISPLAY_MODE_BINARY, "binary" },
+    { DISPLAY_MODE_RADIAL, "radial" },
+    { DISPLAY_MODE_HEX, "hex" },
+    { DISPLAY_MODE_WATER_LEVEL, "water" },
+    { DISPLAY_MODE_PERCENT, "percent" },
+    { DISPLAY_MODE_PERCENT_REMAINING, "remaining" },
+};
+
+typedef struct {
+    long calls;
+    double damaged;
+    double host_us;
+} SlideStats;
+
+// Grid modes as display_modes.c sets them up at the normal density
+static const struct {
+    const char *name;
+    int cols;
+    int rows;
+    GridOrderBuilder order;
+} s_grid_modes[] = {
+    { "blocks", 12, 8, grid_order_rows },
+    { "vertical", 8, 12, grid_order_columns },
+    { "spiral out", 9, 9, grid_order_spiral_out },
+    { "spiral in", 9, 9, grid_order_spiral_in },
+};
+
+typedef struct {
+    double full[2];          // Before, after
+    double incremental[2];
+} StateStats;
+
+// A countdown's incremental frames, on the whole screen or in four tiles
+static void dashboard_second(DisplayMode mode, DisplayInput in, bool tiled, SlideStats *stats) {
+    DlRect tiles[DISPLAY_TILE_MAX];
+    display_tile_layout(DISPLAY_TILE_MAX, BENCH_WIDTH, BENCH_HEIGHT, tiles);
+    int count = tiled ? DISPLAY_TILE_MAX : 1;
+    for (int t = 0; t < count; t++) {
+        display_list_history_invalidate(&s_tile_history[t]);
+    }
+    *stats = (SlideStats){ 0 };
+
+    clock_t start = clock();
+    for (int remaining = BENCH_TOTAL_SECONDS; remaining >= 0; remaining--) {
+        bool first = remaining == BENCH_TOTAL_SECONDS;
+        for (int t = 0; t < count; t++) {
+            // Timers a little apart, so their digits change on different ticks
+            in.remaining_seconds = remaining > t * 7 ? remaining - t * 7 : 0;
+            if (tiled) {
+                display_emit_tile(&s_list, mode, &in, tiles[t], t == 0);
+            } else {
+                display_emit(&s_list, mode, &in);
+            }
+            display_list_plan(&s_tile_history[t], &s_list, BENCH_WIDTH, BENCH_HEIGHT, first, &s_plan);
+            if (first) continue;
+            stats->calls += s_plan.stats.draw_calls;
+            stats->damaged += s_plan.stats.damaged_area;
+        }
+    }
+    clock_t end = clock();
+    stats->host_us = (double)(end - start) * 1e6 / CLOCKS_PER_SEC / (BENCH_TOTAL_SECONDS + 1);
+}
+
+// One slide, after a frame at the full height; `in` holds the state to draw
+static void slide(DisplayMode mode, DisplayInput in, bool reflow, SlideStats *stats) {
+    DisplayInput peek = in;
+    peek.height = PEEK_HEIGHT;
+    *stats = (SlideStats){ 0 };
+
+    clock_t start = clock();
+    for (int r = 0; r < SLIDE_REPEATS; r++) {
+        display_list_history_invalidate(&s_history);
+        display_emit(&s_list, mode, &in);
+        display_list_plan(&s_history, &s_list, BENCH_WIDTH, BENCH_HEIGHT, true, &s_plan);
+        if (reflow) {
+            list_reflow_from(&s_reflow, &s_list);
+            display_emit(&s_list, mode, &peek);
+            list_reflow_to(&s_reflow, &s_list);
+        }
+        for (int step = 1; step <= SLIDE_STEPS; step++) {
+            int32_t progress = step * REFLOW_PROGRESS_MAX / SLIDE_STEPS;
+            if (reflow) {
+                display_emit(&s_list, mode, &peek);
+                list_reflow_apply(&s_reflow, &s_list, progress);
+            } else {
+                DisplayInput at = in;
+                at.height = reflow_lerp(BENCH_HEIGHT, PEEK_HEIGHT, progress);
+                display_emit(&s_list, mode, &at);
+            }
+            display_list_plan(&s_history, &s_list, BENCH_WIDTH, PEEK_HEIGHT, false, &s_plan);
+            if (r == 0) {
+                stats->calls += s_plan.stats.draw_calls;
+                stats->damaged += s_plan.stats.damaged_area;
+            }
+        }
+    }
+    clock_t end = clock();
+    stats->host_us = (double)(end - start) * 1e6 / CLOCKS_PER_SEC / SLIDE_REPEATS / SLIDE_STEPS;
+}
+
+// =============================================================================
+// Graphics State Changes
+// =============================================================================
+
+// Setter calls for what `plan` issues. Batched, the executor's state cache
+// forgets the context where it begins a framebuffer run (incremental frames
+// start with one) and after an image.
+static int list_state_changes(const DisplayList *list, const DisplayListPlan *plan, bool batched) {
+    uint8_t order[DISPLAY_LIST_MAX];
+    int count = 0;
+    if (batched) {
+        count = draw_batch_order(list, plan, true, order);
+    } else {
+        for (int i = 0; i < list->count; i++) {
+            if (display_list_plan_issues(plan, i)) order[count++] = (uint8_t)i;
+        }
+    }
+
+    DrawStateCache cache = { 0 };
+    bool raster = !plan->full;
+    for (int n = 0; n < count; n++) {
+        const DlPrim *prim = &list->prims[order[n]];
+        DrawState state = draw_state_for(prim, true);
+        bool run = state.kind == DRAW_STATE_RASTER;
+        if (!batched || (run && !raster) || prim->type == DL_IMAGE) draw_state_reset(&cache);
+        raster = run;
+        draw_state_apply(&cache, state);
+    }
+    return cache.changes;
+}
+
+// Setter calls for the SDK fallback drawing a grid as `next` has it: every
+// cell, or with `prev` the cells that changed, each cleared first
+static int grid_state_changes(const GridState *grid, const GridBitset *next, const GridBitset *prev,
+                              bool batched) {
+    static const uint8_t background = 0xC0, primary = 0xCB, secondary = 0xD5;
+    int cells = grid->layout.cols * grid->layout.rows;
+    DrawStateCache cache = { 0 };
+    for (int pass = 0; pass < (batched ? 3 : 1); pass++) {
+        for (int cell = 0; cell < cells; cell++) {
+            bool filled = grid_bitset_test(next, cell);
+            if (prev && filled == grid_bitset_test(prev, cell)) continue;
+            if (!batched) {
+                draw_state_reset(&cache);
+                if (prev) draw_state_fill(&cache, background);
+                if (filled) draw_state_fill(&cache, primary);
+                else draw_state_apply(&cache, (DrawState){ DRAW_STATE_STROKE, secondary, 1 });
+            } else if (pass == 0) {
+                if (prev) draw_state_fill(&cache, background);
+            } else if (pass == 1 && filled) {
+                draw_state_fill(&cache, primary);
+            } else if (pass == 2 && !filled) {
+                draw_state_apply(&cache, (DrawState){ DRAW_STATE_STROKE, secondary, 1 });
+            }
+        }
+    }
+    return cache.changes;
+}
+
+static void grid_states(int m, StateStats *stats) {
+    static GridState grid;
+    GridSpec spec = grid_spec_scaled(s_grid_modes[m].cols, s_grid_modes[m].rows, s_grid_modes[m].order,
+                                     GRID_DENSITY_NORMAL);
+    grid_state_configure(&grid, &spec, BENCH_WIDTH, BENCH_HEIGHT);
+    int cells = grid.layout.cols * grid.layout.rows;
+    *stats = (StateStats){ { 0 }, { 0 } };
+
+    GridBitset prev, next;
+    for (int remaining = BENCH_TOTAL_SECONDS; remaining >= 0; remaining--) {
+        grid_state_bitset_for(&grid, progress_calculate_blocks(remaining, BENCH_TOTAL_SECONDS, cells), &next);
+        for (int b = 0; b < 2; b++) {
+            if (remaining == BENCH_TOTAL_SECONDS / 2) {
+                stats->full[b] = grid_state_changes(&grid, &next, NULL, b);
+            }
+            if (remaining < BENCH_TOTAL_SECONDS) {
+                stats->incremental[b] += (double)grid_state_changes(&grid, &next, &prev, b) / BENCH_TOTAL_SECONDS;
+            }
+        }
+        prev = next;
+    }
+}
+
+// As matrix_cell_shade in display_modes.c: 0-2 brightest first, or -1 when dark
+static int matrix_shade(int drop_row, int row) {
+    int dist = drop_row - row;
+    if (dist < 0) dist += MATRIX_ROWS + 5;
+    if (dist == 0) return 0;
+    if (dist <= 2) return 1;
+    if (dist <= 6) return 2;
+    return -1;
+}
+
+static void matrix_states(StateStats *stats) {
+    static MatrixState matrix;
+    animation_init_matrix(&matrix, 1);
+    int frames = BENCH_TOTAL_SECONDS;
+    double before = 0, after = 0;
+    for (int frame = 0; frame < frames; frame++) {
+        animation_step_matrix(&matrix);
+        bool shown[3] = { false, false, false };
+        for (int col = 0; col < MATRIX_COLS; col++) {
+            int drop_row = animation_matrix_drop_row(&matrix, col, 0);
+            for (int row = 0; row < MATRIX_ROWS; row++) {
+                int shade = matrix_shade(drop_row, row);
+                if (shade < 0) continue;
+                before++;
+                shown[shade] = true;
+            }
+        }
+        after += shown[0] + shown[1] + shown[2];
+    }
+    stats->full[0] = stats->incremental[0] = before / frames;
+    stats->full[1] = stats->incremental[1] = after / frames;
+}
+
+static void print_states(const char *name, const StateStats *stats) {
+    printf("%-10s %7.1f %7.1f %7.1f %7.1f\n", name, stats->full[0], stats->full[1],
+           stats->incremental[0], stats->incremental[1]);
+}
+
+int main(void) {
+    DisplayInput in = {
+        .width = BENCH_WIDTH, .height = BENCH_HEIGHT,
+        .total_seconds = BENCH_TOTAL_SECONDS, .running = true, .vector_art = true,
+        .background = 0xC0, .primary = 0xCB, .secondary = 0xD5, .accent = 0xF0,
+        .hint = 0xEA
+    };
+    int32_t screen = BENCH_WIDTH * BENCH_HEIGHT;
+
+    printf("\nDisplay list benchmark (%dx%d, %d s countdown, per incremental frame)\n\n",
+           BENCH_WIDTH, BENCH_HEIGHT, BENCH_TOTAL_SECONDS);
+    printf("%-10s %6s %6s %8s %8s %9s %9s\n", "mode", "prims", "calls", "repaint", "damaged", "overdraw", "host");
+    printf("%-10s %6s %6s %8s %8s %9s %9s\n", "----------", "-----", "-----", "-------", "-------", "--------",
+           "-------");
+
+    for (size_t m = 0; m < sizeof(s_modes) / sizeof(s_modes[0]); m++) {
+        long prims = 0, calls = 0, repaints = 0;
+        double damaged = 0, drawn = 0;
+        int frames = 0;
+
+        display_list_history_invalidate(&s_history);
+        clock_t start = clock();
+        for (int remaining = BENCH_TOTAL_SECONDS; remaining >= 0; remaining--) {
+            in.remaining_seconds = remaining;
+            if (remaining == BENCH_TOTAL_SECONDS) sand_init(&s_sand, 0);
+            sand_set_target(&s_sand, (BENCH_TOTAL_SECONDS - remaining) * SAND_GRAINS / BENCH_TOTAL_SECONDS);
+            for (int step = 0; step < 20; step++) sand_step(&s_sand);
+            in.sand = s_sand.rows;
+
+            display_emit(&s_list, s_modes[m].mode, &in);
+            bool first = remaining == BENCH_TOTAL_SECONDS;
+            display_list_plan(&s_history, &s_list, BENCH_WIDTH, BENCH_HEIGHT, first, &s_plan);
+            if (first) continue;
+
+            prims += s_plan.stats.primitives;
+            calls += s_plan.stats.draw_calls;
+            repaints += s_plan.stats.repainted;
+            damaged += s_plan.stats.damaged_area;
+            drawn += s_plan.stats.drawn_area;
+            frames++;
+        }
+        clock_t end = clock();
+        double host_us = (double)(end - start) * 1e6 / CLOCKS_PER_SEC / (frames + 1);
+
+        printf("%-10s %6.1f %6.1f %8.1f %7.1f%% %8.2fx %6.1f us\n", s_modes[m].name,
+               (double)prims / frames, (double)calls / frames, (double)repaints / frames,
+               100.0 * damaged / frames / screen, damaged > 0 ? drawn / damaged : 0.0, host_us);
+    }
+
+    printf("\nQuick View slide (%d to %d px in %d steps, per step)\n\n", BENCH_HEIGHT, PEEK_HEIGHT, SLIDE_STEPS);
+    printf("%-10s %15s %15s %15s\n", "", "calls", "damaged", "host");
+    printf("%-10s %7s %7s %7s %7s %7s %7s\n", "mode", "layout", "reflow", "layout", "reflow", "layout", "reflow");
+    printf("%-10s %7s %7s %7s %7s %7s %7s\n", "----------", "------", "------", "------", "------", "------",
+           "------");
+    in.remaining_seconds = BENCH_TOTAL_SECONDS / 3;
+    in.sand = s_sand.rows;
+    int32_t peek_screen = BENCH_WIDTH * PEEK_HEIGHT;
+    for (size_t m = 0; m < sizeof(s_modes) / sizeof(s_modes[0]); m++) {
+        SlideStats relayout, reflow;
+        slide(s_modes[m].mode, in, false, &relayout);
+        slide(s_modes[m].mode, in, true, &reflow);
+        printf("%-10s %7.1f %7.1f %6.0f%% %6.0f%% %4.1f us %4.1f us\n", s_modes[m].name,
+               (double)relayout.calls / SLIDE_STEPS, (double)reflow.calls / SLIDE_STEPS,
+               100.0 * relayout.damaged / SLIDE_STEPS / peek_screen,
+               100.0 * reflow.damaged / SLIDE_STEPS / peek_screen, relayout.host_us, reflow.host_us);
+    }
+
+    printf("\nDashboard (%d tiles against the full screen, per second)\n\n", DISPLAY_TILE_MAX);
+    printf("%-10s %15s %15s %17s\n", "", "calls", "damaged", "host");
+    printf("%-10s %7s %7s %7s %7s %8s %8s\n", "mode", "screen", "tiles", "screen", "tiles", "screen", "tiles");
+    printf("%-10s %7s %7s %7s %7s %8s %8s\n", "----------", "------", "------", "------", "------", "-------",
+           "-------");
+    for (size_t m = 0; m < sizeof(s_modes) / sizeof(s_modes[0]); m++) {
+        SlideStats full, tiled;
+        dashboard_second(s_modes[m].mode, in, false, &full);
+        dashboard_second(s_modes[m].mode, in, true, &tiled);
+        printf("%-10s %7.1f %7.1f %6.1f%% %6.1f%% %5.1f us %5.1f us\n", s_modes[m].name,
+               (double)full.calls / BENCH_TOTAL_SECONDS, (double)tiled.calls / BENCH_TOTAL_SECONDS,
+               100.0 * full.damaged / BENCH_TOTAL_SECONDS / screen,
+               100.0 * tiled.damaged / BENCH_TOTAL_SECONDS / screen, full.host_us, tiled.host_us);
+    }
+
+    printf("\nGraphics state changes (context setter calls per frame)\n\n");
+    printf("%-10s %15s %15s\n", "", "full frame", "incremental");
+    printf("%-10s %7s %7s %7s %7s\n", "mode", "before", "after", "before", "after");
+    printf("%-10s %7s %7s %7s %7s\n", "----------", "------", "------", "------", "------");
+    for (size_t m = 0; m < sizeof(s_grid_modes) / sizeof(s_grid_modes[0]); m++) {
+        StateStats stats;
+        grid_states((int)m, &stats);
+        print_states(s_grid_modes[m].name, &stats);
+    }
+    StateStats matrix;
+    matrix_states(&matrix);
+    print_states("matrix", &matrix);
+    for (size_t m = 0; m < sizeof(s_modes) / sizeof(s_modes[0]); m++) {
+        StateStats stats = { { 0 }, { 0 } };
+        display_list_history_invalidate(&s_history);
+        sand_init(&s_sand, 0);
+        for (int remaining = BENCH_TOTAL_SECONDS; remaining >= 0; remaining--) {
+            in.remaining_seconds = remaining;
+            sand_set_target(&s_sand, (BENCH_TOTAL_SECONDS - remaining) * SAND_GRAINS / BENCH_TOTAL_SECONDS);
+            for (int step = 0; step < 20; step++) sand_step(&s_sand);
+            in.sand = s_sand.rows;
+            display_emit(&s_list, s_modes[m].mode, &in);
+
+            bool first = remaining == BENCH_TOTAL_SECONDS;
+            display_list_plan(&s_history, &s_list, BENCH_WIDTH, BENCH_HEIGHT, first, &s_plan);
+            for (int b = 0; b < 2 && !first; b++) {
+                stats.incremental[b] += (double)list_state_changes(&s_list, &s_plan, b) / BENCH_TOTAL_SECONDS;
+            }
+            if (remaining == BENCH_TOTAL_SECONDS / 2) {
+                static DisplayListHistory fresh;
+                display_list_history_invalidate(&fresh);
+                display_list_plan(&fresh, &s_list, BENCH_WIDTH, BENCH_HEIGHT, true, &s_plan);
+                for (int b = 0; b < 2; b++) {
+                    stats.full[b] = list_state_changes(&s_list, &s_plan, b);
+                }
+            }
+        }
+        print_states(s_modes[m].name, &stats);
+    }
+    printf("\n");
+    return 0;
+}
@@ -0,0 +1,172 @@
+// =============================================================================
+// Raster Backend Benchmark
+// =============================================================================
+// Renders a representative rectangle-heavy frame (a full Blocks grid, the
+// Water Level fill and three progress bars) on every platform's framebuffer
+// format, once with the pixel-at-a-time reference path and once with the
+// word-wide raster kernels, and reports the time per frame.
+//
+// A second table does the same for the Ring and Radial progress arcs: the
+// dots they used to be drawn with (one filled circle every 3 or 4 degrees)
+// against one annulus sector per band.
+//
+// The Makefile builds one binary per kernel variant and passes its name as
+// the only argument; depth-specialized variants skip the other depth.
+//
+// Usage: make bench
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "raster_reference.h"
+#include "../src/c/display/grid.h"
+#include "../src/c/display/display_list.h"
+
+#define BENCH_FRAMES 2000
+
+typedef void (*FillRoundRectFn)(const RasterTarget *, int, int, int, int, int, uint8_t);
+
+static uint32_t s_buffer[(200 * 228) / 4];
+static GridState s_grid;
+
+static void render_frame(const RasterTarget *target, FillRoundRectFn fill_round_rect, int frame) {
+    const GridLayout *layout = &s_grid.layout;
+    int total = layout->cols * layout->rows;
+    int filled = total - (frame % total);
+
+    fill_round_rect(target, 0, 0, target->width, target->height, 0, 0xC0);
+
+    // Blocks grid
+    for (int rank = 0; rank < total; rank++) {
+        int x, y;
+        grid_cell_origin(layout, s_grid.cell_for_rank[rank], &x, &y);
+        uint8_t color = (rank < filled) ? 0xCB : 0xD5;
+        fill_round_rect(target, x, y, layout->cell_size, layout->cell_size, 2, color);
+    }
+
+    // Water Level fill and progress bars
+    int bar_width = target->width - 40;
+    fill_round_rect(target, target->width / 2 - 24, 40, 48, 80, 0, 0xCB);
+    fill_round_rect(target, 20, target->height - 30, bar_width, 10, 3, 0xD5);
+    fill_round_rect(target, 20, target->height - 30, bar_width * filled / total, 10, 3, 0xE3);
+    fill_round_rect(target, 20, target->height - 8, bar_width, 3, 1, 0xC4);
+}
+
+// Ring mode's band plus the Radial mode's three, sized to the screen like
+// the emitters do, with the sweep advancing every frame
+typedef struct {
+    int cx, cy, radius, half;
+    int step_degrees;   // Dot spacing of the per-dot path
+} ArcBand;
+
+static int arc_bands(const RasterTarget *target, ArcBand *bands) {
+    int min_dim = target->width < target->height ? target->width : target->height;
+    int cx = target->width / 2;
+    int cy = target->height / 2;
+    bands[0] = (ArcBand){ cx, cy, min_dim / 2 - 15, 5, 3 };
+    for (int ring = 0; ring < 3; ring++) {
+        bands[1 + ring] = (ArcBand){ cx, cy, min_dim / 2 - 20 - ring * 14, 3, 4 };
+    }
+    return 4;
+}
+
+static void render_arcs_dots(const RasterTarget *target, int frame) {
+    ArcBand bands[4];
+    int count = arc_bands(target, bands);
+    int sweep = frame % 361;
+
+    raster_fill_rect(target, 0, 0, target->width, target->height, 0xC0);
+    for (int i = 0; i < count; i++) {
+        const ArcBand *b = &bands[i];
+        for (int deg = 0; deg < sweep; deg += b->step_degrees) {
+            int32_t angle = (int32_t)(deg - 90) * DL_ANGLE_MAX / 360;
+            raster_reference_fill_circle(target, b->cx + dl_cos(angle) * b->radius / DL_TRIG_ONE,
+                                         b->cy + dl_sin(angle) * b->radius / DL_TRIG_ONE, b->half, 0xFF);
+        }
+    }
+}
+
+static void render_arcs_sectors(const RasterTarget *target, int frame) {
+    ArcBand bands[4];
+    int count = arc_bands(target, bands);
+    int sweep = frame % 361;
+    int32_t angle = (int32_t)sweep * DL_ANGLE_MAX / 360;
+    int32_t end_x = sweep >= 360 ? 0 : dl_sin(angle);
+    int32_t end_y = sweep >= 360 ? 0 : -dl_cos(angle);
+
+    raster_fill_rect(target, 0, 0, target->width, target->height, 0xC0);
+    if (sweep == 0) return;
+    for (int i = 0; i < count; i++) {
+        const ArcBand *b = &bands[i];
+        raster_fill_annulus_sector(target, b->cx, b->cy, b->radius - b->half, b->radius + b->half + 1,
+                                   end_x, end_y, 0xFF);
+    }
+}
+
+static double bench_arcs(const RasterTarget *target, void (*render)(const RasterTarget *, int)) {
+    clock_t start = clock();
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        render(target, frame);
+    }
+    clock_t end = clock();
+    return (double)(end - start) * 1e6 / CLOCKS_PER_SEC / BENCH_FRAMES;
+}
+
+static double bench_path(const RasterTarget *target, FillRoundRectFn fill_round_rect) {
+    clock_t start = clock();
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        render_frame(target, fill_round_rect, frame);
+    }
+    clock_t end = clock();
+    return (double)(end - start) * 1e6 / CLOCKS_PER_SEC / BENCH_FRAMES;
+}
+
+int main(int argc, char **argv) {
+    const char *variant = (argc > 1) ? argv[1] : "generic";
+    printf("\nRaster backend benchmark, %s kernels (%d frames per path)\n", variant, BENCH_FRAMES);
+    printf("Reference = pixel-at-a-time stand-in for the SDK path\n\n");
+    printf("%-8s %-12s %12s %12s %8s\n", "platform", "format", "reference", "raster", "speedup");
+    printf("%-8s %-12s %12s %12s %8s\n", "--------", "------------", "----------", "----------", "-------");
+
+    for (int i = 0; i < RASTER_PLATFORM_COUNT; i++) {
+        const RasterPlatform *platform = &g_raster_platforms[i];
+        if (!raster_format_supported(platform->format)) continue;
+
+        RasterTarget target;
+        memset(s_buffer, 0, sizeof(s_buffer));
+        raster_platform_target(&target, platform, (uint8_t *)s_buffer);
+
+        GridSpec spec = grid_spec_scaled(12, 8, grid_order_rows, GRID_DENSITY_NORMAL);
+        grid_state_configure(&s_grid, &spec, platform->width, platform->height);
+
+        double reference_us = bench_path(&target, raster_reference_fill_round_rect);
+        double raster_us = bench_path(&target, raster_fill_round_rect);
+
+        const char *format = platform->format == RASTER_FORMAT_1BIT ? "1-bit" :
+                             platform->round ? "8-bit round" : "8-bit";
+        printf("%-8s %-12s %9.1f us %9.1f us %7.1fx\n", platform->name, format,
+               reference_us, raster_us, reference_us / raster_us);
+    }
+
+    printf("\nProgress arcs: per-dot circles vs annulus sectors\n\n");
+    printf("%-8s %-12s %12s %12s %8s\n", "platform", "format", "dots", "sectors", "speedup");
+    printf("%-8s %-12s %12s %12s %8s\n", "--------", "------------", "----------", "----------", "-------");
+    for (int i = 0; i < RASTER_PLATFORM_COUNT; i++) {
+        const RasterPlatform *platform = &g_raster_platforms[i];
+        if (!raster_format_supported(platform->format)) continue;
+
+        RasterTarget target;
+        memset(s_buffer, 0, sizeof(s_buffer));
+        raster_platform_target(&target, platform, (uint8_t *)s_buffer);
+
+        double dots_us = bench_arcs(&target, render_arcs_dots);
+        double sectors_us = bench_arcs(&target, render_arcs_sectors);
+
+        const char *format = platform->format == RASTER_FORMAT_1BIT ? "1-bit" :
+                             platform->round ? "8-bit round" : "8-bit";
+        printf("%-8s %-12s %9.1f us %9.1f us %7.1fx\n", platform->name, format,
+               dots_us, sectors_us, dots_us / sectors_us);
+    }
+    printf("\n");
+    return 0;
+}
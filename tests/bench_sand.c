@@ -0,0 +1,85 @@
+// =============================================================================
+// Falling Sand Benchmark
+// =============================================================================
+// Steps the hourglass automaton through back-to-back countdowns and reports
+// host steps per second for a settled glass (the idle floor), a draining one
+// (the steady state) and a worst case where every grain is airborne. A step
+// costs the same shift/mask work per row whatever the grains are doing, so
+// the three should be close; the animation runs 20 steps per second.
+//
+// Usage: make bench
+
+#include <stdio.h>
+#include <time.h>
+#include "../src/c/sand.h"
+
+#define BENCH_STEPS 2000000
+
+static SandGrid s_grid;
+
+typedef enum {
+    SCENARIO_SETTLED,
+    SCENARIO_DRAINING,
+    SCENARIO_AIRBORNE
+} Scenario;
+
+static void scatter(SandGrid *grid) {
+    sand_init(grid, 0);
+    for (int row = 0; row < SAND_ROWS; row++) {
+        grid->rows[row] = 0;
+    }
+    // Alternate rows of alternate cells across both chambers
+    int placed = 0;
+    for (int row = 0; row < SAND_ROWS && placed < SAND_GRAINS; row += 2) {
+        SandRow bits = 0x5555 & sand_row_mask(row);
+        grid->rows[row] = bits;
+        placed += __builtin_popcount(bits);
+    }
+}
+
+static double run(Scenario scenario, uint32_t *checksum) {
+    switch (scenario) {
+        case SCENARIO_SETTLED:  sand_init(&s_grid, SAND_GRAINS / 2); break;
+        case SCENARIO_DRAINING: sand_init(&s_grid, 0); break;
+        case SCENARIO_AIRBORNE: scatter(&s_grid); break;
+    }
+
+    clock_t start = clock();
+    for (long step = 0; step < BENCH_STEPS; step++) {
+        if (scenario == SCENARIO_DRAINING) {
+            // One grain per 10 steps, refilling when the glass runs out
+            if (s_grid.released == SAND_GRAINS) sand_init(&s_grid, 0);
+            sand_set_target(&s_grid, s_grid.released + (step % 10 == 0));
+        } else if (scenario == SCENARIO_AIRBORNE && step % 64 == 0) {
+            scatter(&s_grid);
+        }
+        sand_step(&s_grid);
+        *checksum += s_grid.rows[step % SAND_ROWS];
+    }
+    clock_t end = clock();
+    return (double)(end - start) / CLOCKS_PER_SEC;
+}
+
+int main(void) {
+    static const struct {
+        Scenario scenario;
+        const char *name;
+    } scenarios[] = {
+        { SCENARIO_SETTLED, "settled" },
+        { SCENARIO_DRAINING, "draining" },
+        { SCENARIO_AIRBORNE, "airborne" },
+    };
+    uint32_t checksum = 0;
+
+    printf("\nFalling sand benchmark (%dx%d grid, %d grains, %d steps)\n\n",
+           SAND_COLS, SAND_ROWS, SAND_GRAINS, BENCH_STEPS);
+    printf("%-10s %14s %10s\n", "scenario", "steps/s", "ns/step");
+    printf("%-10s %14s %10s\n", "----------", "-------------", "---------");
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        double seconds = run(scenarios[i].scenario, &checksum);
+        printf("%-10s %14.0f %10.1f\n", scenarios[i].name,
+               BENCH_STEPS / seconds, seconds * 1e9 / BENCH_STEPS);
+    }
+    printf("\n(checksum %u)\n\n", checksum);
+    return 0;
+}
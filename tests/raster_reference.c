@@ -0,0 +1,138 @@
+#include "raster_reference.h"
+
+// =============================================================================
+// Platform Framebuffer Formats
+// =============================================================================
+
+const RasterPlatform g_raster_platforms[RASTER_PLATFORM_COUNT] = {
+    [RASTER_PLATFORM_APLITE]  = { "aplite",  144, 168,  20, RASTER_FORMAT_1BIT, false },
+    [RASTER_PLATFORM_BASALT]  = { "basalt",  144, 168, 144, RASTER_FORMAT_8BIT, false },
+    [RASTER_PLATFORM_CHALK]   = { "chalk",   180, 180, 180, RASTER_FORMAT_8BIT, true  },
+    [RASTER_PLATFORM_DIORITE] = { "diorite", 144, 168,  20, RASTER_FORMAT_1BIT, false },
+    [RASTER_PLATFORM_EMERY]   = { "emery",   200, 228, 200, RASTER_FORMAT_8BIT, false },
+    [RASTER_PLATFORM_FLINT]   = { "flint",   144, 168,  20, RASTER_FORMAT_1BIT, false },
+};
+
+// Chalk packs only the visible span of each row, back to back
+#define ROUND_SIZE 180
+static int s_round_offset[ROUND_SIZE];
+static int16_t s_round_min_x[ROUND_SIZE];
+static int16_t s_round_max_x[ROUND_SIZE];
+static bool s_round_ready = false;
+
+static void round_layout_init(void) {
+    if (s_round_ready) return;
+    s_round_ready = true;
+
+    int offset = 0;
+    int r2 = (ROUND_SIZE / 2) * (ROUND_SIZE / 2) * 4;
+    for (int y = 0; y < ROUND_SIZE; y++) {
+        int dy = 2 * y + 1 - ROUND_SIZE;
+        int half = 0;
+        while ((2 * half + 2) * (2 * half + 2) + dy * dy <= r2) half++;
+        s_round_min_x[y] = (int16_t)(ROUND_SIZE / 2 - half - 1);
+        s_round_max_x[y] = (int16_t)(ROUND_SIZE / 2 + half);
+        s_round_offset[y] = offset - s_round_min_x[y];
+        offset += s_round_max_x[y] - s_round_min_x[y] + 1;
+    }
+}
+
+static RasterRow round_row(void *context, int y) {
+    RasterRow row = {
+        .data = (uint8_t *)context + s_round_offset[y],
+        .min_x = s_round_min_x[y],
+        .max_x = s_round_max_x[y]
+    };
+    return row;
+}
+
+void raster_platform_target(RasterTarget *target, const RasterPlatform *platform, uint8_t *buffer) {
+    raster_target_init(target, buffer, platform->stride, platform->width, platform->height, platform->format);
+    if (platform->round) {
+        round_layout_init();
+        target->row_fn = round_row;
+        target->row_context = buffer;
+    }
+}
+
+// =============================================================================
+// Reference Renderer
+// =============================================================================
+
+static void reference_set_pixel(const RasterTarget *target, int x, int y, uint8_t argb) {
+    if (y < 0 || y >= target->height) return;
+    RasterRow row = raster_target_row(target, y);
+    if (x < row.min_x || x > row.max_x) return;
+
+    uint8_t pixel = raster_pixel_for(target, argb);
+    if (target->format == RASTER_FORMAT_8BIT) {
+        row.data[x] = pixel;
+    } else if (pixel) {
+        row.data[x >> 3] |= (uint8_t)(1u << (x & 7));
+    } else {
+        row.data[x >> 3] &= (uint8_t)~(1u << (x & 7));
+    }
+}
+
+void raster_reference_fill_rect(const RasterTarget *target, int x, int y, int w, int h, uint8_t argb) {
+    for (int py = y; py < y + h; py++) {
+        for (int px = x; px < x + w; px++) {
+            reference_set_pixel(target, px, py, argb);
+        }
+    }
+}
+
+// A corner pixel is inside when its center lies within the corner circle
+static bool reference_in_corner(int radius, int col, int row) {
+    if (col >= radius || row >= radius) return true;
+    int ddx = 2 * radius - 2 * col - 1;
+    int ddy = 2 * radius - 2 * row - 1;
+    return ddx * ddx + ddy * ddy <= 4 * radius * radius;
+}
+
+void raster_reference_fill_round_rect(const RasterTarget *target, int x, int y, int w, int h, int radius, uint8_t argb) {
+    if (w <= 0 || h <= 0) return;
+    int max_radius = ((w < h) ? w : h) / 2;
+    if (radius > max_radius) radius = max_radius;
+
+    for (int r = 0; r < h; r++) {
+        int row = (r < h - 1 - r) ? r : h - 1 - r;
+        for (int c = 0; c < w; c++) {
+            int col = (c < w - 1 - c) ? c : w - 1 - c;
+            if (reference_in_corner(radius, col, row)) {
+                reference_set_pixel(target, x + c, y + r, argb);
+            }
+        }
+    }
+}
+
+void raster_reference_fill_circle(const RasterTarget *target, int cx, int cy, int radius, uint8_t argb) {
+    for (int dy = -radius; dy <= radius; dy++) {
+        for (int dx = -radius; dx <= radius; dx++) {
+            if (dx * dx + dy * dy <= radius * radius + radius) {
+                reference_set_pixel(target, cx + dx, cy + dy, argb);
+            }
+        }
+    }
+}
+
+// Clockwise from 12 o'clock up to the end direction, tested per pixel
+static bool reference_in_sector(int dx, int dy, int32_t end_x, int32_t end_y) {
+    if (end_x == 0 && end_y <= 0) return true;
+    bool right = dx >= 0;
+    bool before_end = (int64_t)dx * end_y - (int64_t)dy * end_x >= 0;
+    bool within_half = end_x > 0 || (end_x == 0 && end_y > 0);
+    return within_half ? (right && before_end) : (right || before_end);
+}
+
+void raster_reference_fill_annulus_sector(const RasterTarget *target, int cx, int cy, int inner_r, int outer_r,
+                                          int32_t end_x, int32_t end_y, uint8_t argb) {
+    for (int dy = -outer_r; dy <= outer_r; dy++) {
+        for (int dx = -outer_r; dx <= outer_r; dx++) {
+            int32_t d2 = dx * dx + dy * dy;
+            if (d2 < outer_r * outer_r && d2 >= inner_r * inner_r && reference_in_sector(dx, dy, end_x, end_y)) {
+                reference_set_pixel(target, cx + dx, cy + dy, argb);
+            }
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// =============================================================================
+// Raster Reference Helpers - Shared by Raster Tests and Benchmarks
+// =============================================================================
+// Describes every platform's framebuffer format and provides a pixel-at-a-time
+// reference renderer that stands in for the SDK's per-primitive path.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "../src/c/display/raster.h"
+
+typedef struct {
+    const char *name;
+    int width;
+    int height;
+    int stride;
+    RasterFormat format;
+    bool round;  // Circular framebuffer with per-row spans (chalk)
+} RasterPlatform;
+
+enum {
+    RASTER_PLATFORM_APLITE,
+    RASTER_PLATFORM_BASALT,
+    RASTER_PLATFORM_CHALK,
+    RASTER_PLATFORM_DIORITE,
+    RASTER_PLATFORM_EMERY,
+    RASTER_PLATFORM_FLINT,
+    RASTER_PLATFORM_COUNT
+};
+
+extern const RasterPlatform g_raster_platforms[RASTER_PLATFORM_COUNT];
+
+// Point a target at `buffer` using the platform's framebuffer layout
+void raster_platform_target(RasterTarget *target, const RasterPlatform *platform, uint8_t *buffer);
+
+// Pixel-at-a-time reference fills
+void raster_reference_fill_rect(const RasterTarget *target, int x, int y, int w, int h, uint8_t argb);
+void raster_reference_fill_round_rect(const RasterTarget *target, int x, int y, int w, int h, int radius, uint8_t argb);
+void raster_reference_fill_circle(const RasterTarget *target, int cx, int cy, int radius, uint8_t argb);
+void raster_reference_fill_annulus_sector(const RasterTarget *target, int cx, int cy, int inner_r, int outer_r,
+                                          int32_t end_x, int32_t end_y, uint8_t argb);
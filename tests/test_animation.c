@@ -0,0 +1,223 @@
+// =============================================================================
+// Animation Engine Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/animation.h"
+#include "../src/c/mode_registry.h"
+
+static AnimationState s_a;
+static AnimationState s_b;
+
+// Start `mode`'s animation the way the app does, at the top of a minute
+static void init_state(AnimationState *anim, DisplayMode mode) {
+    memset(anim, 0, sizeof(*anim));
+    const ModeDescriptor *desc = mode_descriptor(mode);
+    if (desc->activate) {
+        desc->activate(anim, 60, 60);
+    }
+    animation_reset_clock(anim);
+}
+
+// =============================================================================
+// Fixed Timestep Tests
+// =============================================================================
+
+bool test_animation_replay_ignores_frame_timing(void) {
+    init_state(&s_a, DISPLAY_MODE_MATRIX);
+    init_state(&s_b, DISPLAY_MODE_MATRIX);
+
+    // 3 s of matrix rain fed in half-second chunks vs uneven frame times
+    for (int i = 0; i < 6; i++) {
+        animation_advance(&s_a, DISPLAY_MODE_MATRIX, 500);
+    }
+    static const uint32_t frame_times[] = { 7, 33, 16, 51, 2, 90, 16, 16 };
+    uint32_t fed = 0;
+    for (int i = 0; fed < 3000; i++) {
+        uint32_t dt = frame_times[i % 8];
+        if (fed + dt > 3000) dt = 3000 - fed;
+        animation_advance(&s_b, DISPLAY_MODE_MATRIX, dt);
+        fed += dt;
+    }
+
+    TEST_ASSERT_EQUAL(60, (int)s_a.matrix.steps - 60 * ANIM_STEPS_PER_SECOND);
+    TEST_ASSERT_TRUE(memcmp(&s_a.matrix, &s_b.matrix, sizeof(MatrixState)) == 0);
+    TEST_ASSERT_EQUAL(s_a.clock.accumulator_ms, s_b.clock.accumulator_ms);
+    return true;
+}
+
+bool test_animation_stall_drops_backlog(void) {
+    init_state(&s_a, DISPLAY_MODE_MATRIX);
+    init_state(&s_b, DISPLAY_MODE_MATRIX);
+    animation_advance(&s_a, DISPLAY_MODE_MATRIX, 5000 + 20);
+
+    for (int i = 0; i < ANIM_MAX_CATCHUP_STEPS; i++) {
+        animation_step_matrix(&s_b.matrix);
+    }
+    TEST_ASSERT_TRUE(memcmp(&s_a.matrix, &s_b.matrix, sizeof(MatrixState)) == 0);
+    TEST_ASSERT_EQUAL(20, s_a.clock.accumulator_ms);
+    return true;
+}
+
+bool test_animation_frames_follow_mode_rate(void) {
+    init_state(&s_a, DISPLAY_MODE_MATRIX);
+    int frames = 0;
+    for (int i = 0; i < 40; i++) {
+        if (animation_advance(&s_a, DISPLAY_MODE_MATRIX, 25)) frames++;
+    }
+    TEST_ASSERT_EQUAL(10, frames);
+
+    init_state(&s_a, DISPLAY_MODE_HOURGLASS);
+    frames = 0;
+    for (int i = 0; i < 40; i++) {
+        if (animation_advance(&s_a, DISPLAY_MODE_HOURGLASS, 25)) frames++;
+    }
+    TEST_ASSERT_EQUAL(20, frames);
+    return true;
+}
+
+bool test_animation_still_modes_never_step(void) {
+    init_state(&s_a, DISPLAY_MODE_CLOCK);
+    init_state(&s_b, DISPLAY_MODE_CLOCK);
+    TEST_ASSERT_FALSE(animation_advance(&s_a, DISPLAY_MODE_CLOCK, 1000));
+    TEST_ASSERT_TRUE(memcmp(&s_a, &s_b, sizeof(AnimationState)) == 0);
+
+    TEST_ASSERT_FALSE(animation_is_active(&s_a, DISPLAY_MODE_BLOCKS, true));
+    init_state(&s_a, DISPLAY_MODE_MATRIX);
+    TEST_ASSERT_FALSE(animation_is_active(&s_a, DISPLAY_MODE_MATRIX, false));
+    TEST_ASSERT_TRUE(animation_is_active(&s_a, DISPLAY_MODE_MATRIX, true));
+
+    // The hourglass only moves while sand is due through the neck or still falling
+    init_state(&s_a, DISPLAY_MODE_HOURGLASS);
+    TEST_ASSERT_FALSE(animation_is_active(&s_a, DISPLAY_MODE_HOURGLASS, true));
+    animation_sync_hourglass(&s_a.hourglass, 59, 60);
+    TEST_ASSERT_TRUE(animation_is_active(&s_a, DISPLAY_MODE_HOURGLASS, true));
+    return true;
+}
+
+bool test_animation_water_moves_while_paused(void) {
+    init_state(&s_a, DISPLAY_MODE_WATER_LEVEL);
+    TEST_ASSERT_FALSE(animation_is_active(&s_a, DISPLAY_MODE_WATER_LEVEL, true));
+
+    water_set_tilt(&s_a.water.surface, 500);
+    TEST_ASSERT_TRUE(animation_is_active(&s_a, DISPLAY_MODE_WATER_LEVEL, false));
+    for (int i = 0; i < 30; i++) {
+        animation_advance(&s_a, DISPLAY_MODE_WATER_LEVEL, 1000);
+    }
+    TEST_ASSERT_FALSE(animation_is_active(&s_a, DISPLAY_MODE_WATER_LEVEL, false));
+    return true;
+}
+
+// =============================================================================
+// Simulation Tests
+// =============================================================================
+
+bool test_animation_matrix_speed_is_rows_per_second(void) {
+    init_state(&s_a, DISPLAY_MODE_MATRIX);
+    int start = s_a.matrix.drops[2] / MATRIX_SUBROWS;   // speeds[2] == 3
+    for (int i = 0; i < ANIM_STEPS_PER_SECOND; i++) {
+        animation_step_matrix(&s_a.matrix);
+    }
+    TEST_ASSERT_EQUAL((start + 3) % (MATRIX_ROWS + 5), s_a.matrix.drops[2] / MATRIX_SUBROWS);
+
+    // Drawing trails the simulation by one step
+    TEST_ASSERT_EQUAL(start + 2, animation_matrix_drop_row(&s_a.matrix, 2, 0));
+    return true;
+}
+
+bool test_animation_matrix_interpolates_across_wrap(void) {
+    init_state(&s_a, DISPLAY_MODE_MATRIX);
+    s_a.matrix.prev_drops[0] = MATRIX_DROP_PERIOD - 10;
+    s_a.matrix.drops[0] = 10;
+    TEST_ASSERT_EQUAL(MATRIX_ROWS + 4, animation_matrix_drop_row(&s_a.matrix, 0, 0));
+    TEST_ASSERT_EQUAL(0, animation_matrix_drop_row(&s_a.matrix, 0, ANIM_ALPHA_ONE / 2));
+    return true;
+}
+
+bool test_animation_alpha_tracks_banked_time(void) {
+    init_state(&s_a, DISPLAY_MODE_HOURGLASS);
+    animation_advance(&s_a, DISPLAY_MODE_HOURGLASS, ANIM_STEP_MS + ANIM_STEP_MS / 2);
+    TEST_ASSERT_EQUAL(ANIM_ALPHA_ONE / 2, animation_alpha(&s_a));
+    return true;
+}
+
+bool test_animation_sync_releases_with_progress(void) {
+    init_state(&s_a, DISPLAY_MODE_HOURGLASS);
+    SandGrid *sand = &s_a.hourglass.sand;
+    animation_sync_hourglass(&s_a.hourglass, 55, 60);
+    TEST_ASSERT_EQUAL(5, sand->target);
+    TEST_ASSERT_EQUAL(0, sand->released);   // Poured grain by grain, not teleported
+    TEST_ASSERT_TRUE(animation_is_active(&s_a, DISPLAY_MODE_HOURGLASS, true));
+
+    for (int i = 0; i < 2 * ANIM_STEPS_PER_SECOND; i++) {
+        animation_step_hourglass(&s_a.hourglass);
+    }
+    TEST_ASSERT_EQUAL(5, sand->released);
+    TEST_ASSERT_FALSE(animation_is_active(&s_a, DISPLAY_MODE_HOURGLASS, true));
+
+    // Sand never flows back up
+    animation_sync_hourglass(&s_a.hourglass, 58, 60);
+    TEST_ASSERT_EQUAL(5, sand->target);
+
+    // Resuming far into the countdown settles at once
+    animation_sync_hourglass(&s_a.hourglass, 30, 60);
+    TEST_ASSERT_EQUAL(SAND_GRAINS / 2, sand->released);
+    TEST_ASSERT_EQUAL(SAND_GRAINS / 2, sand_count(sand, SAND_CHAMBER_ROWS, SAND_CHAMBER_ROWS));
+    return true;
+}
+
+// =============================================================================
+// Mode Registry Tests
+// =============================================================================
+
+bool test_mode_registry_is_complete(void) {
+    for (int mode = 0; mode < DISPLAY_MODE_COUNT; mode++) {
+        const ModeDescriptor *desc = mode_descriptor((DisplayMode)mode);
+        TEST_ASSERT_TRUE(desc->name != NULL && desc->name[0] != '\0');
+
+        // Animated modes step, start over and say when they next move
+        bool animated = desc->fps > 0;
+        TEST_ASSERT_EQUAL(animated, desc->step != NULL);
+        TEST_ASSERT_EQUAL(animated, desc->activate != NULL);
+        TEST_ASSERT_EQUAL(animated, desc->next_change != NULL);
+    }
+    TEST_ASSERT_EQUAL_STRING("Text", mode_descriptor(DISPLAY_MODE_COUNT)->name);
+    return true;
+}
+
+bool test_mode_registry_activate_catches_up(void) {
+    init_state(&s_a, DISPLAY_MODE_HOURGLASS);
+    const ModeDescriptor *hourglass = mode_descriptor(DISPLAY_MODE_HOURGLASS);
+
+    // Switched to halfway through: the sand is already where it belongs
+    hourglass->activate(&s_a, 30, 60);
+    TEST_ASSERT_EQUAL(SAND_GRAINS / 2, s_a.hourglass.sand.released);
+    TEST_ASSERT_FALSE(animation_is_active(&s_a, DISPLAY_MODE_HOURGLASS, true));
+
+    // The next tick lets one more second's worth through
+    hourglass->update(&s_a, 29, 60);
+    TEST_ASSERT_TRUE(animation_is_active(&s_a, DISPLAY_MODE_HOURGLASS, true));
+    TEST_ASSERT_EQUAL(1000 / animation_mode_fps(DISPLAY_MODE_HOURGLASS),
+                      hourglass->next_change(&s_a, true));
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_animation_tests(void) {
+    TEST_SUITE_BEGIN("Animation Engine");
+    RUN_TEST(test_animation_replay_ignores_frame_timing);
+    RUN_TEST(test_animation_stall_drops_backlog);
+    RUN_TEST(test_animation_frames_follow_mode_rate);
+    RUN_TEST(test_animation_still_modes_never_step);
+    RUN_TEST(test_animation_water_moves_while_paused);
+    RUN_TEST(test_animation_matrix_speed_is_rows_per_second);
+    RUN_TEST(test_animation_matrix_interpolates_across_wrap);
+    RUN_TEST(test_animation_alpha_tracks_banked_time);
+    RUN_TEST(test_animation_sync_releases_with_progress);
+    RUN_TEST(test_mode_registry_is_complete);
+    RUN_TEST(test_mode_registry_activate_catches_up);
+    TEST_SUITE_END();
+}
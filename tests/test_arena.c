@@ -0,0 +1,61 @@
+// =============================================================================
+// Arena Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/arena.h"
+
+static uint32_t s_block[16];   // 64 bytes, aligned
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool test_arena_allocations_are_aligned_and_disjoint(void) {
+    Arena arena;
+    arena_init(&arena, s_block, sizeof(s_block));
+
+    uint8_t *a = arena_alloc(&arena, 3);
+    uint8_t *b = arena_alloc(&arena, 8);
+    TEST_ASSERT_TRUE(a == (uint8_t *)s_block);
+    TEST_ASSERT_TRUE(b == a + ARENA_ALIGN);
+    TEST_ASSERT_EQUAL(0, (int)((uintptr_t)b % ARENA_ALIGN));
+    TEST_ASSERT_EQUAL(12, (int)arena.used);
+    return true;
+}
+
+bool test_arena_refuses_what_does_not_fit(void) {
+    Arena arena;
+    arena_init(&arena, s_block, sizeof(s_block));
+    TEST_ASSERT_TRUE(arena_alloc(&arena, 60) != NULL);
+    TEST_ASSERT_TRUE(arena_alloc(&arena, 4) != NULL);    // Exactly full
+    TEST_ASSERT_TRUE(arena_alloc(&arena, 1) == NULL);
+    TEST_ASSERT_TRUE(arena_alloc(&arena, (size_t)-1) == NULL);
+
+    // No buffer: nothing fits
+    arena_init(&arena, NULL, 64);
+    TEST_ASSERT_TRUE(arena_alloc(&arena, 1) == NULL);
+    return true;
+}
+
+bool test_arena_reset_reuses_and_keeps_peak(void) {
+    Arena arena;
+    arena_init(&arena, s_block, sizeof(s_block));
+    void *first = arena_alloc(&arena, 40);
+    arena_reset(&arena);
+    TEST_ASSERT_TRUE(arena_alloc(&arena, 8) == first);
+    TEST_ASSERT_EQUAL(40, (int)arena.peak);
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_arena_tests(void) {
+    TEST_SUITE_BEGIN("Arena");
+    RUN_TEST(test_arena_allocations_are_aligned_and_disjoint);
+    RUN_TEST(test_arena_refuses_what_does_not_fit);
+    RUN_TEST(test_arena_reset_reuses_and_keeps_peak);
+    TEST_SUITE_END();
+}
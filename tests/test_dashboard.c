@@ -0,0 +1,188 @@
+// =============================================================================
+// Dashboard Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/dashboard.h"
+
+static TimerContext start_timer(DisplayMode mode, int minutes) {
+    TimerContext ctx;
+    timer_context_init(&ctx);
+    ctx.display_mode = mode;
+    timer_start(&ctx, minutes);
+    return ctx;
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool test_dashboard_park_frees_main_screen(void) {
+    Dashboard dashboard;
+    dashboard_init(&dashboard);
+    TimerContext ctx = start_timer(DISPLAY_MODE_CLOCK, 5);
+    ctx.remaining_seconds = 250;
+
+    TimerEffects effects = dashboard_park(&dashboard, &ctx);
+    TEST_ASSERT_EQUAL(1, dashboard.count);
+    TEST_ASSERT_EQUAL(DISPLAY_MODE_CLOCK, dashboard.timers[0].display_mode);
+    TEST_ASSERT_EQUAL(250, dashboard.timers[0].remaining_seconds);
+    TEST_ASSERT_EQUAL(300, dashboard.timers[0].total_seconds);
+    TEST_ASSERT_EQUAL(STATE_SELECT_PRESET, ctx.state);
+    TEST_ASSERT_TRUE(effects.update_display);
+    TEST_ASSERT_TRUE(effects.vibrate_short);
+    TEST_ASSERT_TRUE(dashboard_is_running(&dashboard));
+
+    // Only a running timer parks
+    effects = dashboard_park(&dashboard, &ctx);
+    TEST_ASSERT_EQUAL(1, dashboard.count);
+    TEST_ASSERT_FALSE(effects.update_display);
+    return true;
+}
+
+bool test_dashboard_holds_four_timers(void) {
+    Dashboard dashboard;
+    dashboard_init(&dashboard);
+    for (int i = 0; i < DASHBOARD_MAX_TIMERS + 1; i++) {
+        TimerContext ctx = start_timer(DISPLAY_MODE_RING, i + 1);
+        dashboard_park(&dashboard, &ctx);
+        TEST_ASSERT_EQUAL(i < DASHBOARD_MAX_TIMERS ? STATE_SELECT_PRESET : STATE_RUNNING, ctx.state);
+    }
+    TEST_ASSERT_EQUAL(DASHBOARD_MAX_TIMERS, dashboard.count);
+    TEST_ASSERT_TRUE(dashboard_is_full(&dashboard));
+    return true;
+}
+
+bool test_dashboard_tick_reports_changes(void) {
+    Dashboard dashboard;
+    dashboard_init(&dashboard);
+    TimerContext ctx = start_timer(DISPLAY_MODE_HOURGLASS, 1);
+    ctx.remaining_seconds = 1;
+    dashboard_park(&dashboard, &ctx);
+    ctx = start_timer(DISPLAY_MODE_BLOCKS, 1);
+    dashboard_park(&dashboard, &ctx);
+
+    bool finished;
+    TEST_ASSERT_EQUAL(0x3, dashboard_tick(&dashboard, &finished));
+    TEST_ASSERT_TRUE(finished);
+    TEST_ASSERT_EQUAL(0, dashboard.timers[0].remaining_seconds);
+    TEST_ASSERT_EQUAL(59, dashboard.timers[1].remaining_seconds);
+
+    // A finished timer stays put and stops changing
+    TEST_ASSERT_EQUAL(0x2, dashboard_tick(&dashboard, &finished));
+    TEST_ASSERT_FALSE(finished);
+    TEST_ASSERT_EQUAL(0, dashboard.timers[0].remaining_seconds);
+    return true;
+}
+
+bool test_dashboard_take_resumes_selected(void) {
+    Dashboard dashboard;
+    dashboard_init(&dashboard);
+    TimerContext ctx = start_timer(DISPLAY_MODE_CLOCK, 2);
+    dashboard_park(&dashboard, &ctx);
+    ctx = start_timer(DISPLAY_MODE_WATER_LEVEL, 3);
+    dashboard_park(&dashboard, &ctx);
+
+    dashboard_select_previous(&dashboard);
+    TEST_ASSERT_EQUAL(1, dashboard.selected);
+    TimerEffects effects = dashboard_take(&dashboard, &ctx);
+    TEST_ASSERT_EQUAL(STATE_RUNNING, ctx.state);
+    TEST_ASSERT_EQUAL(DISPLAY_MODE_WATER_LEVEL, ctx.display_mode);
+    TEST_ASSERT_EQUAL(180, ctx.remaining_seconds);
+    TEST_ASSERT_TRUE(effects.subscribe_tick_timer);
+    TEST_ASSERT_TRUE(effects.activate_mode);
+    TEST_ASSERT_TRUE(effects.pop_window);
+    TEST_ASSERT_EQUAL(1, dashboard.count);
+    TEST_ASSERT_EQUAL(0, dashboard.selected);
+
+    // Not while the main screen has a timer of its own
+    effects = dashboard_take(&dashboard, &ctx);
+    TEST_ASSERT_EQUAL(1, dashboard.count);
+    TEST_ASSERT_FALSE(effects.pop_window);
+    return true;
+}
+
+bool test_dashboard_take_drops_finished(void) {
+    Dashboard dashboard;
+    dashboard_init(&dashboard);
+    TimerContext ctx = start_timer(DISPLAY_MODE_CLOCK, 1);
+    ctx.remaining_seconds = 1;
+    dashboard_park(&dashboard, &ctx);
+    bool finished;
+    dashboard_tick(&dashboard, &finished);
+
+    TimerEffects effects = dashboard_take(&dashboard, &ctx);
+    TEST_ASSERT_EQUAL(0, dashboard.count);
+    TEST_ASSERT_EQUAL(STATE_SELECT_PRESET, ctx.state);
+    TEST_ASSERT_FALSE(effects.subscribe_tick_timer);
+    TEST_ASSERT_TRUE(effects.pop_window);
+    TEST_ASSERT_FALSE(dashboard_is_running(&dashboard));
+    return true;
+}
+
+bool test_dashboard_remove_keeps_selection_valid(void) {
+    Dashboard dashboard;
+    dashboard_init(&dashboard);
+    for (int i = 0; i < 3; i++) {
+        TimerContext ctx = start_timer(DISPLAY_MODE_RING, i + 1);
+        dashboard_park(&dashboard, &ctx);
+    }
+    dashboard_select_next(&dashboard);
+    dashboard_remove(&dashboard);
+    TEST_ASSERT_EQUAL(2, dashboard.count);
+    TEST_ASSERT_EQUAL(1, dashboard.selected);
+    TEST_ASSERT_EQUAL(180, dashboard.timers[1].total_seconds);
+
+    dashboard_remove(&dashboard);
+    TEST_ASSERT_EQUAL(0, dashboard.selected);
+    dashboard_remove(&dashboard);
+    dashboard_remove(&dashboard);
+    TEST_ASSERT_EQUAL(0, dashboard.count);
+    dashboard_select_next(&dashboard);
+    TEST_ASSERT_EQUAL(0, dashboard.selected);
+    return true;
+}
+
+bool test_dashboard_tick_stops_when_last_timer_finishes(void) {
+    Dashboard dashboard;
+    dashboard_init(&dashboard);
+    TimerContext ctx = start_timer(DISPLAY_MODE_CLOCK, 1);
+    ctx.remaining_seconds = 2;
+    dashboard_park(&dashboard, &ctx);
+
+    // The main timer paused while a parked one still counts down
+    timer_start(&ctx, 5);
+    timer_pause(&ctx);
+    bool finished;
+    dashboard_tick(&dashboard, &finished);
+    TEST_ASSERT_FALSE(dashboard_tick_effects(&dashboard, &ctx).unsubscribe_tick_timer);
+    dashboard_tick(&dashboard, &finished);
+    TEST_ASSERT_TRUE(finished);
+    TEST_ASSERT_TRUE(dashboard_tick_effects(&dashboard, &ctx).unsubscribe_tick_timer);
+
+    // Likewise completed or asking to exit; resuming subscribes again
+    ctx.state = STATE_COMPLETED;
+    TEST_ASSERT_TRUE(dashboard_tick_effects(&dashboard, &ctx).unsubscribe_tick_timer);
+    ctx.state = STATE_CONFIRM_EXIT;
+    TEST_ASSERT_TRUE(dashboard_tick_effects(&dashboard, &ctx).unsubscribe_tick_timer);
+    TEST_ASSERT_TRUE(timer_handle_back(&ctx).update_display);
+    TEST_ASSERT_TRUE(timer_resume(&ctx).subscribe_tick_timer);
+    TEST_ASSERT_FALSE(dashboard_tick_effects(&dashboard, &ctx).unsubscribe_tick_timer);
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_dashboard_tests(void) {
+    TEST_SUITE_BEGIN("Dashboard");
+    RUN_TEST(test_dashboard_park_frees_main_screen);
+    RUN_TEST(test_dashboard_holds_four_timers);
+    RUN_TEST(test_dashboard_tick_reports_changes);
+    RUN_TEST(test_dashboard_take_resumes_selected);
+    RUN_TEST(test_dashboard_take_drops_finished);
+    RUN_TEST(test_dashboard_remove_keeps_selection_valid);
+    RUN_TEST(test_dashboard_tick_stops_when_last_timer_finishes);
+    TEST_SUITE_END();
+}
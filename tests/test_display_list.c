@@ -0,0 +1,884 @@
+// =============================================================================
+// Display List Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "raster_reference.h"
+#include "../src/c/display/display_list.h"
+#include "../src/c/display/display_emit.h"
+
+static DisplayList s_list;
+static DisplayListHistory s_history;
+static DisplayListPlan s_plan;
+
+static DisplayInput make_input(int remaining, int total) {
+    DisplayInput in = {
+        .width = 144, .height = 168,
+        .remaining_seconds = remaining, .total_seconds = total,
+        .running = true,
+        .background = 0xC0, .primary = 0xFF, .secondary = 0xD5, .accent = 0xF0,
+        .hint = 0xEA
+    };
+    return in;
+}
+
+static int count_type(const DisplayList *list, DlType type) {
+    int n = 0;
+    for (int i = 0; i < list->count; i++) {
+        if (list->prims[i].type == type) n++;
+    }
+    return n;
+}
+
+static const DlPrim *find_text(const DisplayList *list, const char *text) {
+    for (int i = 0; i < list->count; i++) {
+        if (list->prims[i].type == DL_TEXT && strcmp(list->prims[i].text, text) == 0) {
+            return &list->prims[i];
+        }
+    }
+    return NULL;
+}
+
+// =============================================================================
+// Emitting Tests
+// =============================================================================
+
+bool test_display_list_emit_records_fields(void) {
+    display_list_reset(&s_list);
+    dl_fill_rect(&s_list, 1, 2, 30, 40, 3, 0xCC);
+    dl_line(&s_list, 5, 6, 7, 8, 2, 0xF0);
+    dl_text(&s_list, "12:34", DL_FONT_NUMERAL_MEDIUM, 0, 10, 144, 30, DL_ALIGN_CENTER, 0xFF);
+
+    TEST_ASSERT_EQUAL(3, s_list.count);
+    TEST_ASSERT_EQUAL(DL_FILL_RECT, s_list.prims[0].type);
+    TEST_ASSERT_EQUAL(30, s_list.prims[0].rect.w);
+    TEST_ASSERT_EQUAL(3, s_list.prims[0].a);
+    TEST_ASSERT_EQUAL(7, s_list.prims[1].a);
+    TEST_ASSERT_EQUAL(2, s_list.prims[1].c);
+    TEST_ASSERT_EQUAL_STRING("12:34", s_list.prims[2].text);
+    TEST_ASSERT_EQUAL(DL_FONT_NUMERAL_MEDIUM, s_list.prims[2].font);
+    return true;
+}
+
+bool test_display_list_skips_empty_shapes(void) {
+    display_list_reset(&s_list);
+    dl_fill_rect(&s_list, 0, 0, 0, 10, 0, 0xFF);
+    dl_arc(&s_list, 72, 84, 50, 10, 0, 3, DL_ARC_DOTS, 0, 0xFF);
+    TEST_ASSERT_EQUAL(0, s_list.count);
+    return true;
+}
+
+bool test_display_list_overflow_is_flagged(void) {
+    display_list_reset(&s_list);
+    for (int i = 0; i < DISPLAY_LIST_MAX + 3; i++) {
+        dl_fill_circle(&s_list, i, i, 2, 0xFF);
+    }
+    TEST_ASSERT_EQUAL(DISPLAY_LIST_MAX, s_list.count);
+    TEST_ASSERT_TRUE(s_list.overflow);
+
+    display_list_reset(&s_list);
+    TEST_ASSERT_FALSE(s_list.overflow);
+    return true;
+}
+
+bool test_display_list_trig_matches_quadrants(void) {
+    TEST_ASSERT_EQUAL(0, dl_sin(0));
+    TEST_ASSERT_EQUAL(DL_TRIG_ONE, dl_sin(DL_ANGLE_MAX / 4));
+    TEST_ASSERT_EQUAL(0, dl_sin(DL_ANGLE_MAX / 2));
+    TEST_ASSERT_EQUAL(-DL_TRIG_ONE, dl_sin(3 * DL_ANGLE_MAX / 4));
+    TEST_ASSERT_EQUAL(DL_TRIG_ONE, dl_cos(0));
+    TEST_ASSERT_EQUAL(-DL_TRIG_ONE, dl_cos(DL_ANGLE_MAX / 2));
+    TEST_ASSERT_EQUAL(46341, dl_sin(DL_ANGLE_MAX / 8));        // sqrt(2) / 2
+    TEST_ASSERT_EQUAL(-DL_TRIG_ONE, dl_sin(-DL_ANGLE_MAX / 4));  // Wraps negative angles
+    return true;
+}
+
+bool test_display_list_sector_ring_layout(void) {
+    static DlPoint ring[DL_SECTOR_POINTS_MAX];
+    int segments = 4;
+    TEST_ASSERT_TRUE(dl_sector_ring(ring, 72, 84, 40, 10, segments));
+
+    // Boundary 0 is 12 o'clock, boundary 1 is 3 o'clock
+    TEST_ASSERT_EQUAL(84 - 10, ring[segments].y);         // Inner, boundary 0
+    TEST_ASSERT_EQUAL(84 - 40, ring[segments + 1].y);     // Outer, boundary 0
+    TEST_ASSERT_EQUAL(72 + 10, ring[segments - 1].x);     // Inner, boundary 1
+    TEST_ASSERT_EQUAL(72 + 40, ring[segments + 2].x);     // Outer, boundary 1
+
+    // A quarter sector is the run inner 1, inner 0, outer 0, outer 1
+    int first = segments - 1;
+    TEST_ASSERT_EQUAL(72 + 10, ring[first].x);
+    TEST_ASSERT_EQUAL(72 + 40, ring[first + 3].x);
+
+    // The full turn closes on itself
+    TEST_ASSERT_EQUAL(ring[0].y, ring[segments].y);
+    TEST_ASSERT_EQUAL(ring[2 * segments + 1].y, ring[segments + 1].y);
+
+    TEST_ASSERT_FALSE(dl_sector_ring(ring, 72, 84, 40, 10, DL_SECTOR_SEGMENTS_MAX + 1));
+    return true;
+}
+
+// =============================================================================
+// Bounds Tests
+// =============================================================================
+
+bool test_display_list_bounds_cover_strokes(void) {
+    display_list_reset(&s_list);
+    dl_line(&s_list, 20, 10, 10, 30, 3, 0xFF);
+    dl_stroke_circle(&s_list, 50, 50, 10, 4, 0xFF);
+
+    DlRect line = dl_prim_bounds(&s_list.prims[0]);
+    TEST_ASSERT_EQUAL(8, line.x);
+    TEST_ASSERT_EQUAL(8, line.y);
+    TEST_ASSERT_EQUAL(15, line.w);
+    TEST_ASSERT_EQUAL(25, line.h);
+
+    DlRect circle = dl_prim_bounds(&s_list.prims[1]);
+    TEST_ASSERT_EQUAL(37, circle.x);
+    TEST_ASSERT_EQUAL(27, circle.w);
+    return true;
+}
+
+bool test_display_list_ring_touch_ignores_hole(void) {
+    display_list_reset(&s_list);
+    dl_stroke_circle(&s_list, 72, 84, 50, 12, 0xFF);
+    DlRect hole = { 52, 74, 40, 20 };
+    DlRect band = { 0, 74, 144, 20 };
+    DlRect outside = { 0, 0, 10, 10 };
+
+    TEST_ASSERT_FALSE(dl_prim_touches(&s_list.prims[0], hole));
+    TEST_ASSERT_TRUE(dl_prim_touches(&s_list.prims[0], band));
+    TEST_ASSERT_FALSE(dl_prim_touches(&s_list.prims[0], outside));  // Bounding box corner
+    return true;
+}
+
+// =============================================================================
+// Frame Diffing Tests
+// =============================================================================
+
+static void emit_three_boxes(int moving_x) {
+    display_list_reset(&s_list);
+    dl_fill_rect(&s_list, 0, 0, 20, 20, 0, 0xD5);          // Under the mover
+    dl_fill_rect(&s_list, moving_x, 5, 10, 10, 0, 0xFF);
+    dl_fill_rect(&s_list, 100, 100, 20, 20, 0, 0xD5);      // Far away
+}
+
+bool test_display_list_first_frame_is_full(void) {
+    display_list_history_invalidate(&s_history);
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+    TEST_ASSERT_TRUE(s_plan.full);
+    TEST_ASSERT_EQUAL(3, s_plan.stats.draw_calls);
+    TEST_ASSERT_EQUAL(144 * 168, s_plan.stats.damaged_area);
+    TEST_ASSERT_TRUE(s_history.valid);
+    return true;
+}
+
+bool test_display_list_unchanged_frame_issues_nothing(void) {
+    display_list_history_invalidate(&s_history);
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+    TEST_ASSERT_FALSE(s_plan.full);
+    TEST_ASSERT_EQUAL(0, s_plan.stats.changed);
+    TEST_ASSERT_EQUAL(0, s_plan.stats.draw_calls);
+    TEST_ASSERT_EQUAL(0, s_plan.damage_count);
+    return true;
+}
+
+bool test_display_list_change_pulls_in_overlaps(void) {
+    display_list_history_invalidate(&s_history);
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+    emit_three_boxes(8);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+    TEST_ASSERT_EQUAL(1, s_plan.stats.changed);
+    TEST_ASSERT_TRUE(display_list_plan_issues(&s_plan, 0));   // Cleared with the damage
+    TEST_ASSERT_TRUE(display_list_plan_issues(&s_plan, 1));
+    TEST_ASSERT_FALSE(display_list_plan_issues(&s_plan, 2));
+    TEST_ASSERT_EQUAL(2, s_plan.stats.draw_calls);
+    TEST_ASSERT_EQUAL(20 * 20, s_plan.stats.damaged_area);     // The box under it covers both
+    return true;
+}
+
+bool test_display_list_reveal_redraws_what_was_covered(void) {
+    display_list_history_invalidate(&s_history);
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+
+    // Something over the far box went away: it alone is cleared and redrawn
+    DlRect overlay = { 105, 110, 30, 20 };
+    display_list_history_reveal(&s_history, overlay);
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+    TEST_ASSERT_EQUAL(0, s_plan.stats.changed);
+    TEST_ASSERT_EQUAL(1, s_plan.stats.draw_calls);
+    TEST_ASSERT_TRUE(display_list_plan_issues(&s_plan, 2));
+    TEST_ASSERT_TRUE(display_list_plan_touches(&s_plan, &s_list, overlay));
+
+    // Used up by that frame
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+    TEST_ASSERT_EQUAL(0, s_plan.stats.draw_calls);
+    TEST_ASSERT_FALSE(display_list_plan_touches(&s_plan, &s_list, overlay));
+    return true;
+}
+
+bool test_display_list_plan_touches_what_it_draws(void) {
+    DlRect corner = { 0, 0, 8, 8 };
+    DlRect away = { 60, 60, 10, 10 };
+    display_list_history_invalidate(&s_history);
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+    TEST_ASSERT_TRUE(display_list_plan_touches(&s_plan, &s_list, away));   // Full frames touch everything
+    TEST_ASSERT_TRUE(display_list_touches(&s_list, corner));
+    TEST_ASSERT_FALSE(display_list_touches(&s_list, away));
+
+    emit_three_boxes(8);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+    TEST_ASSERT_TRUE(display_list_plan_touches(&s_plan, &s_list, corner));
+    TEST_ASSERT_FALSE(display_list_plan_touches(&s_plan, &s_list, away));
+    return true;
+}
+
+bool test_display_list_insert_does_not_shift_later_prims(void) {
+    display_list_history_invalidate(&s_history);
+    display_list_reset(&s_list);
+    for (int i = 0; i < 6; i++) dl_fill_rect(&s_list, i * 20, 0, 10, 10, 0, 0xFF);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+
+    display_list_reset(&s_list);
+    for (int i = 0; i < 6; i++) {
+        dl_fill_rect(&s_list, i * 20, 0, 10, 10, 0, 0xFF);
+        if (i == 1) dl_fill_rect(&s_list, 30, 50, 5, 5, 0, 0xFF);
+    }
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+    TEST_ASSERT_EQUAL(1, s_plan.stats.changed);
+    TEST_ASSERT_EQUAL(1, s_plan.stats.draw_calls);
+    TEST_ASSERT_EQUAL(25, s_plan.stats.damaged_area);
+    return true;
+}
+
+bool test_display_list_removed_prim_damages_old_bounds(void) {
+    display_list_history_invalidate(&s_history);
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+
+    display_list_reset(&s_list);
+    dl_fill_rect(&s_list, 0, 0, 20, 20, 0, 0xD5);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+    TEST_ASSERT_EQUAL(0, s_plan.stats.changed);
+    TEST_ASSERT_TRUE(s_plan.damage_count >= 1);
+    TEST_ASSERT_TRUE(display_list_plan_issues(&s_plan, 0));
+    return true;
+}
+
+static void emit_gauge_with_label(int sweep) {
+    display_list_reset(&s_list);
+    dl_gauge(&s_list, 72, 84, 40, 8, sweep, 1, 0xD5, 0xFF);
+    dl_fill_circle(&s_list, 72, 84, 10, 0xF0);     // Inside the hole
+    dl_fill_rect(&s_list, 100, 80, 20, 8, 0, 0xC4); // Across the band
+}
+
+bool test_display_list_gauge_repaints_in_place(void) {
+    display_list_history_invalidate(&s_history);
+    emit_gauge_with_label(90);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+
+    emit_gauge_with_label(96);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+    // The gauge covers its old pixels, so nothing is cleared for it, but the
+    // label drawn on it must be redrawn (clearing its own bounds)
+    TEST_ASSERT_EQUAL(1, s_plan.stats.changed);
+    TEST_ASSERT_TRUE(display_list_plan_repaints(&s_plan, 0));
+    TEST_ASSERT_FALSE(display_list_plan_issues(&s_plan, 1));
+    TEST_ASSERT_TRUE(display_list_plan_issues(&s_plan, 2));
+    TEST_ASSERT_FALSE(display_list_plan_repaints(&s_plan, 2));
+    TEST_ASSERT_EQUAL(1, s_plan.damage_count);
+    TEST_ASSERT_EQUAL(100, s_plan.damage[0].x);
+
+    // A gauge that moves is cleared like anything else
+    display_list_reset(&s_list);
+    dl_gauge(&s_list, 70, 84, 40, 8, 96, 1, 0xD5, 0xFF);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+    TEST_ASSERT_FALSE(display_list_plan_repaints(&s_plan, 0));
+    TEST_ASSERT_TRUE(s_plan.damage_count >= 1);
+    return true;
+}
+
+bool test_display_list_overflow_forces_full_frames(void) {
+    display_list_history_invalidate(&s_history);
+    display_list_reset(&s_list);
+    for (int i = 0; i < DISPLAY_LIST_MAX + 1; i++) {
+        dl_fill_circle(&s_list, i, i, 2, 0xFF);
+    }
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+    TEST_ASSERT_TRUE(s_plan.full);
+    TEST_ASSERT_FALSE(s_history.valid);
+
+    emit_three_boxes(5);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+    TEST_ASSERT_TRUE(s_plan.full);
+    return true;
+}
+
+// =============================================================================
+// Emitter Tests
+// =============================================================================
+
+bool test_display_emit_dispatch(void) {
+    DisplayInput in = make_input(90, 300);
+    TEST_ASSERT_TRUE(display_emit(&s_list, DISPLAY_MODE_CLOCK, &in));
+    TEST_ASSERT_TRUE(s_list.count > 0);
+    TEST_ASSERT_FALSE(display_emit(&s_list, DISPLAY_MODE_BLOCKS, &in));
+    TEST_ASSERT_EQUAL(0, s_list.count);
+    TEST_ASSERT_FALSE(display_emit_supports(DISPLAY_MODE_MATRIX));
+    TEST_ASSERT_FALSE(display_emit_supports(DISPLAY_MODE_TEXT));
+    TEST_ASSERT_TRUE(display_emit_supports(DISPLAY_MODE_PERCENT_REMAINING));
+    return true;
+}
+
+bool test_display_emit_clock_geometry(void) {
+    DisplayInput in = make_input(150, 300);
+    display_emit(&s_list, DISPLAY_MODE_CLOCK, &in);
+
+    // Face, 12 ticks, half the fan, center dot, hand
+    TEST_ASSERT_EQUAL(1, count_type(&s_list, DL_STROKE_CIRCLE));
+    TEST_ASSERT_EQUAL(13, count_type(&s_list, DL_LINE));
+    TEST_ASSERT_EQUAL(1, count_type(&s_list, DL_ARC));
+
+    const DlPrim *twelve = &s_list.prims[1];   // First tick points straight up
+    TEST_ASSERT_EQUAL(72, twelve->rect.x);
+    TEST_ASSERT_TRUE(twelve->b < twelve->rect.y);
+
+    const DlPrim *fan = &s_list.prims[13];
+    TEST_ASSERT_EQUAL(DL_ARC_SECTOR, fan->flags);
+    TEST_ASSERT_EQUAL(180, fan->c);
+
+    const DlPrim *hand = &s_list.prims[15];    // Half elapsed: pointing down
+    TEST_ASSERT_EQUAL(72, hand->a);
+    TEST_ASSERT_TRUE(hand->b > hand->rect.y);
+
+    TEST_ASSERT_EQUAL(0, count_type(&s_list, DL_TEXT));   // The time has its own layer
+    return true;
+}
+
+bool test_display_emit_ring_and_radial_are_bands(void) {
+    DisplayInput in = make_input(150, 300);
+    display_emit(&s_list, DISPLAY_MODE_RING, &in);
+
+    // Background ring, one band for the progress, time
+    TEST_ASSERT_EQUAL(1, count_type(&s_list, DL_ARC));
+    const DlPrim *band = &s_list.prims[1];
+    TEST_ASSERT_EQUAL(DL_ARC_BAND, band->flags);
+    TEST_ASSERT_EQUAL(180, band->c);
+    TEST_ASSERT_EQUAL(s_list.prims[0].a + 5, band->a);   // Centered on the ring
+    TEST_ASSERT_EQUAL(10, band->b);
+
+    // Radial: three gauges and no separate background rings
+    display_emit(&s_list, DISPLAY_MODE_RADIAL, &in);
+    for (int i = 0; i < s_list.count; i++) {
+        if (s_list.prims[i].type == DL_ARC) TEST_ASSERT_EQUAL(DL_ARC_BAND, s_list.prims[i].flags);
+    }
+    TEST_ASSERT_EQUAL(3, count_type(&s_list, DL_ARC));
+    TEST_ASSERT_EQUAL(0, count_type(&s_list, DL_STROKE_CIRCLE));
+    TEST_ASSERT_EQUAL(in.secondary, s_list.prims[0].d);
+    return true;
+}
+
+bool test_display_emit_radial_tick_repaints_seconds_ring(void) {
+    DisplayInput in = make_input(3600 + 125, 7200);   // 1:02:05
+    display_list_history_invalidate(&s_history);
+    display_emit(&s_list, DISPLAY_MODE_RADIAL, &in);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+
+    in.remaining_seconds--;
+    display_emit(&s_list, DISPLAY_MODE_RADIAL, &in);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+    // Only the seconds gauge (first in the list), with nothing cleared
+    TEST_ASSERT_FALSE(s_plan.full);
+    TEST_ASSERT_EQUAL(1, s_plan.stats.draw_calls);
+    TEST_ASSERT_EQUAL(1, s_plan.stats.repainted);
+    TEST_ASSERT_TRUE(display_list_plan_repaints(&s_plan, 0));
+    TEST_ASSERT_EQUAL(0, s_plan.damage_count);
+
+    // A minute rollover adds the minutes gauge
+    in.remaining_seconds = 3600 + 120;
+    display_emit(&s_list, DISPLAY_MODE_RADIAL, &in);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+    in.remaining_seconds--;
+    display_emit(&s_list, DISPLAY_MODE_RADIAL, &in);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+    TEST_ASSERT_EQUAL(2, s_plan.stats.repainted);
+    TEST_ASSERT_FALSE(display_list_plan_issues(&s_plan, 2));   // Hours
+    return true;
+}
+
+bool test_display_emit_binary_dots_follow_bits(void) {
+    DisplayInput in = make_input(3600 + 5 * 60 + 7, 7200);  // 1:05:07
+    display_emit(&s_list, DISPLAY_MODE_BINARY, &in);
+
+    // 1 + 2 + 3 bits set out of 18 dots
+    TEST_ASSERT_EQUAL(6, count_type(&s_list, DL_FILL_CIRCLE));
+    TEST_ASSERT_EQUAL(12, count_type(&s_list, DL_STROKE_CIRCLE));
+    TEST_ASSERT_TRUE(find_text(&s_list, "32") != NULL);
+    return true;
+}
+
+bool test_display_emit_time_slots_clear_of_art(void) {
+    static const DisplayMode clear[] = {
+        DISPLAY_MODE_CLOCK, DISPLAY_MODE_HOURGLASS, DISPLAY_MODE_BINARY, DISPLAY_MODE_WATER_LEVEL,
+        DISPLAY_MODE_PERCENT, DISPLAY_MODE_PERCENT_REMAINING
+    };
+    DisplayInput in = make_input(75, 300);
+    DisplayTimeSlot slot;
+
+    // Modes that put the time beside their art keep it off every primitive,
+    // so changing the text never needs the canvas
+    for (size_t m = 0; m < sizeof(clear) / sizeof(clear[0]); m++) {
+        display_emit(&s_list, clear[m], &in);
+        TEST_ASSERT_TRUE(display_emit_time_slot(clear[m], &in, &slot));
+        TEST_ASSERT_TRUE(slot.font >= DL_FONT_NUMERAL_SMALL);
+        TEST_ASSERT_TRUE(slot.rect.y >= 0 && slot.rect.y + slot.rect.h / 2 < in.height);
+        TEST_ASSERT_FALSE(display_list_touches(&s_list, slot.rect));
+    }
+
+    // Ring puts it inside the ring; Hex shows none
+    TEST_ASSERT_TRUE(display_emit_time_slot(DISPLAY_MODE_RING, &in, &slot));
+    TEST_ASSERT_EQUAL(DL_FONT_NUMERAL_LARGE, slot.font);
+    TEST_ASSERT_FALSE(display_emit_time_slot(DISPLAY_MODE_HEX, &in, &slot));
+    TEST_ASSERT_FALSE(display_emit_time_slot(DISPLAY_MODE_BLOCKS, &in, &slot));
+    return true;
+}
+
+bool test_display_emit_percent_labels(void) {
+    DisplayInput in = make_input(75, 300);
+    display_emit(&s_list, DISPLAY_MODE_PERCENT, &in);
+    TEST_ASSERT_TRUE(find_text(&s_list, "75%") != NULL);
+    TEST_ASSERT_TRUE(find_text(&s_list, "elapsed") != NULL);
+
+    display_emit(&s_list, DISPLAY_MODE_PERCENT_REMAINING, &in);
+    TEST_ASSERT_TRUE(find_text(&s_list, "25%") != NULL);
+    TEST_ASSERT_TRUE(find_text(&s_list, "remaining") != NULL);
+    return true;
+}
+
+bool test_display_emit_hex_fits_long_timers(void) {
+    DisplayInput in = make_input(356400, 356400);  // 99 hours
+    display_emit(&s_list, DISPLAY_MODE_HEX, &in);
+    TEST_ASSERT_TRUE(find_text(&s_list, "= 356400 sec") != NULL);
+    return true;
+}
+
+bool test_display_emit_hourglass_fits_list(void) {
+    static SandGrid grid;
+    DisplayInput in = make_input(100, 300);
+    sand_init(&grid, SAND_GRAINS / 2);
+    in.sand = grid.rows;
+    display_emit(&s_list, DISPLAY_MODE_HOURGLASS, &in);
+    TEST_ASSERT_FALSE(s_list.overflow);
+    TEST_ASSERT_EQUAL(11, count_type(&s_list, DL_FILL_RECT));  // One run per settled row
+
+    // Scattered grains collapse to spans rather than overflowing
+    for (int row = 0; row < SAND_ROWS; row++) {
+        grid.rows[row] = 0x5555 & sand_row_mask(row);
+    }
+    display_emit(&s_list, DISPLAY_MODE_HOURGLASS, &in);
+    TEST_ASSERT_FALSE(s_list.overflow);
+    return true;
+}
+
+bool test_display_emit_hourglass_step_redraws_little(void) {
+    static SandGrid grid;
+    DisplayInput in = make_input(100, 300);
+    sand_init(&grid, 10);
+    in.sand = grid.rows;
+    display_list_history_invalidate(&s_history);
+    display_emit(&s_list, DISPLAY_MODE_HOURGLASS, &in);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+
+    sand_set_target(&grid, 11);
+    sand_step(&grid);
+    display_emit(&s_list, DISPLAY_MODE_HOURGLASS, &in);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+    TEST_ASSERT_FALSE(s_plan.full);
+    TEST_ASSERT_TRUE(s_plan.stats.damaged_area < 144 * 168 / 4);
+    return true;
+}
+
+bool test_display_emit_water_slosh_redraws_columns_only(void) {
+    static WaterSurface surface;
+    for (int art = 0; art < 2; art++) {
+        DisplayInput in = make_input(200, 300);
+        in.vector_art = art;
+        water_init(&surface);
+        in.water = &surface;
+        display_list_history_invalidate(&s_history);
+        display_emit(&s_list, DISPLAY_MODE_WATER_LEVEL, &in);
+        display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+        TEST_ASSERT_EQUAL(WATER_COLUMNS, count_type(&s_list, DL_FILL_RECT));
+
+        // Every step of a slosh redraws moved columns and never the glass
+        water_set_tilt(&surface, -600);
+        for (int step = 0; step < 60; step++) {
+            water_step(&surface);
+            display_emit(&s_list, DISPLAY_MODE_WATER_LEVEL, &in);
+            display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+            for (int i = 0; i < s_list.count; i++) {
+                if (display_list_plan_issues(&s_plan, i)) TEST_ASSERT_EQUAL(DL_FILL_RECT, s_list.prims[i].type);
+            }
+        }
+    }
+    return true;
+}
+
+bool test_display_list_hollow_images_touch_their_outline(void) {
+    DlRect area = { 10, 10, 41, 41 };
+    DlRect box = { 20, 20, 21, 21 };
+    display_list_reset(&s_list);
+    dl_image(&s_list, 0, area, DL_HOLLOW_BOX, box, 0xFF);
+    dl_image(&s_list, 1, area, DL_HOLLOW_ROUND, box, 0xFF);
+    const DlPrim *square = &s_list.prims[0];
+    const DlPrim *round = &s_list.prims[1];
+
+    DlRect middle = { 28, 28, 5, 5 };
+    DlRect corner = { 20, 20, 3, 3 };     // In the box, outside its circle
+    DlRect edge = { 38, 28, 5, 5 };       // Across the box's right side
+    TEST_ASSERT_FALSE(dl_prim_touches(square, middle));
+    TEST_ASSERT_FALSE(dl_prim_touches(round, middle));
+    TEST_ASSERT_FALSE(dl_prim_touches(square, corner));
+    TEST_ASSERT_TRUE(dl_prim_touches(round, corner));
+    TEST_ASSERT_TRUE(dl_prim_touches(square, edge));
+    TEST_ASSERT_EQUAL(41, dl_prim_bounds(square).w);
+    return true;
+}
+
+bool test_display_emit_vector_art_replaces_outlines(void) {
+    DisplayInput in = make_input(150, 300);
+    in.vector_art = true;
+
+    display_emit(&s_list, DISPLAY_MODE_CLOCK, &in);
+    TEST_ASSERT_EQUAL(1, count_type(&s_list, DL_IMAGE));
+    TEST_ASSERT_EQUAL(0, count_type(&s_list, DL_STROKE_CIRCLE));
+    TEST_ASSERT_EQUAL(1, count_type(&s_list, DL_LINE));          // The hand
+    TEST_ASSERT_EQUAL(DISPLAY_ART_CLOCK_FACE, s_list.prims[0].flags);
+
+    display_emit(&s_list, DISPLAY_MODE_HOURGLASS, &in);
+    TEST_ASSERT_EQUAL(1, count_type(&s_list, DL_IMAGE));
+    TEST_ASSERT_EQUAL(0, count_type(&s_list, DL_LINE));
+
+    display_emit(&s_list, DISPLAY_MODE_WATER_LEVEL, &in);
+    TEST_ASSERT_EQUAL(2, count_type(&s_list, DL_IMAGE));
+    TEST_ASSERT_EQUAL(0, count_type(&s_list, DL_LINE));
+
+    // A face smaller than the full-screen one it was built for falls back to lines
+    in.height = 120;
+    display_emit(&s_list, DISPLAY_MODE_CLOCK, &in);
+    TEST_ASSERT_EQUAL(0, count_type(&s_list, DL_IMAGE));
+    TEST_ASSERT_EQUAL(1, count_type(&s_list, DL_STROKE_CIRCLE));
+    return true;
+}
+
+bool test_display_emit_art_scales_with_screen(void) {
+    static SandGrid grid;
+    DisplayInput in = make_input(100, 300);
+    in.width = 200;
+    in.height = 228;
+    in.vector_art = true;
+    sand_init(&grid, SAND_GRAINS);
+    in.sand = grid.rows;
+
+    // Emery: a 4 px unit, for the cells and the glass around them
+    display_emit(&s_list, DISPLAY_MODE_HOURGLASS, &in);
+    TEST_ASSERT_EQUAL(85, s_list.prims[0].rect.w);
+    TEST_ASSERT_EQUAL(4, s_list.prims[1].rect.h);
+    return true;
+}
+
+// The prebuilt images (tools/gen_art.py) must have the size the emitters give
+// their areas on each screen
+static bool art_file_size(const char *path, int *width, int *height) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    // "PDCI", data size, version, reserved, then the view box
+    uint8_t header[14];
+    bool ok = fread(header, 1, sizeof(header), f) == sizeof(header) && memcmp(header, "PDCI", 4) == 0;
+    fclose(f);
+    *width = (int16_t)(header[10] | header[11] << 8);
+    *height = (int16_t)(header[12] | header[13] << 8);
+    return ok;
+}
+
+bool test_display_emit_art_matches_resources(void) {
+    static const struct {
+        const char *suffix;
+        int width;
+        int height;
+    } screens[] = { { "", 144, 168 }, { "~round", 180, 180 }, { "~emery", 200, 228 } };
+    static const struct {
+        DisplayMode mode;
+        const char *name;
+        DisplayArt art;
+    } arts[] = {
+        { DISPLAY_MODE_HOURGLASS, "hourglass", DISPLAY_ART_HOURGLASS },
+        { DISPLAY_MODE_WATER_LEVEL, "water_glass", DISPLAY_ART_WATER_GLASS },
+        { DISPLAY_MODE_WATER_LEVEL, "water_marks", DISPLAY_ART_WATER_MARKS },
+        { DISPLAY_MODE_CLOCK, "clock_face", DISPLAY_ART_CLOCK_FACE },
+    };
+
+    for (size_t s = 0; s < sizeof(screens) / sizeof(screens[0]); s++) {
+        DisplayInput in = make_input(150, 300);
+        in.width = screens[s].width;
+        in.height = screens[s].height;
+        in.vector_art = true;
+        for (size_t a = 0; a < sizeof(arts) / sizeof(arts[0]); a++) {
+            display_emit(&s_list, arts[a].mode, &in);
+            const DlPrim *image = NULL;
+            for (int i = 0; i < s_list.count; i++) {
+                if (s_list.prims[i].type == DL_IMAGE && s_list.prims[i].flags == arts[a].art) image = &s_list.prims[i];
+            }
+            TEST_ASSERT_TRUE(image != NULL);
+
+            char path[64];
+            snprintf(path, sizeof(path), "resources/art/%s%s.pdc", arts[a].name, screens[s].suffix);
+            int width, height;
+            if (!art_file_size(path, &width, &height)) {
+                printf("\n    can't read %s", path);
+                return false;
+            }
+            TEST_ASSERT_EQUAL(image->rect.w, width);
+            TEST_ASSERT_EQUAL(image->rect.h, height);
+        }
+    }
+    return true;
+}
+
+bool test_display_emit_binary_tick_redraws_little(void) {
+    DisplayInput in = make_input(598, 900);
+    display_list_history_invalidate(&s_history);
+    display_emit(&s_list, DISPLAY_MODE_BINARY, &in);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+
+    in.remaining_seconds = 597;  // 9:58 -> 9:57
+    display_emit(&s_list, DISPLAY_MODE_BINARY, &in);
+    display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+    TEST_ASSERT_FALSE(s_plan.full);
+    TEST_ASSERT_TRUE(s_plan.stats.draw_calls < s_plan.stats.primitives / 2);
+    TEST_ASSERT_TRUE(s_plan.stats.damaged_area < 144 * 168 / 2);
+    return true;
+}
+
+static int binary_word(int remaining) {
+    TimeComponents t = time_decompose(remaining);
+    return (t.hours << 12) | (t.minutes << 6) | t.seconds;
+}
+
+bool test_display_emit_binary_draws_flipped_bits_only(void) {
+    DisplayInput in = make_input(7200, 7200);
+    display_list_history_invalidate(&s_history);
+    display_emit(&s_list, DISPLAY_MODE_BINARY, &in);
+    display_list_plan(&s_history, &s_list, 144, 168, true, &s_plan);
+
+    // Two hours of ticks: one call per bit that flipped, labels never
+    for (int remaining = 7199; remaining >= 0; remaining--) {
+        in.remaining_seconds = remaining;
+        display_emit(&s_list, DISPLAY_MODE_BINARY, &in);
+        display_list_plan(&s_history, &s_list, 144, 168, false, &s_plan);
+
+        int flipped = __builtin_popcount(binary_word(remaining) ^ binary_word(remaining + 1));
+        if (s_plan.stats.draw_calls != flipped) {
+            printf("\n    %d calls for %d flipped bits at %d s", s_plan.stats.draw_calls, flipped, remaining);
+            return false;
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// Dashboard Tile Tests
+// =============================================================================
+
+bool test_display_list_scale_halves_geometry(void) {
+    display_list_reset(&s_list);
+    dl_fill_rect(&s_list, 20, 40, 60, 1, 0, 0xCC);
+    dl_line(&s_list, 10, 10, 50, 90, 3, 0xF0);
+    dl_stroke_circle(&s_list, 72, 84, 40, 2, 0xFF);
+    dl_image(&s_list, 0, (DlRect){ 0, 0, 40, 40 }, DL_HOLLOW_NONE, (DlRect){ 0, 0, 0, 0 }, 0xFF);
+    dl_text(&s_list, "5:00", DL_FONT_GOTHIC_18, 0, 100, 144, 22, DL_ALIGN_CENTER, 0xFF);
+
+    display_list_scale(&s_list, 1, 2, 72, 0);
+    TEST_ASSERT_EQUAL(4, s_list.count);
+    TEST_ASSERT_EQUAL(82, s_list.prims[0].rect.x);
+    TEST_ASSERT_EQUAL(30, s_list.prims[0].rect.w);
+    TEST_ASSERT_EQUAL(1, s_list.prims[0].rect.h);   // Doesn't vanish
+    TEST_ASSERT_EQUAL(97, s_list.prims[1].a);
+    TEST_ASSERT_EQUAL(45, s_list.prims[1].b);
+    TEST_ASSERT_EQUAL(1, s_list.prims[1].c);
+    TEST_ASSERT_EQUAL(20, s_list.prims[2].a);
+
+    // The next font down, still a line high, centered where it was
+    const DlPrim *text = &s_list.prims[3];
+    TEST_ASSERT_EQUAL(DL_FONT_GOTHIC_14, text->font);
+    TEST_ASSERT_EQUAL(16, text->rect.h);
+    TEST_ASSERT_EQUAL(48, text->rect.y);
+    return true;
+}
+
+bool test_display_tile_layout_splits_screen(void) {
+    DlRect tiles[DISPLAY_TILE_MAX];
+    for (int count = 1; count <= DISPLAY_TILE_MAX; count++) {
+        display_tile_layout(count, 144, 168, tiles);
+        int area = 0;
+        for (int i = 0; i < count; i++) {
+            TEST_ASSERT_TRUE(tiles[i].x >= 0 && tiles[i].x + tiles[i].w <= 144);
+            TEST_ASSERT_TRUE(tiles[i].y >= 0 && tiles[i].y + tiles[i].h <= 168);
+            area += tiles[i].w * tiles[i].h;
+        }
+        // Three tiles leave the fourth quarter empty
+        TEST_ASSERT_EQUAL(count == 3 ? 72 * 84 * 3 : 144 * 168, area);
+    }
+    display_tile_layout(2, 144, 168, tiles);
+    TEST_ASSERT_EQUAL(84, tiles[1].y);
+    TEST_ASSERT_EQUAL(144, tiles[1].w);
+    return true;
+}
+
+bool test_display_emit_tile_stays_inside(void) {
+    DlRect tiles[DISPLAY_TILE_MAX];
+    display_tile_layout(4, 144, 168, tiles);
+    DisplayInput in = make_input(3599, 3600);
+    in.vector_art = true;
+
+    for (int mode = 0; mode < DISPLAY_MODE_COUNT; mode++) {
+        for (int i = 0; i < DISPLAY_TILE_MAX; i++) {
+            display_emit_tile(&s_list, (DisplayMode)mode, &in, tiles[i], i == 0);
+            TEST_ASSERT_TRUE(s_list.count > 0);
+            TEST_ASSERT_EQUAL(0, count_type(&s_list, DL_IMAGE));
+            for (int p = 0; p < s_list.count; p++) {
+                DlRect b = dl_prim_bounds(&s_list.prims[p]);
+                if (b.x < tiles[i].x || b.y < tiles[i].y || b.x + b.w > tiles[i].x + tiles[i].w ||
+                    b.y + b.h > tiles[i].y + tiles[i].h) {
+                    printf("\n    %s prim %d leaves tile %d", timer_display_mode_name((DisplayMode)mode), p, i);
+                    return false;
+                }
+            }
+        }
+        TEST_ASSERT_TRUE(find_text(&s_list, "59:59") != NULL);
+    }
+    return true;
+}
+
+static uint32_t s_screen[(144 * 168) / 4];
+
+// Draw the tiles in `draw` as their key's color, as a render of the
+// dashboard would, over what the framebuffer holds. Returns how many.
+static int draw_tiles(const RasterTarget *screen, DisplayTileState *state, const uint32_t *keys, bool full_redraw) {
+    DlRect tiles[DISPLAY_TILE_MAX];
+    display_tile_layout(DISPLAY_TILE_MAX, screen->width, screen->height, tiles);
+    bool clear;
+    unsigned draw = display_tiles_to_draw(state, DISPLAY_TILE_MAX, keys, full_redraw, &clear);
+    if (clear) {
+        raster_reference_fill_rect(screen, 0, 0, screen->width, screen->height, 0xC0);
+    }
+    int drawn = 0;
+    for (int i = 0; i < DISPLAY_TILE_MAX; i++) {
+        if (!(draw & (1u << i))) continue;
+        raster_reference_fill_rect(screen, tiles[i].x, tiles[i].y, tiles[i].w, tiles[i].h, (uint8_t)keys[i]);
+        drawn++;
+    }
+    return drawn;
+}
+
+static bool tiles_show(const RasterTarget *screen, const uint32_t *keys) {
+    DlRect tiles[DISPLAY_TILE_MAX];
+    display_tile_layout(DISPLAY_TILE_MAX, screen->width, screen->height, tiles);
+    for (int i = 0; i < DISPLAY_TILE_MAX; i++) {
+        RasterRow row = raster_target_row(screen, tiles[i].y + tiles[i].h / 2);
+        if (row.data[tiles[i].x + tiles[i].w / 2] != (uint8_t)keys[i]) return false;
+    }
+    return true;
+}
+
+bool test_display_tiles_redraw_only_what_changed(void) {
+    RasterTarget screen;
+    raster_platform_target(&screen, &g_raster_platforms[RASTER_PLATFORM_BASALT], (uint8_t *)s_screen);
+    raster_reference_fill_rect(&screen, 0, 0, screen.width, screen.height, 0xC0);
+    DisplayTileState state = { { 0 }, 0, 0 };
+    uint32_t keys[DISPLAY_TILE_MAX] = { 0xF0, 0xCC, 0xC3, 0xFF };
+
+    // The first render draws every tile
+    TEST_ASSERT_EQUAL(DISPLAY_TILE_MAX, draw_tiles(&screen, &state, keys, true));
+    TEST_ASSERT_TRUE(tiles_show(&screen, keys));
+
+    // Moving the selection draws its two tiles; the others keep their frame
+    keys[0] = 0xF5;
+    keys[1] = 0xCD;
+    TEST_ASSERT_EQUAL(2, draw_tiles(&screen, &state, keys, false));
+    TEST_ASSERT_TRUE(tiles_show(&screen, keys));
+
+    // A tick that changes nothing (finished timers) draws nothing
+    TEST_ASSERT_EQUAL(0, draw_tiles(&screen, &state, keys, false));
+    TEST_ASSERT_TRUE(tiles_show(&screen, keys));
+
+    // A tile whose grid changed, and a render the system asked for
+    display_tiles_forget(&state, 3);
+    TEST_ASSERT_EQUAL(1, draw_tiles(&screen, &state, keys, false));
+    TEST_ASSERT_EQUAL(DISPLAY_TILE_MAX, draw_tiles(&screen, &state, keys, true));
+    TEST_ASSERT_TRUE(tiles_show(&screen, keys));
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_display_list_tests(void) {
+    TEST_SUITE_BEGIN("Display List");
+    RUN_TEST(test_display_list_emit_records_fields);
+    RUN_TEST(test_display_list_skips_empty_shapes);
+    RUN_TEST(test_display_list_overflow_is_flagged);
+    RUN_TEST(test_display_list_trig_matches_quadrants);
+    RUN_TEST(test_display_list_sector_ring_layout);
+    RUN_TEST(test_display_list_bounds_cover_strokes);
+    RUN_TEST(test_display_list_ring_touch_ignores_hole);
+    RUN_TEST(test_display_list_first_frame_is_full);
+    RUN_TEST(test_display_list_unchanged_frame_issues_nothing);
+    RUN_TEST(test_display_list_change_pulls_in_overlaps);
+    RUN_TEST(test_display_list_reveal_redraws_what_was_covered);
+    RUN_TEST(test_display_list_plan_touches_what_it_draws);
+    RUN_TEST(test_display_list_insert_does_not_shift_later_prims);
+    RUN_TEST(test_display_list_removed_prim_damages_old_bounds);
+    RUN_TEST(test_display_list_gauge_repaints_in_place);
+    RUN_TEST(test_display_list_overflow_forces_full_frames);
+    RUN_TEST(test_display_emit_dispatch);
+    RUN_TEST(test_display_emit_clock_geometry);
+    RUN_TEST(test_display_emit_ring_and_radial_are_bands);
+    RUN_TEST(test_display_emit_radial_tick_repaints_seconds_ring);
+    RUN_TEST(test_display_emit_binary_dots_follow_bits);
+    RUN_TEST(test_display_emit_time_slots_clear_of_art);
+    RUN_TEST(test_display_emit_percent_labels);
+    RUN_TEST(test_display_emit_hex_fits_long_timers);
+    RUN_TEST(test_display_emit_hourglass_fits_list);
+    RUN_TEST(test_display_emit_hourglass_step_redraws_little);
+    RUN_TEST(test_display_emit_water_slosh_redraws_columns_only);
+    RUN_TEST(test_display_list_hollow_images_touch_their_outline);
+    RUN_TEST(test_display_emit_vector_art_replaces_outlines);
+    RUN_TEST(test_display_emit_art_scales_with_screen);
+    RUN_TEST(test_display_emit_art_matches_resources);
+    RUN_TEST(test_display_emit_binary_tick_redraws_little);
+    RUN_TEST(test_display_emit_binary_draws_flipped_bits_only);
+    RUN_TEST(test_display_list_scale_halves_geometry);
+    RUN_TEST(test_display_tile_layout_splits_screen);
+    RUN_TEST(test_display_emit_tile_stays_inside);
+    RUN_TEST(test_display_tiles_redraw_only_what_changed);
+    TEST_SUITE_END();
+}
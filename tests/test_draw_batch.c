@@ -0,0 +1,132 @@
+// =============================================================================
+// Draw Batching Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/display/draw_batch.h"
+#include "../src/c/display/display_emit.h"
+
+static DisplayList s_list;
+static DisplayListHistory s_history;
+static DisplayListPlan s_plan;
+static SandGrid s_sand;
+
+static int plan_full(DisplayList *list, uint8_t *order) {
+    display_list_history_invalidate(&s_history);
+    display_list_plan(&s_history, list, 144, 168, true, &s_plan);
+    return draw_batch_order(list, &s_plan, true, order);
+}
+
+// Setter calls issuing `count` primitives in `order` (list order if NULL)
+static int state_changes(const DisplayList *list, const uint8_t *order, int count) {
+    DrawStateCache cache = { 0 };
+    for (int n = 0; n < count; n++) {
+        draw_state_apply(&cache, draw_state_for(&list->prims[order ? order[n] : n], true));
+    }
+    return cache.changes;
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool test_draw_state_cache_skips_repeats(void) {
+    DrawStateCache cache = { 0 };
+    TEST_ASSERT_TRUE(draw_state_fill(&cache, 0xC0));
+    TEST_ASSERT_FALSE(draw_state_fill(&cache, 0xC0));
+    TEST_ASSERT_TRUE(draw_state_fill(&cache, 0xFF));
+
+    DrawState stroke = { DRAW_STATE_STROKE, 0xF0, 2 };
+    TEST_ASSERT_EQUAL(2, draw_state_apply(&cache, stroke));
+    stroke.stroke_width = 3;
+    TEST_ASSERT_EQUAL(1, draw_state_apply(&cache, stroke));
+    TEST_ASSERT_TRUE(draw_state_text(&cache, 0xFF));
+
+    // After a reset nothing is taken for granted, and counting goes on
+    draw_state_reset(&cache);
+    TEST_ASSERT_TRUE(draw_state_fill(&cache, 0xFF));
+    TEST_ASSERT_EQUAL(7, cache.changes);
+    return true;
+}
+
+bool test_draw_batch_groups_disjoint_prims(void) {
+    display_list_reset(&s_list);
+    dl_fill_circle(&s_list, 20, 20, 5, 0xF0);
+    dl_fill_circle(&s_list, 40, 20, 5, 0xCF);
+    dl_fill_circle(&s_list, 60, 20, 5, 0xF0);
+    dl_fill_circle(&s_list, 80, 20, 5, 0xCF);
+
+    uint8_t order[DISPLAY_LIST_MAX];
+    TEST_ASSERT_EQUAL(4, plan_full(&s_list, order));
+    TEST_ASSERT_EQUAL(0, order[0]);
+    TEST_ASSERT_EQUAL(2, order[1]);
+    TEST_ASSERT_EQUAL(1, order[2]);
+    TEST_ASSERT_EQUAL(3, order[3]);
+    TEST_ASSERT_EQUAL(4, state_changes(&s_list, NULL, 4));
+    TEST_ASSERT_EQUAL(2, state_changes(&s_list, order, 4));
+    return true;
+}
+
+bool test_draw_batch_keeps_overlapping_prims_in_order(void) {
+    display_list_reset(&s_list);
+    dl_fill_circle(&s_list, 20, 20, 5, 0xF0);
+    dl_fill_circle(&s_list, 26, 20, 5, 0xCF);   // Over the first
+    dl_fill_circle(&s_list, 32, 20, 5, 0xF0);   // Over the second
+    dl_fill_circle(&s_list, 90, 90, 5, 0xF0);   // Clear of them all
+
+    uint8_t order[DISPLAY_LIST_MAX];
+    TEST_ASSERT_EQUAL(4, plan_full(&s_list, order));
+    TEST_ASSERT_EQUAL(0, order[0]);
+    TEST_ASSERT_EQUAL(3, order[1]);
+    TEST_ASSERT_EQUAL(1, order[2]);
+    TEST_ASSERT_EQUAL(2, order[3]);
+    return true;
+}
+
+bool test_draw_batch_every_list_mode(void) {
+    sand_init(&s_sand, SAND_GRAINS / 2);
+    for (int mode = 0; mode < DISPLAY_MODE_COUNT; mode++) {
+        if (!display_emit_supports((DisplayMode)mode)) continue;
+        DisplayInput in = {
+            .width = 144, .height = 168,
+            .remaining_seconds = 150, .total_seconds = 300,
+            .running = true, .sand = s_sand.rows,
+            .background = 0xC0, .primary = 0xFF, .secondary = 0xD5, .accent = 0xF0, .hint = 0xEA
+        };
+        display_emit(&s_list, (DisplayMode)mode, &in);
+
+        uint8_t order[DISPLAY_LIST_MAX];
+        int count = plan_full(&s_list, order);
+        TEST_ASSERT_EQUAL(s_list.count, count);
+
+        // Every primitive once, and any two that overlap as they were
+        int position[DISPLAY_LIST_MAX];
+        for (int i = 0; i < count; i++) position[i] = -1;
+        for (int n = 0; n < count; n++) {
+            TEST_ASSERT_EQUAL(-1, position[order[n]]);
+            position[order[n]] = n;
+        }
+        for (int i = 0; i < count; i++) {
+            for (int j = i + 1; j < count; j++) {
+                if (dl_prims_overlap(&s_list.prims[i], &s_list.prims[j])) {
+                    TEST_ASSERT_TRUE(position[i] < position[j]);
+                }
+            }
+        }
+        TEST_ASSERT_TRUE(state_changes(&s_list, order, count) <= state_changes(&s_list, NULL, count));
+    }
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_draw_batch_tests(void) {
+    TEST_SUITE_BEGIN("Draw Batching");
+    RUN_TEST(test_draw_state_cache_skips_repeats);
+    RUN_TEST(test_draw_batch_groups_disjoint_prims);
+    RUN_TEST(test_draw_batch_keeps_overlapping_prims_in_order);
+    RUN_TEST(test_draw_batch_every_list_mode);
+    TEST_SUITE_END();
+}
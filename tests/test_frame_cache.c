@@ -0,0 +1,153 @@
+// =============================================================================
+// Frame Cache Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "raster_reference.h"
+#include "../src/c/display/frame_cache.h"
+
+static uint32_t s_screen[(200 * 228) / 4];
+static uint32_t s_cache_buf[(200 * 228) / 4];
+
+// Columns from `min_x` on
+static void fill_pattern_from(const RasterTarget *target, uint8_t seed, int min_x) {
+    for (int y = 0; y < target->height; y++) {
+        RasterRow row = raster_target_row(target, y);
+        for (int x = (row.min_x > min_x ? row.min_x : min_x); x <= row.max_x; x++) {
+            raster_fill_span(target, y, x, x, (uint8_t)(0xC0 | ((x * 7 + y * 3 + seed) & 0x3F)));
+        }
+    }
+}
+
+static void fill_pattern(const RasterTarget *target, uint8_t seed) {
+    fill_pattern_from(target, seed, 0);
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool test_frame_key_depends_on_values_and_order(void) {
+    FrameKey a = frame_key_add(frame_key_add(FRAME_KEY_INIT, 1), 2);
+    FrameKey b = frame_key_add(frame_key_add(FRAME_KEY_INIT, 2), 1);
+    FrameKey c = frame_key_add(frame_key_add(FRAME_KEY_INIT, 1), 2);
+    TEST_ASSERT_TRUE(a != b);
+    TEST_ASSERT_TRUE(a == c);
+    TEST_ASSERT_TRUE(frame_key_add(FRAME_KEY_INIT, 0) != FRAME_KEY_INIT);
+    return true;
+}
+
+bool test_frame_cache_round_trips_every_platform(void) {
+    static uint32_t expected[(200 * 228) / 4];
+    for (int p = 0; p < RASTER_PLATFORM_COUNT; p++) {
+        const RasterPlatform *platform = &g_raster_platforms[p];
+        RasterTarget screen;
+        raster_platform_target(&screen, platform, (uint8_t *)s_screen);
+        size_t bytes = (size_t)(platform->stride * platform->height);
+
+        FrameCache cache;
+        frame_cache_init(&cache, (uint8_t *)s_cache_buf, sizeof(s_cache_buf));
+        TEST_ASSERT_TRUE(frame_cache_bytes(screen.format, screen.width, screen.height) <= bytes);
+
+        memset(s_screen, 0, sizeof(s_screen));
+        fill_pattern(&screen, (uint8_t)p);
+        memcpy(expected, s_screen, bytes);
+        frame_cache_store(&cache, &screen, 42);
+
+        // Something else drew over it; the right key brings the frame back
+        fill_pattern(&screen, 0x15);
+        TEST_ASSERT_FALSE(frame_cache_restore(&cache, &screen, 43));
+        TEST_ASSERT_TRUE(frame_cache_restore(&cache, &screen, 42));
+        TEST_ASSERT_TRUE(memcmp(expected, s_screen, bytes) == 0);
+    }
+    return true;
+}
+
+bool test_frame_cache_refuses_other_layouts(void) {
+    FrameCache cache;
+    RasterTarget small, large;
+    raster_target_init(&small, (uint8_t *)s_screen, 144, 144, 168, RASTER_FORMAT_8BIT);
+    raster_target_init(&large, (uint8_t *)s_screen, 200, 200, 228, RASTER_FORMAT_8BIT);
+
+    // Too small a buffer never holds a frame
+    frame_cache_init(&cache, (uint8_t *)s_cache_buf, 144 * 168 - 1);
+    frame_cache_store(&cache, &small, 1);
+    TEST_ASSERT_FALSE(frame_cache_restore(&cache, &small, 1));
+
+    frame_cache_init(&cache, (uint8_t *)s_cache_buf, sizeof(s_cache_buf));
+    frame_cache_store(&cache, &small, 1);
+    TEST_ASSERT_FALSE(frame_cache_restore(&cache, &large, 1));
+
+    frame_cache_invalidate(&cache);
+    TEST_ASSERT_FALSE(frame_cache_restore(&cache, &small, 1));
+
+    // No buffer at all
+    frame_cache_init(&cache, NULL, sizeof(s_cache_buf));
+    frame_cache_store(&cache, &small, 1);
+    TEST_ASSERT_FALSE(frame_cache_restore(&cache, &small, 1));
+    return true;
+}
+
+bool test_frame_cache_wipe_splits_every_platform(void) {
+    static uint32_t right_buf[(200 * 228) / 4];
+    static uint32_t expected[(200 * 228) / 4];
+    for (int p = 0; p < RASTER_PLATFORM_COUNT; p++) {
+        const RasterPlatform *platform = &g_raster_platforms[p];
+        RasterTarget screen;
+        raster_platform_target(&screen, platform, (uint8_t *)s_screen);
+        size_t bytes = (size_t)(platform->stride * platform->height);
+
+        FrameCache left, right;
+        frame_cache_init(&left, (uint8_t *)s_cache_buf, sizeof(s_cache_buf));
+        frame_cache_init(&right, (uint8_t *)right_buf, sizeof(right_buf));
+        memset(s_screen, 0, sizeof(s_screen));
+        fill_pattern(&screen, 0x11);
+        frame_cache_store(&left, &screen, 1);
+        fill_pattern(&screen, 0x22);
+        frame_cache_store(&right, &screen, 2);
+
+        // A split on a byte boundary lands exactly on 1-bit targets too
+        const int splits[] = { 0, 64, platform->width };
+        for (int i = 0; i < 3; i++) {
+            fill_pattern(&screen, 0x11);
+            fill_pattern_from(&screen, 0x22, splits[i]);
+            memcpy(expected, s_screen, bytes);
+
+            fill_pattern(&screen, 0x33);
+            TEST_ASSERT_TRUE(frame_cache_wipe(&left, &right, &screen, splits[i]));
+            TEST_ASSERT_TRUE(memcmp(expected, s_screen, bytes) == 0);
+        }
+    }
+    return true;
+}
+
+bool test_frame_cache_wipe_needs_both_frames(void) {
+    static uint32_t right_buf[(144 * 168) / 4];
+    FrameCache left, right;
+    RasterTarget small, large;
+    raster_target_init(&small, (uint8_t *)s_screen, 144, 144, 168, RASTER_FORMAT_8BIT);
+    raster_target_init(&large, (uint8_t *)s_screen, 200, 200, 228, RASTER_FORMAT_8BIT);
+    frame_cache_init(&left, (uint8_t *)s_cache_buf, sizeof(s_cache_buf));
+    frame_cache_init(&right, (uint8_t *)right_buf, sizeof(right_buf));
+
+    frame_cache_store(&left, &small, 1);
+    TEST_ASSERT_FALSE(frame_cache_wipe(&left, &right, &small, 72));
+    frame_cache_store(&right, &small, 2);
+    TEST_ASSERT_TRUE(frame_cache_wipe(&left, &right, &small, 72));
+    TEST_ASSERT_FALSE(frame_cache_wipe(&left, &right, &large, 72));
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_frame_cache_tests(void) {
+    TEST_SUITE_BEGIN("Frame Cache");
+    RUN_TEST(test_frame_key_depends_on_values_and_order);
+    RUN_TEST(test_frame_cache_round_trips_every_platform);
+    RUN_TEST(test_frame_cache_refuses_other_layouts);
+    RUN_TEST(test_frame_cache_wipe_splits_every_platform);
+    RUN_TEST(test_frame_cache_wipe_needs_both_frames);
+    TEST_SUITE_END();
+}
@@ -0,0 +1,128 @@
+// =============================================================================
+// Glyph Atlas Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "raster_reference.h"
+#include "../src/c/display/glyph_atlas.h"
+
+static uint32_t s_buf[(200 * 228) / 4];
+static GlyphAtlas s_atlas;
+static const uint8_t s_shades[GLYPH_SHADE_COUNT] = { 0xFF, 0xCC, 0xC4 };
+
+static bool pixel_1bit(const uint8_t *row, int x) {
+    return (row[x >> 3] >> (x & 7)) & 1;
+}
+
+// =============================================================================
+// Atlas Construction Tests
+// =============================================================================
+
+bool test_glyph_atlas_masks_are_lsb_first(void) {
+    glyph_atlas_build(&s_atlas, RASTER_FORMAT_1BIT, s_shades, 0xC0);
+    TEST_ASSERT_EQUAL(0x04, s_atlas.masks[1][0]);  // Centered stroke
+    TEST_ASSERT_EQUAL(0x1F, s_atlas.masks[7][0]);  // Full-width bar
+    TEST_ASSERT_EQUAL(0x08, s_atlas.masks[4][0]);  // Right of center mirrors to bit 3
+    return true;
+}
+
+bool test_glyph_atlas_matches_tracks_palette(void) {
+    glyph_atlas_build(&s_atlas, RASTER_FORMAT_8BIT, s_shades, 0xC0);
+    TEST_ASSERT_TRUE(glyph_atlas_matches(&s_atlas, RASTER_FORMAT_8BIT, s_shades, 0xC0));
+    TEST_ASSERT_FALSE(glyph_atlas_matches(&s_atlas, RASTER_FORMAT_8BIT, s_shades, 0xFF));
+    TEST_ASSERT_FALSE(glyph_atlas_matches(&s_atlas, RASTER_FORMAT_1BIT, s_shades, 0xC0));
+
+    uint8_t other[GLYPH_SHADE_COUNT] = { 0xFF, 0xCC, 0xF0 };
+    TEST_ASSERT_FALSE(glyph_atlas_matches(&s_atlas, RASTER_FORMAT_8BIT, other, 0xC0));
+    return true;
+}
+
+// =============================================================================
+// Blit Tests
+// =============================================================================
+
+bool test_glyph_atlas_8bit_blit_is_opaque(void) {
+    RasterTarget target;
+    memset(s_buf, 0xAA, sizeof(s_buf));
+    raster_target_init(&target, (uint8_t *)s_buf, 144, 144, 168, RASTER_FORMAT_8BIT);
+    glyph_atlas_build(&s_atlas, RASTER_FORMAT_8BIT, s_shades, 0xC0);
+
+    glyph_atlas_blit(&s_atlas, &target, 7, GLYPH_SHADE_NEAR, 10, 20);
+    uint8_t *px = target.data;
+
+    TEST_ASSERT_EQUAL(0xCC, px[20 * 144 + 10]);   // Top bar of the 7
+    TEST_ASSERT_EQUAL(0xCC, px[20 * 144 + 14]);
+    TEST_ASSERT_EQUAL(0xC0, px[21 * 144 + 10]);   // Background baked in
+    TEST_ASSERT_EQUAL(0xAA, px[20 * 144 + 15]);   // Outside the cell untouched
+    TEST_ASSERT_EQUAL(0xAA, px[27 * 144 + 10]);
+    return true;
+}
+
+bool test_glyph_atlas_1bit_blit_across_bytes(void) {
+    RasterTarget target;
+    memset(s_buf, 0xFF, sizeof(s_buf));
+    raster_target_init(&target, (uint8_t *)s_buf, 20, 144, 168, RASTER_FORMAT_1BIT);
+    glyph_atlas_build(&s_atlas, RASTER_FORMAT_1BIT, s_shades, 0xC0);
+
+    // x = 6 puts the 5-pixel row across a byte boundary
+    glyph_atlas_blit(&s_atlas, &target, 1, GLYPH_SHADE_HEAD, 6, 0);
+    uint8_t *row = target.data;
+
+    TEST_ASSERT_FALSE(pixel_1bit(row, 6));
+    TEST_ASSERT_FALSE(pixel_1bit(row, 7));
+    TEST_ASSERT_TRUE(pixel_1bit(row, 8));    // Stroke of the 1
+    TEST_ASSERT_FALSE(pixel_1bit(row, 9));
+    TEST_ASSERT_FALSE(pixel_1bit(row, 10));
+    TEST_ASSERT_TRUE(pixel_1bit(row, 5));    // Neighbors untouched
+    TEST_ASSERT_TRUE(pixel_1bit(row, 11));
+    return true;
+}
+
+bool test_glyph_atlas_clear_paints_background(void) {
+    RasterTarget target;
+    memset(s_buf, 0, sizeof(s_buf));
+    raster_target_init(&target, (uint8_t *)s_buf, 144, 144, 168, RASTER_FORMAT_8BIT);
+    glyph_atlas_build(&s_atlas, RASTER_FORMAT_8BIT, s_shades, 0xC0);
+
+    glyph_atlas_blit(&s_atlas, &target, 8, GLYPH_SHADE_HEAD, 30, 30);
+    glyph_atlas_clear(&s_atlas, &target, 30, 30);
+
+    for (int r = 0; r < GLYPH_HEIGHT; r++) {
+        for (int c = 0; c < GLYPH_WIDTH; c++) {
+            TEST_ASSERT_EQUAL(0xC0, target.data[(30 + r) * 144 + 30 + c]);
+        }
+    }
+    return true;
+}
+
+bool test_glyph_atlas_blit_clips_to_round_rows(void) {
+    const RasterPlatform *chalk = &g_raster_platforms[RASTER_PLATFORM_CHALK];
+    RasterTarget target;
+    memset(s_buf, 0, sizeof(s_buf));
+    raster_platform_target(&target, chalk, (uint8_t *)s_buf);
+    glyph_atlas_build(&s_atlas, RASTER_FORMAT_8BIT, s_shades, 0xC0);
+
+    // Straddle the left edge of the top row's visible span
+    RasterRow top = raster_target_row(&target, 0);
+    glyph_atlas_blit(&s_atlas, &target, 7, GLYPH_SHADE_HEAD, top.min_x - 2, 0);
+
+    TEST_ASSERT_EQUAL(0xFF, top.data[top.min_x]);
+    TEST_ASSERT_EQUAL(0xFF, top.data[top.min_x + 2]);
+    TEST_ASSERT_EQUAL(0x00, top.data[top.min_x + 3]);
+    return true;
+}
+
+// =============================================================================
+// Test Suite Runner
+// =============================================================================
+
+void run_glyph_atlas_tests(void) {
+    TEST_SUITE_BEGIN("Glyph Atlas");
+    RUN_TEST(test_glyph_atlas_masks_are_lsb_first);
+    RUN_TEST(test_glyph_atlas_matches_tracks_palette);
+    RUN_TEST(test_glyph_atlas_8bit_blit_is_opaque);
+    RUN_TEST(test_glyph_atlas_1bit_blit_across_bytes);
+    RUN_TEST(test_glyph_atlas_clear_paints_background);
+    RUN_TEST(test_glyph_atlas_blit_clips_to_round_rows);
+    TEST_SUITE_END();
+}
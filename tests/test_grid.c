@@ -0,0 +1,246 @@
+// =============================================================================
+// Grid Engine Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/display/grid.h"
+
+// Reference spiral ranking used by the original fixed 9x9 spiral modes
+static int reference_spiral_out_index(int row, int col, int rows, int cols) {
+    int center_row = rows / 2;
+    int center_col = cols / 2;
+    int dr = row - center_row;
+    int dc = col - center_col;
+    int ring = (dr < 0 ? -dr : dr);
+    int dc_abs = (dc < 0 ? -dc : dc);
+    if (dc_abs > ring) ring = dc_abs;
+    if (ring == 0) return 0;
+
+    int ring_start = (2 * ring - 1) * (2 * ring - 1);
+    int ring_size = 8 * ring;
+    int pos = 0;
+    if (row == center_row - ring) {
+        pos = (col - (center_col - ring));
+    } else if (col == center_col + ring) {
+        pos = (2 * ring) + (row - (center_row - ring));
+    } else if (row == center_row + ring) {
+        pos = (4 * ring) + ((center_col + ring) - col);
+    } else if (col == center_col - ring) {
+        pos = (6 * ring) + ((center_row + ring) - row);
+    }
+    return ring_start + (pos % ring_size);
+}
+
+static bool order_is_permutation(const uint16_t *cell_for_rank, int total) {
+    bool seen[GRID_MAX_CELLS] = { false };
+    for (int rank = 0; rank < total; rank++) {
+        int cell = cell_for_rank[rank];
+        if (cell < 0 || cell >= total || seen[cell]) return false;
+        seen[cell] = true;
+    }
+    return true;
+}
+
+// =============================================================================
+// Fill Order Tests
+// =============================================================================
+
+bool test_grid_order_rows_matches_blocks(void) {
+    uint16_t order[GRID_MAX_CELLS];
+    grid_order_rows(12, 8, order);
+
+    for (int row = 0; row < 8; row++) {
+        for (int col = 0; col < 12; col++) {
+            int rank = (8 - 1 - row) * 12 + (12 - 1 - col);
+            TEST_ASSERT_EQUAL(row * 12 + col, order[rank]);
+        }
+    }
+    return true;
+}
+
+bool test_grid_order_columns_matches_vertical_blocks(void) {
+    uint16_t order[GRID_MAX_CELLS];
+    grid_order_columns(8, 12, order);
+
+    for (int col = 0; col < 8; col++) {
+        for (int row = 0; row < 12; row++) {
+            int rank = (8 - 1 - col) * 12 + (12 - 1 - row);
+            TEST_ASSERT_EQUAL(row * 8 + col, order[rank]);
+        }
+    }
+    return true;
+}
+
+bool test_grid_order_spiral_out_matches_reference(void) {
+    uint16_t order[GRID_MAX_CELLS];
+    grid_order_spiral_out(9, 9, order);
+
+    for (int row = 0; row < 9; row++) {
+        for (int col = 0; col < 9; col++) {
+            int rank = reference_spiral_out_index(row, col, 9, 9);
+            TEST_ASSERT_EQUAL(row * 9 + col, order[rank]);
+        }
+    }
+    return true;
+}
+
+bool test_grid_order_spiral_in_is_reversed(void) {
+    uint16_t out[GRID_MAX_CELLS];
+    uint16_t in[GRID_MAX_CELLS];
+    grid_order_spiral_out(9, 9, out);
+    grid_order_spiral_in(9, 9, in);
+
+    for (int rank = 0; rank < 81; rank++) {
+        TEST_ASSERT_EQUAL(out[80 - rank], in[rank]);
+    }
+    return true;
+}
+
+bool test_grid_order_spiral_non_square_covers_all_cells(void) {
+    uint16_t order[GRID_MAX_CELLS];
+    grid_order_spiral_out(18, 12, order);
+    TEST_ASSERT_TRUE(order_is_permutation(order, 18 * 12));
+    TEST_ASSERT_EQUAL(6 * 18 + 9, order[0]);  // Starts at the center
+    return true;
+}
+
+// =============================================================================
+// Layout Tests
+// =============================================================================
+
+bool test_grid_spec_normal_density_keeps_base(void) {
+    GridSpec spec = grid_spec_scaled(12, 8, grid_order_rows, GRID_DENSITY_NORMAL);
+    TEST_ASSERT_EQUAL(12, spec.cols);
+    TEST_ASSERT_EQUAL(8, spec.rows);
+    TEST_ASSERT_EQUAL(2, spec.padding);
+    return true;
+}
+
+bool test_grid_spec_dense_scales_and_keeps_spiral_odd(void) {
+    GridSpec blocks = grid_spec_scaled(12, 8, grid_order_rows, GRID_DENSITY_DENSE);
+    TEST_ASSERT_EQUAL(18, blocks.cols);
+    TEST_ASSERT_EQUAL(12, blocks.rows);
+
+    GridSpec spiral = grid_spec_scaled(9, 9, grid_order_spiral_out, GRID_DENSITY_DENSE);
+    TEST_ASSERT_EQUAL(13, spiral.cols);
+    TEST_ASSERT_EQUAL(13, spiral.rows);
+    return true;
+}
+
+bool test_grid_spec_invalid_density_falls_back(void) {
+    GridSpec spec = grid_spec_scaled(12, 8, grid_order_rows, 99);
+    TEST_ASSERT_EQUAL(12, spec.cols);
+    TEST_ASSERT_EQUAL(8, spec.rows);
+    return true;
+}
+
+bool test_grid_layout_matches_original_blocks(void) {
+    GridSpec spec = grid_spec_scaled(12, 8, grid_order_rows, GRID_DENSITY_NORMAL);
+    GridLayout layout;
+    grid_layout_compute(&layout, &spec, 144, 168);
+
+    TEST_ASSERT_EQUAL(8, layout.cell_size);
+    TEST_ASSERT_EQUAL(118, layout.width);
+    TEST_ASSERT_EQUAL(78, layout.height);
+    TEST_ASSERT_EQUAL(13, layout.origin_x);
+    TEST_ASSERT_EQUAL(35, layout.origin_y);
+
+    int x, y;
+    grid_cell_origin(&layout, 13, &x, &y);  // Row 1, column 1
+    TEST_ASSERT_EQUAL(13 + 10, x);
+    TEST_ASSERT_EQUAL(35 + 10, y);
+    return true;
+}
+
+// =============================================================================
+// State & Diff Tests
+// =============================================================================
+
+bool test_grid_state_configure_invalidates(void) {
+    static GridState state;
+    GridSpec spec = grid_spec_scaled(12, 8, grid_order_rows, GRID_DENSITY_NORMAL);
+
+    state.valid = true;
+    grid_state_configure(&state, &spec, 144, 168);
+
+    TEST_ASSERT_FALSE(state.valid);
+    TEST_ASSERT_TRUE(grid_state_matches(&state, &spec, 144, 168));
+    TEST_ASSERT_FALSE(grid_state_matches(&state, &spec, 200, 228));
+    return true;
+}
+
+bool test_grid_bitset_for_counts_filled_cells(void) {
+    static GridState state;
+    GridSpec spec = grid_spec_scaled(12, 8, grid_order_rows, GRID_DENSITY_NORMAL);
+    grid_state_configure(&state, &spec, 144, 168);
+
+    GridBitset set;
+    grid_state_bitset_for(&state, 13, &set);
+
+    int count = 0;
+    for (int cell = 0; cell < 96; cell++) {
+        if (grid_bitset_test(&set, cell)) count++;
+    }
+    TEST_ASSERT_EQUAL(13, count);
+    TEST_ASSERT_TRUE(grid_bitset_test(&set, 95));   // Bottom-right fills first
+    TEST_ASSERT_FALSE(grid_bitset_test(&set, 0));   // Top-left fills last
+    return true;
+}
+
+bool test_grid_diff_reports_only_flipped_cells(void) {
+    static GridState state;
+    GridSpec spec = grid_spec_scaled(24, 16, grid_order_rows, GRID_DENSITY_NORMAL);
+    grid_state_configure(&state, &spec, 200, 228);
+
+    GridBitset before, after;
+    grid_state_bitset_for(&state, 200, &before);
+    grid_state_bitset_for(&state, 199, &after);
+
+    uint16_t changed[GRID_MAX_CELLS];
+    int num_changed = grid_bitset_diff(&before, &after, changed, GRID_MAX_CELLS);
+    TEST_ASSERT_EQUAL(1, num_changed);
+    TEST_ASSERT_EQUAL(state.cell_for_rank[199], changed[0]);
+    return true;
+}
+
+bool test_grid_diff_identical_frames_is_empty(void) {
+    static GridState state;
+    GridSpec spec = grid_spec_scaled(9, 9, grid_order_spiral_out, GRID_DENSITY_NORMAL);
+    grid_state_configure(&state, &spec, 144, 168);
+
+    GridBitset a, b;
+    grid_state_bitset_for(&state, 40, &a);
+    grid_state_bitset_for(&state, 40, &b);
+
+    uint16_t changed[GRID_MAX_CELLS];
+    TEST_ASSERT_EQUAL(0, grid_bitset_diff(&a, &b, changed, GRID_MAX_CELLS));
+    return true;
+}
+
+// =============================================================================
+// Test Suite Runner
+// =============================================================================
+
+void run_grid_tests(void) {
+    TEST_SUITE_BEGIN("Grid Fill Orders");
+    RUN_TEST(test_grid_order_rows_matches_blocks);
+    RUN_TEST(test_grid_order_columns_matches_vertical_blocks);
+    RUN_TEST(test_grid_order_spiral_out_matches_reference);
+    RUN_TEST(test_grid_order_spiral_in_is_reversed);
+    RUN_TEST(test_grid_order_spiral_non_square_covers_all_cells);
+    TEST_SUITE_END();
+
+    TEST_SUITE_BEGIN("Grid Layout");
+    RUN_TEST(test_grid_spec_normal_density_keeps_base);
+    RUN_TEST(test_grid_spec_dense_scales_and_keeps_spiral_odd);
+    RUN_TEST(test_grid_spec_invalid_density_falls_back);
+    RUN_TEST(test_grid_layout_matches_original_blocks);
+    TEST_SUITE_END();
+
+    TEST_SUITE_BEGIN("Grid State & Diff");
+    RUN_TEST(test_grid_state_configure_invalidates);
+    RUN_TEST(test_grid_bitset_for_counts_filled_cells);
+    RUN_TEST(test_grid_diff_reports_only_flipped_cells);
+    RUN_TEST(test_grid_diff_identical_frames_is_empty);
+    TEST_SUITE_END();
+}
@@ -13,6 +13,21 @@ int g_tests_failed = 0;
 // External test suite runners
 extern void run_time_utils_tests(void);
 extern void run_timer_state_tests(void);
+extern void run_grid_tests(void);
+extern void run_raster_tests(void);
+extern void run_glyph_atlas_tests(void);
+extern void run_numeral_font_tests(void);
+extern void run_display_list_tests(void);
+extern void run_animation_tests(void);
+extern void run_sand_tests(void);
+extern void run_water_tests(void);
+extern void run_view_model_tests(void);
+extern void run_arena_tests(void);
+extern void run_frame_cache_tests(void);
+extern void run_reflow_tests(void);
+extern void run_dashboard_tests(void);
+extern void run_thumbnail_tests(void);
+extern void run_draw_batch_tests(void);
 
 int main(void) {
     printf("\n");
@@ -23,6 +38,21 @@ int main(void) {
     // Run all test suites
     run_time_utils_tests();
     run_timer_state_tests();
+    run_grid_tests();
+    run_raster_tests();
+    run_glyph_atlas_tests();
+    run_numeral_font_tests();
+    run_display_list_tests();
+    run_animation_tests();
+    run_sand_tests();
+    run_water_tests();
+    run_view_model_tests();
+    run_arena_tests();
+    run_frame_cache_tests();
+    run_reflow_tests();
+    run_dashboard_tests();
+    run_thumbnail_tests();
+    run_draw_batch_tests();
     
     // Print summary
     print_test_summary();
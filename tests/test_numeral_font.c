@@ -0,0 +1,137 @@
+// =============================================================================
+// Numeral Font Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/display/numeral_font.h"
+
+// 3x3 test font: '0' is a hollow box, '1' a vertical bar, ':' a center dot
+static const uint8_t s_font_data[] = {
+    3, 3, 4, 3,
+    '0', '1', ':',
+    0x07, 0x05, 0x07,
+    0x02, 0x02, 0x02,
+    0x00, 0x02, 0x00,
+};
+
+static uint8_t s_buf[64 * 16];
+static NumeralFont s_font;
+static NumeralText s_text;
+
+static void setup_target(RasterTarget *target) {
+    memset(s_buf, 0xAA, sizeof(s_buf));
+    raster_target_init(target, s_buf, 64, 64, 16, RASTER_FORMAT_8BIT);
+    numeral_font_init(&s_font, s_font_data, sizeof(s_font_data));
+    memset(&s_text, 0, sizeof(s_text));
+}
+
+// =============================================================================
+// Font Loading Tests
+// =============================================================================
+
+bool test_numeral_font_init_parses_header(void) {
+    TEST_ASSERT_TRUE(numeral_font_init(&s_font, s_font_data, sizeof(s_font_data)));
+    TEST_ASSERT_EQUAL(3, s_font.width);
+    TEST_ASSERT_EQUAL(3, s_font.height);
+    TEST_ASSERT_EQUAL(4, s_font.advance);
+    TEST_ASSERT_EQUAL(3, s_font.count);
+    TEST_ASSERT_EQUAL(1, s_font.row_bytes);
+    return true;
+}
+
+bool test_numeral_font_init_rejects_truncated_data(void) {
+    TEST_ASSERT_FALSE(numeral_font_init(&s_font, s_font_data, sizeof(s_font_data) - 1));
+    TEST_ASSERT_EQUAL(0, s_font.count);
+    TEST_ASSERT_FALSE(numeral_font_init(&s_font, NULL, 0));
+    return true;
+}
+
+bool test_numeral_font_supports_charset_only(void) {
+    numeral_font_init(&s_font, s_font_data, sizeof(s_font_data));
+    TEST_ASSERT_EQUAL(2, numeral_font_glyph(&s_font, ':'));
+    TEST_ASSERT_EQUAL(-1, numeral_font_glyph(&s_font, '9'));
+    TEST_ASSERT_TRUE(numeral_font_supports(&s_font, "10:01"));
+    TEST_ASSERT_FALSE(numeral_font_supports(&s_font, "1:09"));
+    TEST_ASSERT_FALSE(numeral_font_supports(&s_font, "0000000000000"));  // Too long
+    TEST_ASSERT_EQUAL(15, numeral_font_text_width(&s_font, 4));
+    return true;
+}
+
+// =============================================================================
+// Drawing Tests
+// =============================================================================
+
+bool test_numeral_glyph_transparent_keeps_background(void) {
+    RasterTarget target;
+    setup_target(&target);
+
+    numeral_font_draw_glyph(&s_font, &target, 0, 2, 1, 0xFF, 0xC0, false);
+    TEST_ASSERT_EQUAL(0xFF, s_buf[1 * 64 + 2]);
+    TEST_ASSERT_EQUAL(0xAA, s_buf[2 * 64 + 3]);  // Hole in the box untouched
+    TEST_ASSERT_EQUAL(0xFF, s_buf[2 * 64 + 4]);
+
+    numeral_font_draw_glyph(&s_font, &target, 0, 2, 1, 0xFF, 0xC0, true);
+    TEST_ASSERT_EQUAL(0xC0, s_buf[2 * 64 + 3]);  // Opaque fills the hole
+    return true;
+}
+
+bool test_numeral_text_full_draw_centers_and_draws_all(void) {
+    RasterTarget target;
+    setup_target(&target);
+
+    // "10" is 7 px wide; centered in a 15 px rect it starts at x = 4
+    int drawn = numeral_text_draw(&s_text, &s_font, &target, "10", 0, 0, 15, 5, 0xFF, 0xC0, false);
+    TEST_ASSERT_EQUAL(2, drawn);
+    TEST_ASSERT_EQUAL(4, s_text.x);
+    TEST_ASSERT_EQUAL(1, s_text.y);
+    TEST_ASSERT_EQUAL(0xFF, s_buf[1 * 64 + 5]);  // Bar of the 1
+    TEST_ASSERT_EQUAL(0xFF, s_buf[1 * 64 + 8]);  // Left edge of the 0
+    return true;
+}
+
+bool test_numeral_text_incremental_redraws_changed_cells(void) {
+    RasterTarget target;
+    setup_target(&target);
+
+    numeral_text_draw(&s_text, &s_font, &target, "10:00", 0, 0, 64, 5, 0xFF, 0xC0, false);
+    int drawn = numeral_text_draw(&s_text, &s_font, &target, "10:01", 0, 0, 64, 5, 0xFF, 0xC0, true);
+    TEST_ASSERT_EQUAL(1, drawn);
+
+    drawn = numeral_text_draw(&s_text, &s_font, &target, "10:01", 0, 0, 64, 5, 0xFF, 0xC0, true);
+    TEST_ASSERT_EQUAL(0, drawn);
+    return true;
+}
+
+bool test_numeral_text_layout_change_clears_old_text(void) {
+    RasterTarget target;
+    setup_target(&target);
+
+    numeral_text_draw(&s_text, &s_font, &target, "10:00", 0, 0, 64, 5, 0xFF, 0xC0, false);
+    int old_x = s_text.x;
+    int drawn = numeral_text_draw(&s_text, &s_font, &target, "0:00", 0, 0, 64, 5, 0xFF, 0xC0, true);
+    TEST_ASSERT_EQUAL(4, drawn);
+
+    // The first cell of the old, wider text is now background
+    TEST_ASSERT_TRUE(s_text.x > old_x);
+    TEST_ASSERT_EQUAL(0xC0, s_buf[1 * 64 + old_x]);
+    return true;
+}
+
+// =============================================================================
+// Test Suite Runner
+// =============================================================================
+
+void run_numeral_font_tests(void) {
+    TEST_SUITE_BEGIN("Numeral Font");
+    RUN_TEST(test_numeral_font_init_parses_header);
+    RUN_TEST(test_numeral_font_init_rejects_truncated_data);
+    RUN_TEST(test_numeral_font_supports_charset_only);
+    RUN_TEST(test_numeral_glyph_transparent_keeps_background);
+    TEST_SUITE_END();
+
+    TEST_SUITE_BEGIN("Numeral Text");
+    RUN_TEST(test_numeral_text_full_draw_centers_and_draws_all);
+    RUN_TEST(test_numeral_text_incremental_redraws_changed_cells);
+    RUN_TEST(test_numeral_text_layout_change_clears_old_text);
+    TEST_SUITE_END();
+}
@@ -0,0 +1,315 @@
+// =============================================================================
+// Raster Kernel Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "raster_reference.h"
+#include "../src/c/display/display_list.h"
+
+// Word-aligned buffers large enough for emery's 200x228 8-bit framebuffer
+static uint32_t s_fast_buf[(200 * 228) / 4];
+static uint32_t s_ref_buf[(200 * 228) / 4];
+
+static bool buffers_equal(const RasterTarget *a, const RasterTarget *b) {
+    return memcmp(a->data, b->data, (size_t)(a->stride * a->height)) == 0;
+}
+
+static void setup_pair(RasterTarget *fast, RasterTarget *ref, const RasterPlatform *platform) {
+    memset(s_fast_buf, 0, sizeof(s_fast_buf));
+    memset(s_ref_buf, 0, sizeof(s_ref_buf));
+    raster_platform_target(fast, platform, (uint8_t *)s_fast_buf);
+    raster_platform_target(ref, platform, (uint8_t *)s_ref_buf);
+}
+
+// =============================================================================
+// Pixel Conversion Tests
+// =============================================================================
+
+bool test_raster_pixel_8bit_is_argb(void) {
+    RasterTarget target;
+    raster_target_init(&target, (uint8_t *)s_fast_buf, 144, 144, 168, RASTER_FORMAT_8BIT);
+    TEST_ASSERT_EQUAL(0xCB, raster_pixel_for(&target, 0xCB));
+    return true;
+}
+
+bool test_raster_pixel_1bit_thresholds_luminance(void) {
+    RasterTarget target;
+    raster_target_init(&target, (uint8_t *)s_fast_buf, 20, 144, 168, RASTER_FORMAT_1BIT);
+    TEST_ASSERT_EQUAL(1, raster_pixel_for(&target, 0xFF));  // White
+    TEST_ASSERT_EQUAL(0, raster_pixel_for(&target, 0xC0));  // Black
+    TEST_ASSERT_EQUAL(1, raster_pixel_for(&target, 0xEA));  // Light gray
+    TEST_ASSERT_EQUAL(0, raster_pixel_for(&target, 0xD5));  // Dark gray
+    return true;
+}
+
+bool test_raster_host_build_carries_both_depths(void) {
+    // Host builds leave RASTER_DEPTH unset so both kernels are tested
+    TEST_ASSERT_TRUE(raster_format_supported(RASTER_FORMAT_1BIT));
+    TEST_ASSERT_TRUE(raster_format_supported(RASTER_FORMAT_8BIT));
+    return true;
+}
+
+// =============================================================================
+// Corner Inset Tests
+// =============================================================================
+
+bool test_raster_corner_inset_small_radii(void) {
+    TEST_ASSERT_EQUAL(0, raster_corner_inset(0, 0));
+    TEST_ASSERT_EQUAL(1, raster_corner_inset(2, 0));
+    TEST_ASSERT_EQUAL(0, raster_corner_inset(2, 1));
+    TEST_ASSERT_EQUAL(2, raster_corner_inset(4, 0));
+    TEST_ASSERT_EQUAL(1, raster_corner_inset(4, 1));
+    TEST_ASSERT_EQUAL(0, raster_corner_inset(4, 5));
+    return true;
+}
+
+// =============================================================================
+// Kernel vs Reference Tests
+// =============================================================================
+
+static bool check_fills_match_reference(const RasterPlatform *platform) {
+    RasterTarget fast, ref;
+    setup_pair(&fast, &ref, platform);
+
+    // Spans that start and end on every word alignment, plus clipped edges
+    for (int i = 0; i < 40; i++) {
+        int x = (i * 37) % platform->width - 10;
+        int y = (i * 53) % platform->height - 5;
+        int w = 1 + (i * 29) % 90;
+        int h = 1 + (i * 17) % 30;
+        uint8_t color = (i & 1) ? 0xFF : 0xCB;
+
+        raster_fill_rect(&fast, x, y, w, h, color);
+        raster_reference_fill_rect(&ref, x, y, w, h, color);
+        if (!buffers_equal(&fast, &ref)) {
+            printf("\n    fill_rect mismatch on %s (i=%d)", platform->name, i);
+            return false;
+        }
+
+        raster_fill_round_rect(&fast, x + 3, y + 3, w, h, 1 + i % 4, 0xC0);
+        raster_reference_fill_round_rect(&ref, x + 3, y + 3, w, h, 1 + i % 4, 0xC0);
+        if (!buffers_equal(&fast, &ref)) {
+            printf("\n    fill_round_rect mismatch on %s (i=%d)", platform->name, i);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_raster_fills_match_reference_all_platforms(void) {
+    for (int i = 0; i < RASTER_PLATFORM_COUNT; i++) {
+        TEST_ASSERT_TRUE(check_fills_match_reference(&g_raster_platforms[i]));
+    }
+    return true;
+}
+
+static bool check_arcs_match_reference(const RasterPlatform *platform) {
+    RasterTarget fast, ref;
+    setup_pair(&fast, &ref, platform);
+
+    // Sweeps around the whole turn (0 and 360 are the full ring), with
+    // centers near and past every edge
+    for (int i = 0; i <= 48; i++) {
+        int32_t angle = (int32_t)i * DL_ANGLE_MAX / 48 + (i % 3) * 97;
+        int32_t end_x = (i == 48) ? 0 : dl_sin(angle);
+        int32_t end_y = (i == 48) ? 0 : -dl_cos(angle);
+        int cx = (i * 41) % (platform->width + 20) - 10;
+        int cy = (i * 67) % (platform->height + 20) - 10;
+        int outer = 4 + (i * 13) % 70;
+        int inner = (i & 1) ? outer - 1 - i % 12 : 0;
+        if (inner < 0) inner = 0;
+        uint8_t color = (i & 2) ? 0xFF : 0xE0;
+
+        raster_fill_annulus_sector(&fast, cx, cy, inner, outer, end_x, end_y, color);
+        raster_reference_fill_annulus_sector(&ref, cx, cy, inner, outer, end_x, end_y, color);
+        if (!buffers_equal(&fast, &ref)) {
+            printf("\n    fill_annulus_sector mismatch on %s (i=%d)", platform->name, i);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool test_raster_arcs_match_reference_all_platforms(void) {
+    for (int i = 0; i < RASTER_PLATFORM_COUNT; i++) {
+        TEST_ASSERT_TRUE(check_arcs_match_reference(&g_raster_platforms[i]));
+    }
+    return true;
+}
+
+bool test_raster_arc_quarter_covers_one_quadrant(void) {
+    RasterTarget target;
+    memset(s_fast_buf, 0, sizeof(s_fast_buf));
+    raster_target_init(&target, (uint8_t *)s_fast_buf, 144, 144, 168, RASTER_FORMAT_8BIT);
+
+    // 90 degrees clockwise from 12 o'clock ends pointing at 3 o'clock
+    raster_fill_annulus_sector(&target, 72, 84, 10, 20, 1, 0, 0xFF);
+    uint8_t *px = target.data;
+
+    TEST_ASSERT_EQUAL(0xFF, px[70 * 144 + 77]);   // Upper right
+    TEST_ASSERT_EQUAL(0x00, px[70 * 144 + 67]);   // Upper left
+    TEST_ASSERT_EQUAL(0x00, px[98 * 144 + 77]);   // Lower right
+    TEST_ASSERT_EQUAL(0x00, px[84 * 144 + 72]);   // Hole in the middle
+    TEST_ASSERT_EQUAL(0x00, px[64 * 144 + 72]);   // Outer radius is exclusive
+    TEST_ASSERT_EQUAL(0xFF, px[65 * 144 + 72]);
+    return true;
+}
+
+bool test_raster_round_rect_outline_is_hollow_and_closed(void) {
+    RasterTarget target;
+    memset(s_fast_buf, 0, sizeof(s_fast_buf));
+    raster_target_init(&target, (uint8_t *)s_fast_buf, 144, 144, 168, RASTER_FORMAT_8BIT);
+
+    raster_draw_round_rect(&target, 10, 10, 8, 8, 2, 0xFF);
+    uint8_t *px = target.data;
+
+    TEST_ASSERT_EQUAL(0x00, px[10 * 144 + 10]);   // Corner pixel stays clear
+    TEST_ASSERT_EQUAL(0xFF, px[10 * 144 + 11]);   // Top edge
+    TEST_ASSERT_EQUAL(0xFF, px[14 * 144 + 10]);   // Left edge
+    TEST_ASSERT_EQUAL(0xFF, px[14 * 144 + 17]);   // Right edge
+    TEST_ASSERT_EQUAL(0xFF, px[17 * 144 + 14]);   // Bottom edge
+    TEST_ASSERT_EQUAL(0x00, px[14 * 144 + 14]);   // Interior stays clear
+    return true;
+}
+
+bool test_raster_1bit_span_across_words(void) {
+    RasterTarget target;
+    memset(s_fast_buf, 0, sizeof(s_fast_buf));
+    raster_target_init(&target, (uint8_t *)s_fast_buf, 20, 144, 168, RASTER_FORMAT_1BIT);
+
+    raster_fill_span(&target, 0, 30, 70, 0xFF);
+    uint8_t *row = target.data;
+
+    TEST_ASSERT_EQUAL(0xC0, row[3]);  // Pixels 30-31
+    TEST_ASSERT_EQUAL(0xFF, row[4]);  // Pixels 32-39
+    TEST_ASSERT_EQUAL(0xFF, row[7]);  // Pixels 56-63
+    TEST_ASSERT_EQUAL(0x7F, row[8]);  // Pixels 64-70
+    TEST_ASSERT_EQUAL(0x00, row[9]);
+    return true;
+}
+
+bool test_raster_circular_rows_are_clipped(void) {
+    const RasterPlatform *chalk = &g_raster_platforms[RASTER_PLATFORM_CHALK];
+    RasterTarget target;
+    memset(s_fast_buf, 0, sizeof(s_fast_buf));
+    raster_platform_target(&target, chalk, (uint8_t *)s_fast_buf);
+
+    // A full-width fill on the top row must only touch that row's visible span
+    raster_fill_rect(&target, 0, 0, chalk->width, 1, 0xFF);
+    RasterRow top = raster_target_row(&target, 0);
+    TEST_ASSERT_TRUE(top.min_x > 0);
+    TEST_ASSERT_EQUAL(0xFF, top.data[top.min_x]);
+    TEST_ASSERT_EQUAL(0xFF, top.data[top.max_x]);
+
+    RasterRow next = raster_target_row(&target, 1);
+    TEST_ASSERT_EQUAL(0x00, next.data[next.min_x]);
+    return true;
+}
+
+// =============================================================================
+// Dither Tests
+// =============================================================================
+
+static int lit_pixels(const RasterTarget *target, int x, int y, int w, int h) {
+    int lit = 0;
+    for (int row = y; row < y + h; row++) {
+        const uint8_t *data = target->data + row * target->stride;
+        for (int col = x; col < x + w; col++) {
+            lit += (data[col >> 3] >> (col & 7)) & 1;
+        }
+    }
+    return lit;
+}
+
+static void setup_dither(RasterTarget *target, RasterDither *dither, int stride) {
+    static const uint8_t palette[RASTER_DITHER_COLORS] = { 0xC0, 0xFF, 0xEA, 0xD5 };
+    memset(s_fast_buf, 0, sizeof(s_fast_buf));
+    raster_target_init(target, (uint8_t *)s_fast_buf, stride, 144, 168, RASTER_FORMAT_1BIT);
+    raster_dither_init(dither, palette, RASTER_DITHER_COLORS);
+    target->dither = dither;
+}
+
+bool test_raster_dither_levels_follow_luminance(void) {
+    TEST_ASSERT_EQUAL(0, raster_dither_level(0xC0));    // Black
+    TEST_ASSERT_EQUAL(16, raster_dither_level(0xFF));   // White
+    TEST_ASSERT_EQUAL(11, raster_dither_level(0xEA));   // Light gray
+    TEST_ASSERT_EQUAL(5, raster_dither_level(0xD5));    // Dark gray
+    return true;
+}
+
+bool test_raster_dither_fill_lights_its_level(void) {
+    RasterTarget target;
+    RasterDither dither;
+    // 20-byte rows take the word path, 18-byte rows the byte path on odd rows
+    const int strides[] = { 20, 18 };
+    for (int s = 0; s < 2; s++) {
+        setup_dither(&target, &dither, strides[s]);
+        raster_fill_rect(&target, 3, 5, 64, 8, 0xEA);
+        TEST_ASSERT_EQUAL(64 * 8 * 11 / 16, lit_pixels(&target, 0, 0, 144, 20));
+
+        setup_dither(&target, &dither, strides[s]);
+        raster_fill_rect(&target, 33, 2, 96, 4, 0xD5);
+        TEST_ASSERT_EQUAL(96 * 4 * 5 / 16, lit_pixels(&target, 0, 0, 144, 20));
+        TEST_ASSERT_EQUAL(0, lit_pixels(&target, 0, 2, 33, 4));
+        TEST_ASSERT_EQUAL(0, lit_pixels(&target, 129, 2, 15, 4));
+    }
+    return true;
+}
+
+bool test_raster_dither_black_and_white_stay_solid(void) {
+    RasterTarget target;
+    RasterDither dither;
+    setup_dither(&target, &dither, 20);
+    raster_fill_rect(&target, 7, 3, 50, 9, 0xFF);
+    raster_fill_rect(&target, 20, 5, 10, 2, 0xC0);
+    memcpy(s_ref_buf, s_fast_buf, 20 * 168);
+
+    memset(s_fast_buf, 0, sizeof(s_fast_buf));
+    target.dither = NULL;
+    raster_fill_rect(&target, 7, 3, 50, 9, 0xFF);
+    raster_fill_rect(&target, 20, 5, 10, 2, 0xC0);
+    TEST_ASSERT_TRUE(memcmp(s_ref_buf, s_fast_buf, 20 * 168) == 0);
+    return true;
+}
+
+bool test_raster_dither_other_colors_threshold(void) {
+    RasterTarget target;
+    RasterDither dither;
+    setup_dither(&target, &dither, 20);
+    TEST_ASSERT_TRUE(raster_dither_tile(&dither, 0xF0) == NULL);
+
+    raster_fill_rect(&target, 0, 0, 32, 4, 0xF0);   // Red, darker than half
+    TEST_ASSERT_EQUAL(0, lit_pixels(&target, 0, 0, 32, 4));
+    raster_fill_rect(&target, 0, 0, 32, 4, 0xFC);   // Yellow, lighter
+    TEST_ASSERT_EQUAL(32 * 4, lit_pixels(&target, 0, 0, 32, 4));
+    return true;
+}
+
+// =============================================================================
+// Test Suite Runner
+// =============================================================================
+
+void run_raster_tests(void) {
+    TEST_SUITE_BEGIN("Raster Pixels");
+    RUN_TEST(test_raster_pixel_8bit_is_argb);
+    RUN_TEST(test_raster_pixel_1bit_thresholds_luminance);
+    RUN_TEST(test_raster_host_build_carries_both_depths);
+    RUN_TEST(test_raster_corner_inset_small_radii);
+    TEST_SUITE_END();
+
+    TEST_SUITE_BEGIN("Raster Kernels");
+    RUN_TEST(test_raster_fills_match_reference_all_platforms);
+    RUN_TEST(test_raster_round_rect_outline_is_hollow_and_closed);
+    RUN_TEST(test_raster_1bit_span_across_words);
+    RUN_TEST(test_raster_circular_rows_are_clipped);
+    RUN_TEST(test_raster_arcs_match_reference_all_platforms);
+    RUN_TEST(test_raster_arc_quarter_covers_one_quadrant);
+    TEST_SUITE_END();
+
+    TEST_SUITE_BEGIN("Raster Dither");
+    RUN_TEST(test_raster_dither_levels_follow_luminance);
+    RUN_TEST(test_raster_dither_fill_lights_its_level);
+    RUN_TEST(test_raster_dither_black_and_white_stay_solid);
+    RUN_TEST(test_raster_dither_other_colors_threshold);
+    TEST_SUITE_END();
+}
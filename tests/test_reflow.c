@@ -0,0 +1,185 @@
+// =============================================================================
+// Layout Reflow Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/display/reflow.h"
+#include "../src/c/display/display_emit.h"
+
+static DisplayList s_from;
+static DisplayList s_to;
+static DisplayList s_list;
+static ListReflow s_reflow;
+static SandGrid s_sand;
+
+// Timeline Quick View on a 144x168 screen leaves 144x117
+#define FULL_HEIGHT 168
+#define PEEK_HEIGHT 117
+
+static DisplayInput make_input(int height) {
+    DisplayInput in = {
+        .width = 144, .height = height,
+        .remaining_seconds = 200, .total_seconds = 300,
+        .running = true,
+        .background = 0xC0, .primary = 0xFF, .secondary = 0xD5, .accent = 0xF0,
+        .hint = 0xEA
+    };
+    return in;
+}
+
+static bool same_list(const DisplayList *a, const DisplayList *b) {
+    if (a->count != b->count) return false;
+    for (int i = 0; i < a->count; i++) {
+        if (memcmp(&a->prims[i], &b->prims[i], sizeof(DlPrim)) != 0) return false;
+    }
+    return true;
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool test_reflow_lerp_reaches_both_ends(void) {
+    TEST_ASSERT_EQUAL(10, reflow_lerp(10, -20, 0));
+    TEST_ASSERT_EQUAL(-20, reflow_lerp(10, -20, REFLOW_PROGRESS_MAX));
+    TEST_ASSERT_EQUAL(-5, reflow_lerp(10, -20, REFLOW_PROGRESS_MAX / 2 + 1));
+    TEST_ASSERT_EQUAL(10, reflow_lerp(10, -20, -1));
+
+    DlRect from = { 0, 100, 144, 30 };
+    DlRect to = { 0, 50, 144, 30 };
+    DlRect mid = reflow_rect(from, to, REFLOW_PROGRESS_MAX / 2 + 1);
+    TEST_ASSERT_EQUAL(75, mid.y);
+    TEST_ASSERT_EQUAL(144, mid.w);
+    return true;
+}
+
+bool test_list_reflow_slides_every_list_mode(void) {
+    sand_init(&s_sand, SAND_GRAINS / 3);
+    for (int step = 0; step < 200; step++) sand_step(&s_sand);
+
+    for (int mode = 0; mode < DISPLAY_MODE_COUNT; mode++) {
+        if (!display_emit_supports((DisplayMode)mode)) continue;
+        DisplayInput full = make_input(FULL_HEIGHT);
+        DisplayInput peek = make_input(PEEK_HEIGHT);
+        full.sand = peek.sand = s_sand.rows;
+
+        display_emit(&s_from, (DisplayMode)mode, &full);
+        display_emit(&s_to, (DisplayMode)mode, &peek);
+        list_reflow_from(&s_reflow, &s_from);
+        list_reflow_to(&s_reflow, &s_to);
+
+        // The end layout, moved all the way back, is the start layout
+        display_emit(&s_list, (DisplayMode)mode, &peek);
+        list_reflow_apply(&s_reflow, &s_list, 0);
+        TEST_ASSERT_TRUE(same_list(&s_list, &s_from));
+
+        display_emit(&s_list, (DisplayMode)mode, &peek);
+        list_reflow_apply(&s_reflow, &s_list, REFLOW_PROGRESS_MAX);
+        TEST_ASSERT_TRUE(same_list(&s_list, &s_to));
+
+        // Halfway, every primitive sits between its two places
+        display_emit(&s_list, (DisplayMode)mode, &peek);
+        list_reflow_apply(&s_reflow, &s_list, REFLOW_PROGRESS_MAX / 2);
+        for (int i = 0; i < s_list.count; i++) {
+            int y = s_list.prims[i].rect.y;
+            int a = s_from.prims[i].rect.y;
+            int b = s_to.prims[i].rect.y;
+            TEST_ASSERT_TRUE(y >= (a < b ? a : b) && y <= (a > b ? a : b));
+        }
+    }
+    return true;
+}
+
+bool test_list_reflow_new_prims_follow_their_type(void) {
+    display_list_reset(&s_from);
+    dl_fill_rect(&s_from, 0, 40, 10, 10, 0, 0xFF);
+    dl_fill_rect(&s_from, 0, 50, 10, 10, 0, 0xFF);
+    display_list_reset(&s_to);
+    dl_fill_rect(&s_to, 0, 20, 10, 10, 0, 0xFF);
+    dl_fill_rect(&s_to, 0, 30, 10, 10, 0, 0xFF);
+    list_reflow_from(&s_reflow, &s_from);
+    list_reflow_to(&s_reflow, &s_to);
+
+    // A third row appeared since the slide began
+    display_list_reset(&s_list);
+    dl_fill_rect(&s_list, 0, 20, 10, 10, 0, 0xFF);
+    dl_fill_rect(&s_list, 0, 30, 10, 10, 0, 0xFF);
+    dl_fill_rect(&s_list, 0, 40, 10, 10, 0, 0xFF);
+    list_reflow_apply(&s_reflow, &s_list, 0);
+    TEST_ASSERT_EQUAL(40, s_list.prims[0].rect.y);
+    TEST_ASSERT_EQUAL(50, s_list.prims[1].rect.y);
+    TEST_ASSERT_EQUAL(60, s_list.prims[2].rect.y);
+    return true;
+}
+
+bool test_list_reflow_leaves_unpaired_prims(void) {
+    display_list_reset(&s_from);
+    dl_stroke_circle(&s_from, 72, 84, 52, 2, 0xFF);
+    dl_line(&s_from, 72, 84, 72, 40, 2, 0xFF);
+    display_list_reset(&s_to);
+    dl_fill_circle(&s_to, 72, 58, 38, 0xFF);
+    dl_line(&s_to, 72, 58, 72, 28, 2, 0xFF);
+    list_reflow_from(&s_reflow, &s_from);
+    list_reflow_to(&s_reflow, &s_to);
+
+    // The circles aren't the same primitive; the lines are
+    s_list = s_to;
+    list_reflow_apply(&s_reflow, &s_list, 0);
+    TEST_ASSERT_EQUAL(58, s_list.prims[0].rect.y);
+    TEST_ASSERT_EQUAL(38, s_list.prims[0].a);
+    TEST_ASSERT_EQUAL(84, s_list.prims[1].rect.y);
+    TEST_ASSERT_EQUAL(40, s_list.prims[1].b);
+    return true;
+}
+
+bool test_list_modes_fit_quick_view_area(void) {
+    sand_init(&s_sand, SAND_GRAINS / 3);
+    static const int sizes[][3] = {
+        { 144, FULL_HEIGHT, PEEK_HEIGHT },
+        { 200, 228, 177 },   // Emery
+    };
+
+    for (int s = 0; s < 2; s++) {
+        for (int mode = 0; mode < DISPLAY_MODE_COUNT; mode++) {
+            if (!display_emit_supports((DisplayMode)mode)) continue;
+            DisplayInput full = make_input(sizes[s][1]);
+            DisplayInput peek = make_input(sizes[s][2]);
+            full.width = peek.width = sizes[s][0];
+            full.sand = peek.sand = s_sand.rows;
+            display_emit(&s_from, (DisplayMode)mode, &full);
+            display_emit(&s_list, (DisplayMode)mode, &peek);
+
+            // The art stays inside the area
+            for (int i = 0; i < s_list.count; i++) {
+                DlRect bounds = dl_prim_bounds(&s_list.prims[i]);
+                TEST_ASSERT_TRUE(bounds.y >= 0);
+                TEST_ASSERT_TRUE(bounds.y + bounds.h <= peek.height);
+            }
+
+            // And so does the time, clear of the art if it was at full height
+            DisplayTimeSlot full_slot, slot;
+            if (!display_emit_time_slot((DisplayMode)mode, &peek, &slot)) continue;
+            display_emit_time_slot((DisplayMode)mode, &full, &full_slot);
+            TEST_ASSERT_TRUE(slot.rect.y >= 0);
+            TEST_ASSERT_TRUE(slot.rect.y + slot.rect.h <= peek.height);
+            if (!display_list_touches(&s_from, full_slot.rect)) {
+                TEST_ASSERT_FALSE(display_list_touches(&s_list, slot.rect));
+            }
+        }
+    }
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_reflow_tests(void) {
+    TEST_SUITE_BEGIN("Layout Reflow");
+    RUN_TEST(test_reflow_lerp_reaches_both_ends);
+    RUN_TEST(test_list_reflow_slides_every_list_mode);
+    RUN_TEST(test_list_reflow_new_prims_follow_their_type);
+    RUN_TEST(test_list_reflow_leaves_unpaired_prims);
+    RUN_TEST(test_list_modes_fit_quick_view_area);
+    TEST_SUITE_END();
+}
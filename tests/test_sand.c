@@ -0,0 +1,160 @@
+// =============================================================================
+// Falling Sand Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/sand.h"
+
+static SandGrid s_grid;
+static SandGrid s_other;
+
+static bool grains_inside_walls(const SandGrid *grid) {
+    for (int row = 0; row < SAND_ROWS; row++) {
+        if (grid->rows[row] & (SandRow)~sand_row_mask(row)) return false;
+    }
+    return true;
+}
+
+// FNV-1a over the rows, to pin a whole run to one number
+static uint32_t grid_hash(const SandGrid *grid) {
+    uint32_t hash = 2166136261u;
+    for (int row = 0; row < SAND_ROWS; row++) {
+        hash = (hash ^ (grid->rows[row] & 0xFF)) * 16777619u;
+        hash = (hash ^ (grid->rows[row] >> 8)) * 16777619u;
+    }
+    return hash;
+}
+
+// Drain the whole glass the way a 100 s countdown does at 20 steps/s,
+// checking the invariants after every step; returns the final hash
+static uint32_t run_countdown(SandGrid *grid) {
+    sand_init(grid, 0);
+    for (int step = 0; step < 100 * 20; step++) {
+        if (step % 20 == 0) {
+            sand_set_target(grid, (step / 20) * SAND_GRAINS / 100);
+        }
+        sand_step(grid);
+        if (sand_count(grid, 0, SAND_ROWS) != SAND_GRAINS || !grains_inside_walls(grid)) return 0;
+    }
+    return grid_hash(grid);
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool test_sand_masks_are_symmetric(void) {
+    for (int row = 0; row < SAND_ROWS; row++) {
+        SandRow mask = sand_row_mask(row);
+        SandRow mirrored = 0;
+        for (int col = 0; col < SAND_COLS; col++) {
+            if (mask & (1u << col)) mirrored |= (SandRow)(1u << (SAND_COLS - 1 - col));
+        }
+        TEST_ASSERT_EQUAL(mask, mirrored);
+
+        // The chambers mirror each other, but for the top rim
+        if (row > 0 && row < SAND_ROWS - 1) {
+            TEST_ASSERT_EQUAL(sand_row_mask(SAND_ROWS - 1 - row), mask);
+        }
+    }
+    TEST_ASSERT_EQUAL(1, __builtin_popcount(sand_row_mask(SAND_CHAMBER_ROWS)));
+    TEST_ASSERT_EQUAL(0, sand_row_mask(-1));
+    TEST_ASSERT_EQUAL(0, sand_row_mask(SAND_ROWS));
+    return true;
+}
+
+bool test_sand_init_settles_both_chambers(void) {
+    sand_init(&s_grid, 20);
+    TEST_ASSERT_EQUAL(SAND_GRAINS - 20, sand_count(&s_grid, 0, SAND_CHAMBER_ROWS));
+    TEST_ASSERT_EQUAL(20, sand_count(&s_grid, SAND_CHAMBER_ROWS, SAND_CHAMBER_ROWS));
+    TEST_ASSERT_TRUE(grains_inside_walls(&s_grid));
+    TEST_ASSERT_TRUE(sand_is_idle(&s_grid));
+
+    // Already at rest: a step moves nothing
+    memcpy(&s_other, &s_grid, sizeof(s_grid));
+    sand_step(&s_grid);
+    TEST_ASSERT_TRUE(memcmp(s_grid.rows, s_other.rows, sizeof(s_grid.rows)) == 0);
+    TEST_ASSERT_TRUE(s_grid.settled);
+    return true;
+}
+
+bool test_sand_grain_falls_one_row_per_step(void) {
+    sand_init(&s_grid, 0);
+    sand_set_target(&s_grid, 1);
+    sand_step(&s_grid);
+    TEST_ASSERT_EQUAL(1, s_grid.released);
+    TEST_ASSERT_EQUAL(1, sand_count(&s_grid, SAND_CHAMBER_ROWS, SAND_CHAMBER_ROWS));
+
+    // Straight down the middle to the base
+    for (int row = SAND_CHAMBER_ROWS + 2; row < SAND_ROWS; row++) {
+        sand_step(&s_grid);
+        TEST_ASSERT_EQUAL(1, sand_count(&s_grid, row, 1));
+    }
+    sand_step(&s_grid);
+    TEST_ASSERT_TRUE(sand_is_idle(&s_grid));
+    return true;
+}
+
+bool test_sand_grains_slide_off_a_pile(void) {
+    memset(&s_grid, 0, sizeof(s_grid));
+    s_grid.rows[SAND_ROWS - 1] = 0x0180;   // Two grains on the floor
+    s_grid.rows[SAND_ROWS - 2] = 0x0180;   // Two resting on them
+    s_grid.rows[SAND_ROWS - 3] = 0x0180;   // Two more, which must slide
+    sand_step(&s_grid);
+    sand_step(&s_grid);
+    TEST_ASSERT_EQUAL(6, sand_count(&s_grid, 0, SAND_ROWS));
+    TEST_ASSERT_EQUAL(0, sand_count(&s_grid, SAND_ROWS - 3, 1));
+    TEST_ASSERT_EQUAL(4, sand_count(&s_grid, SAND_ROWS - 1, 1));
+    return true;
+}
+
+bool test_sand_neck_is_closed(void) {
+    sand_init(&s_grid, 0);
+    for (int i = 0; i < 100; i++) sand_step(&s_grid);
+    TEST_ASSERT_EQUAL(0, sand_count(&s_grid, SAND_CHAMBER_ROWS, SAND_CHAMBER_ROWS));
+    return true;
+}
+
+bool test_sand_target_only_rises(void) {
+    sand_init(&s_grid, 0);
+    sand_set_target(&s_grid, 8);
+    sand_set_target(&s_grid, 4);
+    TEST_ASSERT_EQUAL(8, s_grid.target);
+    sand_set_target(&s_grid, SAND_GRAINS + 10);   // Far behind: settle at once, clamped
+    TEST_ASSERT_EQUAL(SAND_GRAINS, s_grid.released);
+    TEST_ASSERT_EQUAL(0, sand_count(&s_grid, 0, SAND_CHAMBER_ROWS));
+    return true;
+}
+
+bool test_sand_countdown_drains_and_conserves(void) {
+    uint32_t hash = run_countdown(&s_grid);
+    TEST_ASSERT_TRUE(hash != 0);
+    TEST_ASSERT_EQUAL(SAND_GRAINS - SAND_GRAINS * 99 / 100,
+                      sand_count(&s_grid, 0, SAND_CHAMBER_ROWS));
+    return true;
+}
+
+bool test_sand_is_deterministic(void) {
+    uint32_t first = run_countdown(&s_grid);
+    uint32_t second = run_countdown(&s_other);
+    TEST_ASSERT_EQUAL(first, second);
+    TEST_ASSERT_TRUE(memcmp(&s_grid, &s_other, sizeof(SandGrid)) == 0);
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_sand_tests(void) {
+    TEST_SUITE_BEGIN("Falling Sand");
+    RUN_TEST(test_sand_masks_are_symmetric);
+    RUN_TEST(test_sand_init_settles_both_chambers);
+    RUN_TEST(test_sand_grain_falls_one_row_per_step);
+    RUN_TEST(test_sand_grains_slide_off_a_pile);
+    RUN_TEST(test_sand_neck_is_closed);
+    RUN_TEST(test_sand_target_only_rises);
+    RUN_TEST(test_sand_countdown_drains_and_conserves);
+    RUN_TEST(test_sand_is_deterministic);
+    TEST_SUITE_END();
+}
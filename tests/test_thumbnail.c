@@ -0,0 +1,134 @@
+// =============================================================================
+// Thumbnail Atlas Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "raster_reference.h"
+#include "../src/c/display/thumbnail.h"
+
+#define SLOTS 3
+
+static uint32_t s_screen[(200 * 228) / 4];
+static uint8_t s_atlas_8bit[THUMBNAIL_WIDTH * THUMBNAIL_HEIGHT * SLOTS];
+static uint8_t s_atlas_1bit[(THUMBNAIL_WIDTH / 8) * THUMBNAIL_HEIGHT * SLOTS];
+
+static uint8_t atlas_pixel(const ThumbnailAtlas *atlas, int slot, int x, int y) {
+    RasterRow row = raster_target_row(&atlas->target, thumbnail_atlas_slot_y(slot) + y);
+    if (atlas->target.format == RASTER_FORMAT_1BIT) {
+        return (row.data[x >> 3] >> (x & 7)) & 1;
+    }
+    return row.data[x];
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool test_thumbnail_atlas_tracks_pending_slots(void) {
+    ThumbnailAtlas atlas;
+    thumbnail_atlas_init(&atlas, s_atlas_8bit, THUMBNAIL_WIDTH, RASTER_FORMAT_8BIT, SLOTS);
+    TEST_ASSERT_EQUAL(0, thumbnail_atlas_next_pending(&atlas));
+
+    RasterTarget screen;
+    raster_platform_target(&screen, &g_raster_platforms[RASTER_PLATFORM_BASALT], (uint8_t *)s_screen);
+    for (int slot = 0; slot < SLOTS; slot++) {
+        thumbnail_atlas_store(&atlas, slot, &screen, 0, 0, screen.width, screen.height);
+    }
+    TEST_ASSERT_EQUAL(-1, thumbnail_atlas_next_pending(&atlas));
+
+    // Only the invalidated slot is drawn again
+    thumbnail_atlas_invalidate(&atlas, 1);
+    TEST_ASSERT_TRUE(thumbnail_atlas_is_valid(&atlas, 0));
+    TEST_ASSERT_FALSE(thumbnail_atlas_is_valid(&atlas, 1));
+    TEST_ASSERT_EQUAL(1, thumbnail_atlas_next_pending(&atlas));
+    thumbnail_atlas_invalidate(&atlas, SLOTS);
+    TEST_ASSERT_FALSE(thumbnail_atlas_is_valid(&atlas, SLOTS));
+    TEST_ASSERT_EQUAL(1, thumbnail_atlas_next_pending(&atlas));
+    return true;
+}
+
+bool test_thumbnail_atlas_averages_8bit_boxes(void) {
+    RasterTarget screen;
+    raster_platform_target(&screen, &g_raster_platforms[RASTER_PLATFORM_BASALT], (uint8_t *)s_screen);
+    raster_reference_fill_rect(&screen, 0, 0, screen.width, screen.height, 0xC0);
+    // Every other column red: each box averages to half red
+    for (int x = 0; x < screen.width; x += 2) {
+        raster_reference_fill_rect(&screen, x, 0, 1, screen.height / 2, 0xF0);
+    }
+
+    ThumbnailAtlas atlas;
+    thumbnail_atlas_init(&atlas, s_atlas_8bit, THUMBNAIL_WIDTH, RASTER_FORMAT_8BIT, SLOTS);
+    thumbnail_atlas_store(&atlas, 2, &screen, 0, 0, screen.width, screen.height);
+
+    // 144x168 has the slot's shape and fills it
+    TEST_ASSERT_EQUAL(0xE0, atlas_pixel(&atlas, 2, 0, 0));
+    TEST_ASSERT_EQUAL(0xE0, atlas_pixel(&atlas, 2, THUMBNAIL_WIDTH - 1, THUMBNAIL_HEIGHT / 2 - 1));
+    TEST_ASSERT_EQUAL(0xC0, atlas_pixel(&atlas, 2, 0, THUMBNAIL_HEIGHT / 2));
+    TEST_ASSERT_EQUAL(0xC0, atlas_pixel(&atlas, 2, THUMBNAIL_WIDTH - 1, THUMBNAIL_HEIGHT - 1));
+    return true;
+}
+
+bool test_thumbnail_atlas_keeps_round_screens_square(void) {
+    RasterTarget screen;
+    raster_platform_target(&screen, &g_raster_platforms[RASTER_PLATFORM_CHALK], (uint8_t *)s_screen);
+    raster_reference_fill_rect(&screen, 0, 0, screen.width, screen.height, 0xFF);
+
+    ThumbnailAtlas atlas;
+    memset(s_atlas_8bit, 0x55, sizeof(s_atlas_8bit));
+    thumbnail_atlas_init(&atlas, s_atlas_8bit, THUMBNAIL_WIDTH, RASTER_FORMAT_8BIT, SLOTS);
+    thumbnail_atlas_store(&atlas, 0, &screen, 0, 0, screen.width, screen.height);
+
+    // A 24x24 picture centered in the slot, the margins transparent, as
+    // are the corners outside the circle
+    TEST_ASSERT_EQUAL(0x00, atlas_pixel(&atlas, 0, 12, 1));
+    TEST_ASSERT_EQUAL(0xFF, atlas_pixel(&atlas, 0, 12, 2));
+    TEST_ASSERT_EQUAL(0xFF, atlas_pixel(&atlas, 0, 0, 14));
+    TEST_ASSERT_EQUAL(0xFF, atlas_pixel(&atlas, 0, 23, 14));
+    TEST_ASSERT_EQUAL(0x00, atlas_pixel(&atlas, 0, 0, 2));
+    TEST_ASSERT_EQUAL(0x00, atlas_pixel(&atlas, 0, 23, 25));
+    TEST_ASSERT_EQUAL(0x00, atlas_pixel(&atlas, 0, 12, 26));
+    // The next slot is untouched
+    TEST_ASSERT_EQUAL(0x55, atlas_pixel(&atlas, 1, 0, 0));
+    return true;
+}
+
+bool test_thumbnail_atlas_dithers_1bit_boxes(void) {
+    RasterTarget screen;
+    raster_platform_target(&screen, &g_raster_platforms[RASTER_PLATFORM_APLITE], (uint8_t *)s_screen);
+    raster_reference_fill_rect(&screen, 0, 0, screen.width, screen.height, 0xC0);
+    raster_reference_fill_rect(&screen, 0, 0, screen.width / 2, screen.height, 0xFF);
+    // A line thinner than a box still shows in the dark half, as a pattern
+    raster_reference_fill_rect(&screen, 0, 120, screen.width, 3, 0xFF);
+
+    ThumbnailAtlas atlas;
+    thumbnail_atlas_init(&atlas, s_atlas_1bit, THUMBNAIL_WIDTH / 8, RASTER_FORMAT_1BIT, SLOTS);
+    thumbnail_atlas_store(&atlas, 1, &screen, 0, 0, screen.width, screen.height);
+
+    int lit_left = 0, lit_right = 0, lit_line = 0;
+    for (int y = 0; y < THUMBNAIL_HEIGHT; y++) {
+        for (int x = 0; x < THUMBNAIL_WIDTH; x++) {
+            int lit = atlas_pixel(&atlas, 1, x, y);
+            if (x < THUMBNAIL_WIDTH / 2) lit_left += lit;
+            else if (y == 20) lit_line += lit;
+            else lit_right += lit;
+        }
+    }
+    TEST_ASSERT_EQUAL(THUMBNAIL_WIDTH / 2 * THUMBNAIL_HEIGHT, lit_left);
+    TEST_ASSERT_EQUAL(0, lit_right);
+    TEST_ASSERT_TRUE(lit_line > 0);
+    TEST_ASSERT_TRUE(lit_line < THUMBNAIL_WIDTH / 2);
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_thumbnail_tests(void) {
+    TEST_SUITE_BEGIN("Thumbnail Atlas");
+    RUN_TEST(test_thumbnail_atlas_tracks_pending_slots);
+    RUN_TEST(test_thumbnail_atlas_averages_8bit_boxes);
+    RUN_TEST(test_thumbnail_atlas_keeps_round_screens_square);
+    RUN_TEST(test_thumbnail_atlas_dithers_1bit_boxes);
+    TEST_SUITE_END();
+}
@@ -31,8 +31,7 @@ bool test_effects_none_all_false(void) {
     TEST_ASSERT_FALSE(effects.unsubscribe_tick_timer);
     TEST_ASSERT_FALSE(effects.start_vibration);
     TEST_ASSERT_FALSE(effects.stop_vibration);
-    TEST_ASSERT_FALSE(effects.init_hourglass);
-    TEST_ASSERT_FALSE(effects.init_matrix);
+    TEST_ASSERT_FALSE(effects.activate_mode);
     TEST_ASSERT_FALSE(effects.vibrate_short);
     TEST_ASSERT_FALSE(effects.pop_window);
     return true;
@@ -53,8 +52,7 @@ bool test_timer_start_initializes_correctly(void) {
     TEST_ASSERT_EQUAL(300, ctx.total_seconds);
     TEST_ASSERT_TRUE(effects.subscribe_tick_timer);
     TEST_ASSERT_TRUE(effects.update_display);
-    TEST_ASSERT_TRUE(effects.init_hourglass);
-    TEST_ASSERT_TRUE(effects.init_matrix);
+    TEST_ASSERT_TRUE(effects.activate_mode);
     return true;
 }
 
@@ -234,8 +232,7 @@ bool test_timer_restart_resets_time(void) {
     
     TEST_ASSERT_EQUAL(STATE_RUNNING, ctx.state);
     TEST_ASSERT_EQUAL(300, ctx.remaining_seconds);
-    TEST_ASSERT_TRUE(effects.init_hourglass);
-    TEST_ASSERT_TRUE(effects.init_matrix);
+    TEST_ASSERT_TRUE(effects.activate_mode);
     TEST_ASSERT_TRUE(effects.update_display);
     return true;
 }
@@ -272,6 +269,23 @@ bool test_cycle_display_mode_wraps(void) {
     return true;
 }
 
+bool test_toggle_hide_time_text_updates_overlay_only(void) {
+    TimerContext ctx;
+    timer_context_init(&ctx);
+    ctx.state = STATE_RUNNING;
+    ctx.display_mode = DISPLAY_MODE_RING;
+    
+    TimerEffects effects = timer_handle_up_long(&ctx);
+    
+    TEST_ASSERT_TRUE(ctx.hide_time_text);
+    TEST_ASSERT_TRUE(effects.update_time_overlay);
+    TEST_ASSERT_FALSE(effects.update_display);  // The visualization is untouched
+    
+    timer_handle_up_long(&ctx);
+    TEST_ASSERT_FALSE(ctx.hide_time_text);
+    return true;
+}
+
 bool test_display_mode_name(void) {
     TEST_ASSERT_EQUAL_STRING("Text", timer_display_mode_name(DISPLAY_MODE_TEXT));
     TEST_ASSERT_EQUAL_STRING("Blocks", timer_display_mode_name(DISPLAY_MODE_BLOCKS));
@@ -697,6 +711,7 @@ void run_timer_state_tests(void) {
     TEST_SUITE_BEGIN("Display Mode");
     RUN_TEST(test_cycle_display_mode);
     RUN_TEST(test_cycle_display_mode_wraps);
+    RUN_TEST(test_toggle_hide_time_text_updates_overlay_only);
     RUN_TEST(test_display_mode_name);
     TEST_SUITE_END();
     
@@ -0,0 +1,196 @@
+// =============================================================================
+// Main Window View Model Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/view_model.h"
+
+// A stand-in for the SDK's layer setters that counts what gets written
+typedef struct {
+    int canvas_writes;
+    int shown_writes[VIEW_TEXT_COUNT];
+    int text_writes[VIEW_TEXT_COUNT];
+    int tone_writes;
+    bool canvas_shown;
+    bool text_shown[VIEW_TEXT_COUNT];
+    const char *text[VIEW_TEXT_COUNT];
+    ViewTone tone;
+} FakeWindow;
+
+static void fake_set_canvas_shown(bool shown, void *context) {
+    FakeWindow *w = context;
+    w->canvas_writes++;
+    w->canvas_shown = shown;
+}
+
+static void fake_set_text_shown(ViewText which, bool shown, void *context) {
+    FakeWindow *w = context;
+    w->shown_writes[which]++;
+    w->text_shown[which] = shown;
+}
+
+static void fake_set_text(ViewText which, const char *text, void *context) {
+    FakeWindow *w = context;
+    w->text_writes[which]++;
+    w->text[which] = text;
+}
+
+static void fake_set_time_tone(ViewTone tone, void *context) {
+    FakeWindow *w = context;
+    w->tone_writes++;
+    w->tone = tone;
+}
+
+static FakeWindow s_window;
+static ViewModel s_applied;
+static ViewModel s_next;
+static const ViewSink s_sink = {
+    .set_canvas_shown = fake_set_canvas_shown,
+    .set_text_shown = fake_set_text_shown,
+    .set_text = fake_set_text,
+    .set_time_tone = fake_set_time_tone,
+    .context = &s_window,
+};
+
+static int total_writes(const FakeWindow *w) {
+    int total = w->canvas_writes + w->tone_writes;
+    for (int i = 0; i < VIEW_TEXT_COUNT; i++) {
+        total += w->shown_writes[i] + w->text_writes[i];
+    }
+    return total;
+}
+
+// Apply the context's view model and return how many properties were written
+static int update(const TimerContext *ctx) {
+    s_window.canvas_writes = 0;
+    s_window.tone_writes = 0;
+    memset(s_window.shown_writes, 0, sizeof(s_window.shown_writes));
+    memset(s_window.text_writes, 0, sizeof(s_window.text_writes));
+    view_model_build(ctx, &s_next);
+    view_model_apply(&s_applied, &s_next, &s_sink);
+    return total_writes(&s_window);
+}
+
+static void start_fresh(TimerContext *ctx, DisplayMode mode) {
+    timer_context_init(ctx);
+    ctx->display_mode = mode;
+    memset(&s_window, 0, sizeof(s_window));
+    view_model_invalidate(&s_applied);
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool test_view_model_first_apply_writes_everything(void) {
+    TimerContext ctx;
+    start_fresh(&ctx, DISPLAY_MODE_TEXT);
+    TEST_ASSERT_EQUAL(2 + 2 * VIEW_TEXT_COUNT, update(&ctx));
+    TEST_ASSERT_FALSE(s_window.canvas_shown);
+    TEST_ASSERT_EQUAL_STRING("Select Time", s_window.text[VIEW_TEXT_TITLE]);
+    TEST_ASSERT_EQUAL_STRING("5 min", s_window.text[VIEW_TEXT_TIME]);
+    TEST_ASSERT_TRUE(s_window.text_shown[VIEW_TEXT_HINT]);
+
+    // Nothing changed: nothing written
+    TEST_ASSERT_EQUAL(0, update(&ctx));
+    return true;
+}
+
+bool test_view_model_text_tick_writes_time_only(void) {
+    TimerContext ctx;
+    start_fresh(&ctx, DISPLAY_MODE_TEXT);
+    update(&ctx);
+    timer_start(&ctx, 1);
+    update(&ctx);
+
+    timer_tick(&ctx);
+    TEST_ASSERT_EQUAL(1, update(&ctx));
+    TEST_ASSERT_EQUAL(1, s_window.text_writes[VIEW_TEXT_TIME]);
+    TEST_ASSERT_EQUAL_STRING("0:59", s_window.text[VIEW_TEXT_TIME]);
+
+    // Crossing into the last ten seconds also recolors the time
+    while (ctx.remaining_seconds > 11) timer_tick(&ctx);
+    update(&ctx);
+    timer_tick(&ctx);
+    TEST_ASSERT_EQUAL(2, update(&ctx));
+    TEST_ASSERT_EQUAL(VIEW_TONE_LOW, s_window.tone);
+    return true;
+}
+
+bool test_view_model_canvas_tick_writes_nothing(void) {
+    TimerContext ctx;
+    start_fresh(&ctx, DISPLAY_MODE_CLOCK);
+    update(&ctx);
+    timer_start(&ctx, 1);
+    update(&ctx);
+    TEST_ASSERT_TRUE(s_window.canvas_shown);
+    TEST_ASSERT_FALSE(s_window.text_shown[VIEW_TEXT_TIME]);
+
+    timer_tick(&ctx);
+    TEST_ASSERT_EQUAL(0, update(&ctx));
+    return true;
+}
+
+bool test_view_model_hidden_text_catches_up_when_shown(void) {
+    TimerContext ctx;
+    start_fresh(&ctx, DISPLAY_MODE_CLOCK);
+    update(&ctx);
+    timer_start(&ctx, 1);
+    update(&ctx);
+    for (int i = 0; i < 5; i++) {
+        timer_tick(&ctx);
+        update(&ctx);
+    }
+    TEST_ASSERT_EQUAL_STRING("5 min", s_window.text[VIEW_TEXT_TIME]);
+
+    // Switching to Text mode shows the time layer with the current time
+    ctx.display_mode = DISPLAY_MODE_TEXT;
+    update(&ctx);
+    TEST_ASSERT_FALSE(s_window.canvas_shown);
+    TEST_ASSERT_TRUE(s_window.text_shown[VIEW_TEXT_TIME]);
+    TEST_ASSERT_EQUAL_STRING("0:55", s_window.text[VIEW_TEXT_TIME]);
+    TEST_ASSERT_EQUAL(1, s_window.text_writes[VIEW_TEXT_TIME]);
+    return true;
+}
+
+bool test_view_model_settings_change_while_paused_keeps_canvas(void) {
+    TimerContext ctx;
+    start_fresh(&ctx, DISPLAY_MODE_CLOCK);
+    timer_start(&ctx, 1);
+    timer_pause(&ctx);
+    update(&ctx);
+    TEST_ASSERT_TRUE(s_window.canvas_shown);
+
+    // Colors, grid sizes and other modes' flags leave the canvas as it was
+    ctx.grid_density[DISPLAY_MODE_BLOCKS] = 1;
+    ctx.display_mode_enabled[DISPLAY_MODE_RING] = false;
+    TEST_ASSERT_EQUAL(0, update(&ctx));
+    ctx.display_mode = DISPLAY_MODE_RING;
+    TEST_ASSERT_EQUAL(0, update(&ctx));
+    TEST_ASSERT_TRUE(s_window.canvas_shown);
+
+    // Falling back to Text hides it, and resuming on a canvas mode shows it
+    ctx.display_mode = DISPLAY_MODE_TEXT;
+    update(&ctx);
+    TEST_ASSERT_FALSE(s_window.canvas_shown);
+    ctx.display_mode = DISPLAY_MODE_CLOCK;
+    timer_resume(&ctx);
+    update(&ctx);
+    TEST_ASSERT_TRUE(s_window.canvas_shown);
+    TEST_ASSERT_EQUAL(1, s_window.canvas_writes);
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_view_model_tests(void) {
+    TEST_SUITE_BEGIN("View Model");
+    RUN_TEST(test_view_model_first_apply_writes_everything);
+    RUN_TEST(test_view_model_text_tick_writes_time_only);
+    RUN_TEST(test_view_model_canvas_tick_writes_nothing);
+    RUN_TEST(test_view_model_hidden_text_catches_up_when_shown);
+    RUN_TEST(test_view_model_settings_change_while_paused_keeps_canvas);
+    TEST_SUITE_END();
+}
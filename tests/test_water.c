@@ -0,0 +1,121 @@
+// =============================================================================
+// Water Surface Unit Tests
+// =============================================================================
+
+#include "test_framework.h"
+#include "../src/c/water.h"
+
+static WaterSurface s_surface;
+static WaterSurface s_other;
+
+// Step until still, returning the number of steps (or -1 past `limit`)
+static int steps_to_rest(WaterSurface *surface, int limit) {
+    for (int step = 0; step < limit; step++) {
+        if (water_is_still(surface)) return step;
+        water_step(surface);
+    }
+    return -1;
+}
+
+// =============================================================================
+// Tests
+// =============================================================================
+
+bool test_water_flat_surface_is_still(void) {
+    water_init(&s_surface);
+    TEST_ASSERT_TRUE(water_is_still(&s_surface));
+
+    // Stepping a still surface changes nothing, and level readings don't wake it
+    memcpy(&s_other, &s_surface, sizeof(s_surface));
+    water_step(&s_surface);
+    water_set_tilt(&s_surface, 0);
+    TEST_ASSERT_TRUE(memcmp(&s_surface, &s_other, sizeof(s_surface)) == 0);
+    return true;
+}
+
+bool test_water_tilt_settles_on_a_slope(void) {
+    water_init(&s_surface);
+    water_set_tilt(&s_surface, -300);   // Right side low
+    TEST_ASSERT_FALSE(water_is_still(&s_surface));
+
+    int steps = steps_to_rest(&s_surface, 400);
+    TEST_ASSERT_TRUE(steps > 0);
+
+    // Water piles up on the low side, symmetrically about the middle
+    int mid = WATER_COLUMNS / 2;
+    TEST_ASSERT_EQUAL(0, water_column_offset(&s_surface, mid));
+    TEST_ASSERT_TRUE(water_column_offset(&s_surface, WATER_COLUMNS - 1) > 3);
+    TEST_ASSERT_EQUAL(-water_column_offset(&s_surface, 0), water_column_offset(&s_surface, WATER_COLUMNS - 1));
+    for (int col = 1; col < WATER_COLUMNS; col++) {
+        TEST_ASSERT_TRUE(water_column_offset(&s_surface, col) >= water_column_offset(&s_surface, col - 1));
+    }
+    return true;
+}
+
+bool test_water_sloshes_before_settling(void) {
+    water_init(&s_surface);
+    water_set_tilt(&s_surface, -1000);   // Steep: clamped at the walls
+
+    // The low wall overshoots its rest height on the way there
+    int last = WATER_COLUMNS - 1;
+    int peak = 0;
+    for (int step = 0; step < 200; step++) {
+        water_step(&s_surface);
+        int offset = water_column_offset(&s_surface, last);
+        if (offset > peak) peak = offset;
+        TEST_ASSERT_TRUE(offset <= WATER_MAX_OFFSET && offset >= -WATER_MAX_OFFSET);
+    }
+    TEST_ASSERT_EQUAL(WATER_MAX_OFFSET, peak);
+
+    // Level again: back to flat, then asleep
+    water_set_tilt(&s_surface, 0);
+    TEST_ASSERT_TRUE(steps_to_rest(&s_surface, 600) > 0);
+    for (int col = 0; col < WATER_COLUMNS; col++) {
+        TEST_ASSERT_EQUAL(0, water_column_offset(&s_surface, col));
+    }
+    return true;
+}
+
+bool test_water_ignores_sensor_noise(void) {
+    water_init(&s_surface);
+    water_set_tilt(&s_surface, -500);
+    steps_to_rest(&s_surface, 400);
+
+    water_set_tilt(&s_surface, -500 + WATER_TILT_DEADBAND - 1);
+    water_set_tilt(&s_surface, -500 - WATER_TILT_DEADBAND + 1);
+    TEST_ASSERT_TRUE(water_is_still(&s_surface));
+
+    water_set_tilt(&s_surface, -500 + WATER_TILT_DEADBAND);
+    TEST_ASSERT_FALSE(water_is_still(&s_surface));
+    return true;
+}
+
+bool test_water_is_deterministic(void) {
+    static const int readings[] = { -400, 250, 0, 800, -120 };
+    water_init(&s_surface);
+    water_init(&s_other);
+    for (int i = 0; i < 5; i++) {
+        water_set_tilt(&s_surface, readings[i]);
+        water_set_tilt(&s_other, readings[i]);
+        for (int step = 0; step < 37; step++) {
+            water_step(&s_surface);
+            water_step(&s_other);
+        }
+    }
+    TEST_ASSERT_TRUE(memcmp(&s_surface, &s_other, sizeof(s_surface)) == 0);
+    return true;
+}
+
+// =============================================================================
+// Test Runner
+// =============================================================================
+
+void run_water_tests(void) {
+    TEST_SUITE_BEGIN("Water Surface");
+    RUN_TEST(test_water_flat_surface_is_still);
+    RUN_TEST(test_water_tilt_settles_on_a_slope);
+    RUN_TEST(test_water_sloshes_before_settling);
+    RUN_TEST(test_water_ignores_sensor_noise);
+    RUN_TEST(test_water_is_deterministic);
+    TEST_SUITE_END();
+}
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""Generate the vector art resources (Pebble Draw Command images).
+
+Builds the outlines that never change, one image per screen size, into
+resources/art/. The layout mirrors the emitters in
+src/c/display/display_emit.c, which place each image by the top left of
+its area; change both together.
+
+    hourglass         glass outline
+    water_glass       container walls, floor and rim
+    water_marks       measurement marks (recolored to the accent)
+    clock_face        face ring and hour markers
+
+Strokes are white here; the app recolors them to the mode's palette.
+Run it by hand after changing the layout and commit the result; make test
+runs it with --check, which fails if the committed art no longer matches.
+Needs only the standard library.
+
+Usage: python3 tools/gen_art.py [--check]
+"""
+
+import math
+import os
+import struct
+import sys
+
+# Screen sizes and the file suffix that selects each one (aplite has no
+# draw command images and keeps drawing lines)
+SCREENS = [
+    ('', 144, 168),         # basalt, diorite, flint
+    ('~round', 180, 180),   # chalk
+    ('~emery', 200, 228),
+]
+
+MARGIN = 2          # ART_MARGIN: area beyond the outline's points
+WHITE = 0xFF
+CLEAR = 0x00
+
+
+# =============================================================================
+# Draw command image format
+# =============================================================================
+
+def path(points, stroke_width, closed=False):
+    data = struct.pack('<BBBBBHH', 1, 0, WHITE, stroke_width, CLEAR, 0 if closed else 1, len(points))
+    for x, y in points:
+        data += struct.pack('<hh', x, y)
+    return data
+
+
+def circle(center, radius, stroke_width):
+    data = struct.pack('<BBBBBHH', 2, 0, WHITE, stroke_width, CLEAR, radius, 1)
+    return data + struct.pack('<hh', *center)
+
+
+def image(size, commands):
+    body = struct.pack('<BBhh', 1, 0, size[0], size[1])
+    body += struct.pack('<H', len(commands)) + b''.join(commands)
+    return b'PDCI' + struct.pack('<I', len(body)) + body
+
+
+# =============================================================================
+# Layouts (see display_emit.c)
+# =============================================================================
+
+def unit_for(width):
+    return 4 if width >= 200 else 3
+
+
+def area_size(x0, y0, x1, y1):
+    return (x1 - x0 + 2 * MARGIN + 1, y1 - y0 + 2 * MARGIN + 1)
+
+
+def hourglass(width, height):
+    unit = unit_for(width)
+    glass_width = 20 * unit
+    half_height = (100 * unit // 3) // 2
+    neck_width = 8 * unit // 3
+
+    left, right = MARGIN, MARGIN + glass_width
+    top, middle, bottom = MARGIN, MARGIN + half_height, MARGIN + 2 * half_height
+    neck_left = MARGIN + glass_width // 2 - neck_width // 2
+    neck_right = MARGIN + glass_width // 2 + neck_width // 2
+
+    outline = [(neck_left, middle), (left, top), (right, top), (neck_right, middle),
+               (right, bottom), (left, bottom)]
+    return image(area_size(0, 0, glass_width, 2 * half_height), [path(outline, 2, closed=True)])
+
+
+def water_layout(width):
+    """Container outline points in the image's coordinates."""
+    unit = unit_for(width)
+    center_x = 1000   # Any center; everything is made relative to the area
+    container_width = 50 * unit // 3
+    container_height = 100 * unit // 3
+    rim_offset = 10 * unit // 3
+    rim_width = container_width + 8 * unit // 3
+    mark_length = 5 * unit // 3
+    scale_height = container_height - 20 * unit // 3
+
+    container_left = center_x - container_width // 2
+    container_right = center_x + container_width // 2
+    art_left = min(center_x - rim_width // 2, container_left - mark_length)
+    art_right = center_x + rim_width // 2
+
+    def x(v):
+        return v - art_left + MARGIN
+
+    rim_y = MARGIN
+    return {
+        'size': area_size(art_left, 0, art_right, container_height - rim_offset),
+        'left': x(container_left),
+        'right': x(container_right),
+        'rim': (x(center_x - rim_width // 2), x(art_right)),
+        'rim_y': rim_y,
+        'bottom': rim_y + container_height - rim_offset,
+        'marks': [(x(container_left - mark_length), rim_y + i * scale_height // 5) for i in range(1, 5)],
+    }
+
+
+def water_glass(width, height):
+    w = water_layout(width)
+    walls = [(w['left'], w['rim_y']), (w['left'], w['bottom']), (w['right'], w['bottom']), (w['right'], w['rim_y'])]
+    rim = [(w['rim'][0], w['rim_y']), (w['rim'][1], w['rim_y'])]
+    return image(w['size'], [path(walls, 2), path(rim, 2)])
+
+
+def water_marks(width, height):
+    w = water_layout(width)
+    return image(w['size'], [path([(x, y), (w['left'], y)], 1) for x, y in w['marks']])
+
+
+def clock_face(width, height):
+    radius = width // 2 - 20
+    center = (MARGIN + radius, MARGIN + radius)
+
+    def polar(degrees, r):
+        # Fixed point and truncation as in the emitter's dl_cos / dl_sin
+        angle = math.radians(degrees - 90)
+        cos = round(math.cos(angle) * 0x10000)
+        sin = round(math.sin(angle) * 0x10000)
+        return (center[0] + int(cos * r / 0x10000), center[1] + int(sin * r / 0x10000))
+
+    commands = [circle(center, radius, 2)]
+    for i in range(12):
+        commands.append(path([polar(i * 30, radius - 8), polar(i * 30, radius - 3)], 3 if i % 3 == 0 else 1))
+    return image(area_size(0, 0, 2 * radius, 2 * radius), commands)
+
+
+ART = [
+    ('hourglass', hourglass),
+    ('water_glass', water_glass),
+    ('water_marks', water_marks),
+    ('clock_face', clock_face),
+]
+
+
+def images():
+    for name, build in ART:
+        for suffix, width, height in SCREENS:
+            yield '{}{}.pdc'.format(name, suffix), build(width, height)
+
+
+def read(path):
+    if not os.path.exists(path):
+        return None
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def generate(out_dir):
+    os.makedirs(out_dir, exist_ok=True)
+    written = []
+    for filename, data in images():
+        target = os.path.join(out_dir, filename)
+        # Leave unchanged files alone so the resource step stays cached
+        if read(target) != data:
+            with open(target, 'wb') as f:
+                f.write(data)
+        written.append((filename, len(data)))
+    return written
+
+
+def check(out_dir):
+    """Names of the committed images that differ from what would be generated."""
+    return [filename for filename, data in images() if read(os.path.join(out_dir, filename)) != data]
+
+
+def main():
+    out_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'resources', 'art')
+    if '--check' in sys.argv[1:]:
+        stale = check(out_dir)
+        for filename in stale:
+            print('resources/art/{} is out of date; run python3 tools/gen_art.py'.format(filename))
+        if not stale:
+            print('Vector art matches tools/gen_art.py')
+        sys.exit(1 if stale else 0)
+    for filename, size in generate(out_dir):
+        print('{}: {} bytes'.format(filename, size))
+
+
+if __name__ == '__main__':
+    main()
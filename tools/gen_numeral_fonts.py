@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Generate the pre-rasterized numeral font resources.
+
+Renders the overlay charset with a TrueType font and writes one raw
+resource per size into resources/fonts/. Format (see numeral_font.h):
+
+    u8 width, u8 height, u8 advance, u8 count
+    count bytes of character codes
+    count glyphs of `height` rows, ceil(width / 8) bytes per row,
+    bit 0 of each byte is the leftmost pixel
+
+Usage: python3 tools/gen_numeral_fonts.py [path/to/font.ttf]
+Requires Pillow.
+"""
+
+import os
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+CHARSET = '0123456789:%ABCDEF'
+DEFAULT_FONT = '/usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf'
+
+# (resource file, digit height in pixels, spacing between glyph cells)
+# Digit heights match the system fonts the overlay used: Gothic 18 Bold,
+# Gothic 24 Bold and Bitham 34 Medium Numbers.
+SIZES = [
+    ('numerals_18.bin', 11, 1),
+    ('numerals_24.bin', 15, 1),
+    ('numerals_34.bin', 24, 2),
+]
+
+THRESHOLD = 128
+
+
+def font_for_digit_height(path, digit_height):
+    size = digit_height
+    while True:
+        font = ImageFont.truetype(path, size)
+        left, top, right, bottom = font.getbbox('0')
+        if bottom - top >= digit_height:
+            return font
+        size += 1
+
+
+def render(font, ch):
+    left, top, right, bottom = font.getbbox(ch)
+    image = Image.new('L', (right + 4, bottom + 4), 0)
+    ImageDraw.Draw(image).text((0, 0), ch, font=font, fill=255)
+    return image
+
+
+def ink_bounds(image):
+    bbox = image.point(lambda v: 255 if v >= THRESHOLD else 0).getbbox()
+    return bbox or (0, 0, 0, 0)
+
+
+def build(font_path, filename, digit_height, spacing):
+    font = font_for_digit_height(font_path, digit_height)
+    images = {ch: render(font, ch) for ch in CHARSET}
+    bounds = {ch: ink_bounds(images[ch]) for ch in CHARSET}
+
+    # Cells are sized for the digits; wider glyphs (%, some letters) are
+    # squeezed horizontally so the advance stays tight
+    top = min(b[1] for b in bounds.values())
+    bottom = max(b[3] for b in bounds.values())
+    width = max(bounds[ch][2] - bounds[ch][0] for ch in '0123456789')
+    height = bottom - top
+    row_bytes = (width + 7) // 8
+
+    out = bytearray([width, height, width + spacing, len(CHARSET)])
+    out += CHARSET.encode('ascii')
+
+    for ch in CHARSET:
+        image = images[ch]
+        left, _, right, _ = bounds[ch]
+        if right - left > width:
+            strip = image.crop((left, 0, right, image.height)).resize((width, image.height), Image.LANCZOS)
+            image = Image.new('L', images[ch].size, 0)
+            image.paste(strip, (0, 0))
+            left, right = 0, width
+        offset = (width - (right - left)) // 2
+        for y in range(top, bottom):
+            row = [0] * row_bytes
+            for x in range(left, right):
+                if image.getpixel((x, y)) >= THRESHOLD:
+                    col = x - left + offset
+                    row[col >> 3] |= 1 << (col & 7)
+            out += bytes(row)
+    return bytes(out), width, height
+
+
+def main():
+    font_path = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_FONT
+    out_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'resources', 'fonts')
+    os.makedirs(out_dir, exist_ok=True)
+
+    for filename, digit_height, spacing in SIZES:
+        data, width, height = build(font_path, filename, digit_height, spacing)
+        with open(os.path.join(out_dir, filename), 'wb') as f:
+            f.write(data)
+        print('{}: {}x{} cells, {} bytes'.format(filename, width, height, len(data)))
+
+
+if __name__ == '__main__':
+    main()